@@ -52,8 +52,10 @@ void sys_check_core_locking(const char *file, int line, const char *func);
 // #define MEMP_NUM_PBUF                      16
 // #define MEMP_NUM_RAW_PCB                   4
 #ifndef MEMP_NUM_UDP_PCB
-// Reduced from 8 since mDNS is disabled
-#define MEMP_NUM_UDP_PCB                   6  /* 4, was 8 for mDNS */
+// mDNS is disabled. In use: PGN 8888 and RTCM 2233 receive pcbs, udpSend,
+// udpDHCP (67), EventLogger syslog and RTCMFanout - six, plus two spare for
+// DHCP/DNS clients or a future socket
+#define MEMP_NUM_UDP_PCB                   8  /* 4, was 6 before RTCMFanout */
 #endif  // !MEMP_NUM_UDP_PCB
 #ifndef MEMP_NUM_TCP_PCB
 #define MEMP_NUM_TCP_PCB                   8  /* 5 */
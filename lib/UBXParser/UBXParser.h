@@ -4,7 +4,11 @@
 // You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
 // Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
 
+#ifdef UBX_HOST_BENCH
+#include "UBXHostShim.h"  // tools/ubx_bench
+#else
 #include "elapsedMillis.h"
+#endif
 //#include <stdint.h>
 class UBX_Parser {
 private:
@@ -45,6 +49,17 @@ private:
     // UBX frame structure detailed here
     // https://content.u-blox.com/sites/default/files/documents/u-blox-F9-HPG-1.32_InterfaceDescription_UBX-22008968.pdf
 
+    // Callers that decode the payload in place (GNSSProcessor) pick it up from here
+    frameClass = this->msgclass;
+    frameId = this->msgid;
+    frameLength = this->msglen;
+    frameReady = true;
+
+    if (this->msgclass != 0x01) {   // Only NAV messages below
+      this->reportUnhandled(this->msgid);
+      return;
+    }
+
     switch (this->msgid) {
       //RELPOSNED
       case 0x3C:
@@ -97,6 +112,11 @@ private:
         }
         break;
 
+      //HPPOSLLH, EOE - decoded from the frame by GNSSProcessor
+      case 0x14:
+      case 0x61:
+        break;
+
       default:
         this->reportUnhandled(this->msgid);
         break;
@@ -277,6 +297,14 @@ public:
   UBX_Data ubxData;
 
   bool relPosNedReady, useDual, relPosNedRcvd, debug, firstHeadingDetected;
+
+  // Last frame with a good checksum - valid until the next byte is parsed
+  bool frameReady;
+  int frameClass, frameId, frameLength;
+  const uint8_t* framePayload() const { return (const uint8_t*)this->payload; }
+
+  // The next 0xB5 starts a frame
+  bool waitingForSync() const { return this->count < 0; }
   uint32_t msgPeriod, msgReadTime;
   elapsedMillis relPosTimer, pvtTimer;
   uint16_t relMissed;
@@ -292,6 +320,13 @@ public:
     this->chka = -1;
     this->chkb = -1;
     this->count = -1;
+    this->frameReady = false;
+    this->relPosNedReady = false;
+    this->useDual = false;
+    this->relPosNedRcvd = false;
+    this->debug = false;
+    this->firstHeadingDetected = false;
+    this->relMissed = 0;
   }
 
   /**
@@ -300,6 +335,8 @@ public:
           * @param b the byte
           */
   void parse(int b) {
+    this->frameReady = false;
+
     if (b == 0xB5 && this->count < 0) {
       //Serial.print(" cnt:"); Serial.print(this->count);
       this->state = GOT_SYNC1;
@@ -346,6 +383,14 @@ public:
       this->count = 0;
       this->addchk(b);
       if (debug) Serial.print(" L2");
+
+      if (this->msglen > (int)sizeof(this->payload)) {
+        // Too long to buffer - drop it and resync
+        this->state = GOT_NONE;
+        this->count = -1;
+      } else if (this->msglen == 0) {
+        this->state = GOT_PAYLOAD;
+      }
     }
 
     else if (this->state == GOT_LENGTH2) {
@@ -378,6 +423,7 @@ public:
 
       if (b == this->chkb) {
         if (debug) Serial.print(" cB");
+        this->state = GOT_NONE;   // a stray byte matching chkb must not dispatch again
         this->dispatchMessage();
         this->count = -1;
       } else {
@@ -28,7 +28,9 @@ ADProcessor::ADProcessor() :
     debounceDelay(50),  // 50ms default debounce
     lastProcessTime(0),
     currentBufferIndex(0),
-    teensyADC(nullptr)
+    teensyADC(nullptr),
+    adc1Busy(false),
+    wasSampleSkips(0)
 {
     // Initialize switch states
     workSwitch = {false, false, 0, false};
@@ -203,7 +205,7 @@ void ADProcessor::process()
         lastCurrentSample = now;
         
         // Read current sensor and store in buffer
-        uint16_t reading = teensyADC->adc1->analogRead(currentPin);
+        uint16_t reading = readADC1(currentPin);
         
         // Simple approach from test sketch - subtract baseline offset
         float adjusted = (float)(reading - 77);  // 77 is our baseline
@@ -230,19 +232,14 @@ void ADProcessor::process()
         
         if (jdPWMMode) {
             // In JD PWM mode, calculate motion value from duty cycle
-            uint32_t now = millis();
-            
             
             // Log JD PWM status periodically
-            static uint32_t lastStatusLog = 0;
-            static uint32_t lastMotionLog = 0;
             static bool wasMoving = false;
             
             // Log basic status every 5 seconds if signal present
-            if (now - lastStatusLog > 5000 && jdPWMPeriod > 0) {
-                LOG_INFO(EventSource::AUTOSTEER, "JD_ENC Status: duty=%dus, avg=%.0fus, delta=%.0fus, pressure=%.0f", 
-                         jdPWMDutyTime, jdPWMRollingAverage, abs(jdPWMDelta), pressureReading);
-                lastStatusLog = now;
+            if (jdPWMPeriod > 0) {
+                LOG_INFO_EVERY(5000, EventSource::AUTOSTEER, "JD_ENC Status: duty=%dus, avg=%.0fus, delta=%.0fus, pressure=%.0f", 
+                               jdPWMDutyTime, jdPWMRollingAverage, abs(jdPWMDelta), pressureReading);
             }
             
             // Log motion events immediately
@@ -258,10 +255,9 @@ void ADProcessor::process()
             }
             
             // Log high motion values
-            if (isMoving && now - lastMotionLog > 1000) {
-                LOG_DEBUG(EventSource::AUTOSTEER, "JD_ENC Moving: duty=%dus, avg=%.0fus, delta=%.0fus, pressure=%.0f", 
-                          jdPWMDutyTime, jdPWMRollingAverage, abs(jdPWMDelta), pressureReading);
-                lastMotionLog = now;
+            if (isMoving) {
+                LOG_DEBUG_EVERY(1000, EventSource::AUTOSTEER, "JD_ENC Moving: duty=%dus, avg=%.0fus, delta=%.0fus, pressure=%.0f", 
+                                jdPWMDutyTime, jdPWMRollingAverage, abs(jdPWMDelta), pressureReading);
             }
             
             // Check if we have valid duty cycle data
@@ -293,39 +289,29 @@ void ADProcessor::process()
                 
                 
                 // Debug logging
-                static uint32_t lastDebugTime = 0;
-                if (millis() - lastDebugTime > 500) {
-                    LOG_DEBUG(EventSource::AUTOSTEER, "JD_PWM: duty=%dus, avg=%.0fus, delta=%.0fus (x5=%.0f)", 
-                              jdPWMDutyTime, jdPWMRollingAverage, jdPWMDelta, sensorReading);
-                    lastDebugTime = millis();
-                }
+                LOG_DEBUG_EVERY(500, EventSource::AUTOSTEER, "JD_PWM: duty=%dus, avg=%.0fus, delta=%.0fus (x5=%.0f)", 
+                                jdPWMDutyTime, jdPWMRollingAverage, jdPWMDelta, sensorReading);
                 
                 // Update pressure reading directly (0-255 range for PGN)
                 pressureReading = sensorReading;
             } else {
                 // Invalid duty cycle
                 if (jdPWMDutyPercent > 0 && (jdPWMDutyPercent < 2.0f || jdPWMDutyPercent > 96.0f)) {
-                    static uint32_t lastInvalidLog = 0;
-                    if (now - lastInvalidLog > 2000) {
-                        LOG_WARNING(EventSource::AUTOSTEER, "JD_ENC Invalid duty: %.1f%% (valid: 2-96%%)", 
-                                    jdPWMDutyPercent);
-                        lastInvalidLog = now;
-                    }
+                    LOG_WARNING_EVERY(2000, EventSource::AUTOSTEER, "JD_ENC Invalid duty: %.1f%% (valid: 2-96%%)", 
+                                      jdPWMDutyPercent);
                 }
                 pressureReading = 0;
             }
         } else {
             // Normal analog pressure sensor mode
+            // Core analogRead() also converts on ADC1 - guard it like readADC1()
+            adc1Busy = true;
             kickoutAnalogRaw = analogRead(kickoutAPin);
+            adc1Busy = false;
             
             // Debug current sensor reading
-            static uint32_t lastCurrentDebug = 0;
-            
-            if (millis() - lastCurrentDebug > 2000) {  // Every 2 seconds
-                lastCurrentDebug = millis();
-                LOG_DEBUG(EventSource::AUTOSTEER, "Current sensor: Averaged reading=%.1f (from %d samples)", 
-                          currentReading, CURRENT_BUFFER_SIZE);
-            }
+            LOG_DEBUG_EVERY(2000, EventSource::AUTOSTEER, "Current sensor: Averaged reading=%.1f (from %d samples)", 
+                            currentReading, CURRENT_BUFFER_SIZE);
             
             // Update pressure sensor reading with filtering
             // Scale 12-bit ADC (0-4095) to match NG-V6 behavior
@@ -343,12 +329,46 @@ void ADProcessor::updateWAS()
 {
     // Read WAS using Teensy ADC library (4 samples averaging)
     // Use ADC1 like the old firmware
-    wasRaw = teensyADC->adc1->analogRead(wasPin);
+    wasRaw = readADC1(wasPin);
     
     // Note: The old firmware applies 3.23x scaling, but in our architecture
     // the calibration (wasOffset and wasCountsPerDegree) handles the scaling
 }
 
+uint16_t ADProcessor::readADC1(uint8_t pin)
+{
+    if (teensyADC == nullptr) {
+        return 0;  // Not initialised yet
+    }
+    adc1Busy = true;
+    asm volatile("" ::: "memory");
+    uint16_t value = teensyADC->adc1->analogRead(pin);
+    asm volatile("" ::: "memory");
+    adc1Busy = false;
+    return value;
+}
+
+bool ADProcessor::sampleWASFromISR()
+{
+    // The ISR runs to completion, so checking the flag once is enough: either
+    // the loop has not started its conversion yet or it is parked inside one
+    if (adc1Busy || teensyADC == nullptr) {
+        wasSampleSkips = wasSampleSkips + 1;
+        return false;
+    }
+    wasRaw = teensyADC->adc1->analogRead(wasPin);
+    return true;
+}
+
+float ADProcessor::wasRawToAngle(int16_t raw, bool invert) const
+{
+    if (wasCountsPerDegree == 0) {
+        return 0.0f;
+    }
+    float angle = (raw - 2048.0f - wasOffset) / wasCountsPerDegree;
+    return invert ? -angle : angle;
+}
+
 void ADProcessor::updateSwitches()
 {
     // Simple digital read - just like old firmware
@@ -357,7 +377,7 @@ void ADProcessor::updateSwitches()
     bool workRaw;
     if (analogWorkSwitchEnabled) {
         // Read analog value
-        workSwitchAnalogRaw = teensyADC->adc1->analogRead(workPin);
+        workSwitchAnalogRaw = readADC1(workPin);
         
         // Convert to percentage (0-100%)
         float currentPercent = getWorkSwitchAnalogPercent();
@@ -377,13 +397,9 @@ void ADProcessor::updateSwitches()
         }
         
         // Debug logging
-        static uint32_t lastAnalogDebug = 0;
-        if (millis() - lastAnalogDebug > 1000) {
-            lastAnalogDebug = millis();
-            LOG_DEBUG(EventSource::AUTOSTEER, "Analog work switch: raw=%d, %.1f%%, SP=%.1f%%, H=%.1f%%, state=%s",
-                      workSwitchAnalogRaw, currentPercent, workSwitchSetpoint, workSwitchHysteresis,
-                      workRaw ? "ON" : "OFF");
-        }
+        LOG_DEBUG_EVERY(1000, EventSource::AUTOSTEER, "Analog work switch: raw=%d, %.1f%%, SP=%.1f%%, H=%.1f%%, state=%s",
+                        workSwitchAnalogRaw, currentPercent, workSwitchSetpoint, workSwitchHysteresis,
+                        workRaw ? "ON" : "OFF");
     } else {
         // Digital mode
         int workPinRaw = digitalRead(workPin);
@@ -454,12 +470,8 @@ float ADProcessor::getWASAngle() const
         }
         
         // Debug logging
-        static uint32_t lastWASDebug = 0;
-        if (millis() - lastWASDebug > 2000) {
-            lastWASDebug = millis();
-            LOG_DEBUG(EventSource::AUTOSTEER, "WAS: raw=%d, centered=%.0f, angle=%.2f°, offset=%d, CPD=%.1f, inverted=%d", 
-                      wasRaw, centeredWAS, angle, wasOffset, wasCountsPerDegree, configManager.getInvertWAS());
-        }
+        LOG_DEBUG_EVERY(2000, EventSource::AUTOSTEER, "WAS: raw=%d, centered=%.0f, angle=%.2f°, offset=%d, CPD=%.1f, inverted=%d", 
+                        wasRaw, centeredWAS, angle, wasOffset, wasCountsPerDegree, configManager.getInvertWAS());
         
         return angle;
     }
@@ -54,6 +54,11 @@ public:
     float getWASAngle() const;
     float getWASVoltage() const;
     
+    // Control lane access (safe from the ControlLane ISR - no logging)
+    bool sampleWASFromISR();                        // false if the loop is using ADC1
+    float wasRawToAngle(int16_t raw, bool invert) const;
+    uint32_t getWASSampleSkips() const { return wasSampleSkips; }
+    
     // Kickout sensor readings
     uint16_t getKickoutAnalog() const { return kickoutAnalogRaw; }
     float getPressureReading() const { return pressureReading; }
@@ -94,6 +99,10 @@ public:
     // Diagnostics
     void printStatus() const;
     
+    // ADC1 conversion for other modules (e.g. PWM driver current sense) -
+    // core analogRead() also uses ADC1 and would race the control lane ISR
+    uint16_t readADC1(uint8_t pin);
+    
     // Static instance for singleton pattern
     static ADProcessor* instance;
     static ADProcessor* getInstance();
@@ -126,7 +135,7 @@ private:
     SwitchState steerSwitch;
     
     // WAS data
-    int16_t wasRaw;
+    volatile int16_t wasRaw;
     int16_t wasOffset;
     float wasCountsPerDegree;
     
@@ -170,6 +179,11 @@ private:
     // Teensy ADC object
     ADC* teensyADC;
     
+    // Set while the loop owns ADC1 so the control lane ISR reuses its last WAS
+    // sample instead of starting a conversion in the middle of ours
+    volatile bool adc1Busy;
+    volatile uint32_t wasSampleSkips;
+    
     // Helper methods
     void updateWAS();
     bool debounceSwitch(SwitchState& sw, bool rawState);
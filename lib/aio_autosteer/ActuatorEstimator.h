@@ -0,0 +1,307 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// ActuatorEstimator.h
+// Online identification of the steering actuator from the drive the
+// controller sends and the wheel angle it produces. Every SAMPLE_PERIOD of
+// engaged steering it averages the drive u (PWM, positive towards negative
+// angles as in SteerController) and measures the wheel rate r in the drive
+// direction, then fits
+//     r[k] = a * r[k-1] + b * u[k] + c * sign(u[k])
+// by recursive least squares with forgetting: a first-order lag with a
+// deadband, so gain = b / (1 - a) deg/s per PWM past the deadband -c / b,
+// and lag = -SAMPLE_PERIOD / ln(a).
+//
+// A sample is only fitted when the steering was engaged for it and the one
+// before, the drive kept one sign, stayed off highPWM and outside the
+// estimated deadband, the wheel was already moving at MIN_RATE, and the drive
+// has been varying (a constant drive can't separate gain from deadband). The
+// covariance is bounded so idle stretches don't wind it up. Confidence is the
+// share of the wheel rate variance the fit explains, scaled down until
+// MIN_UPDATES samples have been fitted.
+//
+// gainsFor() turns an estimate into Kp and minPWM for a speed band: minPWM
+// covers most of the deadband and Kp puts the wheel angle loop's bandwidth
+// at a target that falls with speed, capped below the actuator's lag corner.
+//
+// sample() runs from the control tick (the ControlLane ISR or the loop task);
+// the loop reads the estimate through a sequence counter, as ControlLane
+// publishes its stats. Log-free and allocation-free. Header-only with no
+// Arduino dependencies so host tools can use it.
+
+#ifndef ACTUATOR_ESTIMATOR_H
+#define ACTUATOR_ESTIMATOR_H
+
+#include <stdint.h>
+#include <math.h>
+
+class ActuatorEstimator {
+public:
+    static constexpr float SAMPLE_PERIOD = 0.04f;     // s - 25Hz fit, ~0.7 deg/s WAS quantisation at 30 counts/deg
+    static constexpr float FORGETTING = 0.995f;       // ~8 s of fitted steering
+    static constexpr float EXCITATION_PWM = 5.0f;     // Drive standard deviation needed to fit
+    static constexpr float MIN_RATE = 2.0f;           // deg/s - slower samples are mostly quantisation
+    static constexpr uint16_t MIN_UPDATES = 250;      // Full confidence after 10 s of fitted steering
+    static constexpr float MIN_CONFIDENCE = 0.5f;     // Below this the estimate is not used
+    static constexpr float U_SCALE = 100.0f;          // Keeps the regressors a similar size
+    static constexpr float MAX_COVARIANCE_TRACE = 1000.0f;
+
+    static constexpr uint8_t SPEED_BANDS = 5;
+    static constexpr float BAND_MAX_KMH[SPEED_BANDS] = {4.0f, 8.0f, 12.0f, 18.0f, 1000.0f};
+    static constexpr float BAND_BANDWIDTH[SPEED_BANDS] = {8.0f, 7.0f, 6.0f, 5.0f, 4.0f};  // rad/s
+    static constexpr float LAG_MARGIN = 0.7f;         // Bandwidth limit as a fraction of 1/lag
+    static constexpr float DEADBAND_COVER = 0.9f;     // minPWM as a fraction of the deadband - less chatter
+
+    struct Estimate {
+        float gain;        // Wheel deg/s per PWM past the deadband
+        float deadband;    // PWM
+        float lag;         // s
+        float confidence;  // 0..1
+        uint32_t updates;  // Samples fitted
+        uint32_t skipped;  // Engaged samples without enough excitation
+        bool valid;        // Physically sensible and confident enough to use
+    };
+
+    struct ScheduledGains {
+        float kp;
+        uint8_t minPWM;
+    };
+
+    ActuatorEstimator()
+    {
+        clear();
+        publish();
+    }
+
+    // drive as returned by SteerController::update(), angle = measured wheel
+    // angle (degrees), engaged = steering under normal control this tick
+    void sample(int16_t drive, float angle, float dt, uint8_t highPWM, bool engaged)
+    {
+        if (resetRequested) {
+            resetRequested = false;
+            clear();
+            publish();
+        }
+        if (!engaged || dt <= 0.0f) {
+            haveWindow = false;
+            havePrevious = false;
+            return;
+        }
+        if (!haveWindow) {
+            startWindow(angle);
+            haveWindow = true;
+            return;  // The first tick only sets the starting angle
+        }
+
+        windowTime += dt;
+        windowDrive += drive * dt;
+        if (drive > 0) windowSigns |= 1;
+        if (drive < 0) windowSigns |= 2;
+        if (drive >= highPWM || drive <= -highPWM) windowSaturated = true;
+        if (windowTime < SAMPLE_PERIOD) {
+            return;
+        }
+
+        float u = windowDrive / windowTime;
+        float r = -(angle - windowAngle) / windowTime;
+        bool usable = (windowSigns == 1 || windowSigns == 2) && !windowSaturated;
+        float dtSample = windowTime;
+        startWindow(angle);
+
+        // Drive variation (EMA over ~1 s of samples)
+        driveMean += 0.04f * (u - driveMean);
+        driveVariance += 0.04f * ((u - driveMean) * (u - driveMean) - driveVariance);
+
+        // Inside the deadband the wheel doesn't follow the model, and a
+        // wheel that barely moves measures only WAS quantisation
+        float deadband = theta[1] > 0.0f ? -theta[2] / theta[1] * U_SCALE : 0.0f;
+        usable = usable && fabsf(u) > deadband && fabsf(previousRate) >= MIN_RATE;
+
+        if (havePrevious && usable && driveVariance >= EXCITATION_PWM * EXCITATION_PWM &&
+            fabsf(dtSample - SAMPLE_PERIOD) < 0.5f * SAMPLE_PERIOD) {
+            fit(previousRate, u / U_SCALE, u > 0.0f ? 1.0f : -1.0f, r);
+            publish();
+        } else if (havePrevious) {
+            skipped++;
+        }
+        previousRate = r;
+        havePrevious = true;
+    }
+
+    // Loop side: consistent copy of the latest estimate
+    void getEstimate(Estimate& out) const
+    {
+        uint32_t seq;
+        do {
+            seq = publishSeq;
+            asm volatile("" ::: "memory");
+            out = published;
+            asm volatile("" ::: "memory");
+        } while ((seq & 1) || seq != publishSeq);
+    }
+
+    // Loop side, before sampling starts: continue from a saved estimate
+    void seed(float gain, float deadband, float lag, float confidence)
+    {
+        if (gain <= 0.0f || lag <= 0.0f || confidence <= 0.0f) {
+            return;
+        }
+        clear();
+        float a = expf(-SAMPLE_PERIOD / lag);
+        float b = gain * (1.0f - a);
+        theta[0] = a;
+        theta[1] = b * U_SCALE;
+        theta[2] = -b * deadband;
+        for (int i = 0; i < 3; i++) P[i][i] *= 0.1f;
+        fitQuality = confidence;
+        updates = MIN_UPDATES;
+        publish();
+    }
+
+    void requestReset() { resetRequested = true; }  // Applied by the next sample()
+
+    static uint8_t speedBand(float speedKmh)
+    {
+        uint8_t band = 0;
+        while (band < SPEED_BANDS - 1 && speedKmh > BAND_MAX_KMH[band]) band++;
+        return band;
+    }
+
+    static ScheduledGains gainsFor(const Estimate& estimate, uint8_t band)
+    {
+        float bandwidth = BAND_BANDWIDTH[band];
+        float limit = LAG_MARGIN / estimate.lag;
+        if (bandwidth > limit) bandwidth = limit;
+        // Angle loop: d(angle)/dt = -gain * Kp * error, so bandwidth = gain * Kp
+        float kp = bandwidth / estimate.gain;
+        if (kp < 1.0f) kp = 1.0f;
+        if (kp > 255.0f) kp = 255.0f;
+        float minPWM = estimate.deadband * DEADBAND_COVER;
+        if (minPWM > 200.0f) minPWM = 200.0f;
+        return ScheduledGains{kp, (uint8_t)minPWM};
+    }
+
+private:
+    // RLS state: theta = [a, b * U_SCALE, c], phi = [r[k-1], u / U_SCALE, sign(u)]
+    float theta[3];
+    float P[3][3];
+    float fitQuality;      // 1 - error variance / rate variance
+    float errorVariance;
+    float rateMean;
+    float rateVariance;
+    uint32_t updates;
+    uint32_t skipped;
+
+    // Sample window
+    bool haveWindow;
+    float windowAngle;
+    float windowTime;
+    float windowDrive;
+    uint8_t windowSigns;
+    bool windowSaturated;
+    bool havePrevious;
+    float previousRate;
+    float driveMean;
+    float driveVariance;
+
+    volatile bool resetRequested = false;
+    Estimate published;
+    volatile uint32_t publishSeq = 0;
+
+    void clear()
+    {
+        theta[0] = 0.5f;    // 58 ms lag
+        theta[1] = 5.0f;    // 0.1 deg/s per PWM
+        theta[2] = -1.5f;   // 30 PWM deadband
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) P[i][j] = (i == j) ? 100.0f : 0.0f;
+        }
+        fitQuality = 0.0f;
+        errorVariance = 0.0f;
+        rateMean = 0.0f;
+        rateVariance = 0.0f;
+        updates = 0;
+        skipped = 0;
+        haveWindow = false;
+        havePrevious = false;
+        previousRate = 0.0f;
+        driveMean = 0.0f;
+        driveVariance = 0.0f;
+    }
+
+    void startWindow(float angle)
+    {
+        windowAngle = angle;
+        windowTime = 0.0f;
+        windowDrive = 0.0f;
+        windowSigns = 0;
+        windowSaturated = false;
+    }
+
+    void fit(float r1, float u, float s, float y)
+    {
+        const float phi[3] = {r1, u, s};
+        float Pphi[3];
+        float denom = FORGETTING;
+        for (int i = 0; i < 3; i++) {
+            Pphi[i] = P[i][0] * phi[0] + P[i][1] * phi[1] + P[i][2] * phi[2];
+            denom += phi[i] * Pphi[i];
+        }
+        float error = y - (theta[0] * phi[0] + theta[1] * phi[1] + theta[2] * phi[2]);
+        for (int i = 0; i < 3; i++) {
+            theta[i] += Pphi[i] / denom * error;
+        }
+
+        // P = (P - P phi phi' P / denom) / lambda, forgetting only while P is bounded
+        float trace = 0.0f;
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) P[i][j] -= Pphi[i] * Pphi[j] / denom;
+            trace += P[i][i];
+        }
+        if (trace < MAX_COVARIANCE_TRACE) {
+            for (int i = 0; i < 3; i++) {
+                for (int j = 0; j < 3; j++) P[i][j] /= FORGETTING;
+            }
+        }
+
+        // Fit quality from the a priori error against the rate's own variance
+        rateMean += 0.02f * (y - rateMean);
+        rateVariance += 0.02f * ((y - rateMean) * (y - rateMean) - rateVariance);
+        errorVariance += 0.02f * (error * error - errorVariance);
+        if (rateVariance > 0.0f) {
+            float quality = 1.0f - errorVariance / rateVariance;
+            fitQuality = quality < 0.0f ? 0.0f : (quality > 1.0f ? 1.0f : quality);
+        }
+        updates++;
+    }
+
+    void publish()
+    {
+        Estimate e;
+        // An actuator faster than SAMPLE_PERIOD fits a close to 0: report the
+        // lag as a fraction of the period rather than reject it
+        float a = theta[0] < 0.01f ? 0.01f : theta[0];
+        float b = theta[1] / U_SCALE;
+        bool physical = theta[0] > -0.2f && a < 0.98f && b > 0.0f;
+        e.gain = physical ? b / (1.0f - a) : 0.0f;
+        e.deadband = physical ? -theta[2] / b : 0.0f;
+        if (e.deadband < 0.0f) e.deadband = 0.0f;
+        e.lag = physical ? -SAMPLE_PERIOD / logf(a) : 0.0f;
+        float ramp = updates >= MIN_UPDATES ? 1.0f : (float)updates / MIN_UPDATES;
+        e.confidence = physical ? fitQuality * ramp : 0.0f;
+        e.updates = updates;
+        e.skipped = skipped;
+        e.valid = physical && e.gain > 0.005f && e.deadband < 200.0f && e.confidence >= MIN_CONFIDENCE;
+
+        publishSeq = publishSeq + 1;
+        asm volatile("" ::: "memory");
+        published = e;
+        asm volatile("" ::: "memory");
+        publishSeq = publishSeq + 1;
+    }
+};
+
+#endif // ACTUATOR_ESTIMATOR_H
@@ -15,11 +15,14 @@
 #include "LEDManagerFSM.h"
 #include "EventLogger.h"
 #include "QNetworkBase.h"
+#include "QNEthernetUDPHandler.h"
 #include "HardwareManager.h"
 #include "WheelAngleFusion.h"
 #include "MotorDriverManager.h"
 #include "KickoutMonitor.h"
 #include "MessageBuilder.h"
+#include "ControlLane.h"
+#include "LatencyTrace.h"
 #include <cmath>  // For sin() function
 
 // External network function
@@ -118,6 +121,18 @@ bool AutosteerProcessor::init() {
     
     // Load steer settings from EEPROM
     configManager.loadSteerSettings();
+    
+    // Continue identifying the actuator from the last saved estimate
+    estimator.seed(configManager.getActuatorGain(), configManager.getActuatorDeadband(),
+                   configManager.getActuatorLag(), configManager.getActuatorConfidence());
+    ActuatorEstimator::Estimate seeded;
+    estimator.getEstimate(seeded);
+    savedEstimateUpdates = seeded.updates;
+    if (seeded.valid) {
+        LOG_INFO(EventSource::AUTOSTEER, "Actuator estimate: gain=%.3f deg/s/PWM, deadband=%.0f PWM, lag=%.0fms (%s)",
+                 seeded.gain, seeded.deadband, seeded.lag * 1000.0f,
+                 configManager.getSteerAutoGains() ? "auto gains" : "auto gains off");
+    }
 
     // Update ADProcessor with loaded values
     adProcessor.setWASOffset(configManager.getWasOffset());
@@ -165,6 +180,9 @@ bool AutosteerProcessor::init() {
         LOG_ERROR(EventSource::AUTOSTEER, "Failed to initialize KickoutMonitor");
     }
     
+    // Move sense -> control -> actuate onto the hardware timer if configured
+    startControlLane();
+    
     LOG_INFO(EventSource::AUTOSTEER, "AutosteerProcessor initialized successfully");
     initialized = true;  // Mark as initialized to prevent duplicate PGN registrations
     return true;
@@ -199,6 +217,7 @@ void AutosteerProcessor::initializeFusion() {
     } else {
         LOG_ERROR(EventSource::AUTOSTEER, "Failed to initialize Virtual WAS");
         configManager.setINSUseFusion(false);  // Disable VWAS
+        configManager.publishControlConfig();
         delete wheelAngleFusionPtr;
         wheelAngleFusionPtr = nullptr;
     }
@@ -207,6 +226,9 @@ void AutosteerProcessor::initializeFusion() {
 void AutosteerProcessor::process() {
     // === 100Hz AUTOSTEER LOOP (called by SimpleScheduler) ===
     
+    // One settings snapshot for the whole tick
+    const ControlConfig* config = configManager.getControlConfig();
+    
     // Track link state for down detection
     static bool previousLinkState = true;
     bool currentLinkState = QNetworkBase::isConnected();
@@ -218,9 +240,22 @@ void AutosteerProcessor::process() {
     }
     previousLinkState = currentLinkState;
     
+    // Measure the real period - the scheduler releases this task every 10ms,
+    // but it can run late when the loop is busy
+    uint32_t nowMicros = micros();
+    float dt = (lastProcessMicros != 0) ? (nowMicros - lastProcessMicros) / 1000000.0f : 0.01f;
+    lastProcessMicros = nowMicros;
+    dt = constrain(dt, 0.001f, 0.1f);
+    controlDt = dt;
+    
+    // Keya heartbeat -> the control tick that first sees it
+    if (motorPTR && motorPTR->getType() == MotorDriverType::TRACTOR_CAN) {
+        uint32_t heartbeatTrace = static_cast<TractorCANDriver*>(motorPTR)->takeHeartbeatTrace();
+        LatencyTrace::getInstance()->record(LatencyTrace::CAN_TO_CONTROL, heartbeatTrace);
+    }
+    
     // Update Virtual WAS if enabled
-    if (wheelAngleFusionPtr && configManager.getINSUseFusion()) {
-        float dt = 10.0f / 1000.0f;  // 10ms = 0.01 seconds (100Hz from SimpleScheduler)
+    if (wheelAngleFusionPtr && config->insUseFusion) {
         wheelAngleFusionPtr->update(dt);
     }
     
@@ -234,16 +269,15 @@ void AutosteerProcessor::process() {
     static bool lastJcbEngageState = false;
     static bool lastLindnerEngageState = false;
 
-    // Debug: log button/switch config periodically
-    static uint32_t lastConfigLog = 0;
-    if (millis() - lastConfigLog > 5000) {
-        lastConfigLog = millis();
-        LOG_DEBUG(EventSource::AUTOSTEER, "Button config: button=%d, switch=%d",
-                  configManager.getSteerButton(), configManager.getSteerSwitch());
+    // Log the steer inputs whenever a new settings snapshot arrives
+    if (config->version != inputsConfigVersion) {
+        inputsConfigVersion = config->version;
+        LOG_INFO(EventSource::AUTOSTEER, "Steer inputs: button=%d, switch=%d, pressure sensor kickout %s",
+                 config->steerButton, config->steerSwitch, config->pressureSensor ? "ENABLED" : "DISABLED");
     }
 
-    if (configManager.getSteerButton() || configManager.getSteerSwitch()) {
-        if (configManager.getSteerButton()) {
+    if (config->steerButton || config->steerSwitch) {
+        if (config->steerButton) {
             // BUTTON MODE - Toggle on press
             static bool lastButtonReading = HIGH;
             bool buttonReading = adProcessor.isSteerSwitchOn() ? LOW : HIGH;  // Convert to active low
@@ -492,8 +526,8 @@ void AutosteerProcessor::process() {
     // If AgOpenGPS has stopped steering, turn off after delay
     // BUT only if not using a physical switch in switch mode OR button mode
     static int switchCounter = 0;
-    bool physicalSwitchActive = configManager.getSteerSwitch() && adProcessor.isSteerSwitchOn();
-    bool buttonModeActive = configManager.getSteerButton();
+    bool physicalSwitchActive = config->steerSwitch && adProcessor.isSteerSwitchOn();
+    bool buttonModeActive = config->steerButton;
 
     if (steerState == 0 && !guidanceActive && !physicalSwitchActive && !buttonModeActive) {
         if (switchCounter++ > 30) {  // 30 * 10ms = 300ms delay
@@ -515,13 +549,6 @@ void AutosteerProcessor::process() {
     }
     
     // Pressure sensor kickout is now handled by KickoutMonitor
-    static bool lastPressureSensorState = false;
-    bool currentPressureSensorState = configManager.getPressureSensor();
-    if (currentPressureSensorState != lastPressureSensorState) {
-        LOG_INFO(EventSource::AUTOSTEER, "Pressure sensor kickout %s", 
-                 currentPressureSensorState ? "ENABLED" : "DISABLED");
-        lastPressureSensorState = currentPressureSensorState;
-    }
     
     // Check motor status for errors (including CAN connection loss)
     if (motorPTR) {
@@ -616,32 +643,39 @@ void AutosteerProcessor::process() {
     }
     
     // Always update current angle reading (needed for PGN253 even when autosteer is off)
-    // Get current steering angle - use VWAS if enabled and available
-    if (configManager.getINSUseFusion() && wheelAngleFusionPtr && wheelAngleFusionPtr->isHealthy()) {
-        currentAngle = wheelAngleFusionPtr->getFusedAngle();
-    } else {
-        // Fall back to physical WAS
-        currentAngle = adProcessor.getWASAngle();
-    }
-    
-    // Apply Ackerman fix to current angle if it's negative (left turn)
-    actualAngle = currentAngle;
-    if (actualAngle < 0) {
-        float ackermanFix = configManager.getAckermanFix();
-        actualAngle = actualAngle * ackermanFix;
+    // With the control lane running, the timer ISR samples the WAS and owns these values
+    if (!controlLaneActive) {
+        // Get current steering angle - use VWAS if enabled and available
+        if (config->insUseFusion && wheelAngleFusionPtr && wheelAngleFusionPtr->isHealthy()) {
+            currentAngle = wheelAngleFusionPtr->getFusedAngle();
+        } else {
+            // Fall back to physical WAS
+            currentAngle = adProcessor.getWASAngle();
+        }
         
-        // Log Ackerman fix application periodically
-        static uint32_t lastAckermanLog = 0;
-        if (millis() - lastAckermanLog > 5000 && abs(actualAngle) > 1.0f) {
-            lastAckermanLog = millis();
-            LOG_DEBUG(EventSource::AUTOSTEER, "Ackerman fix applied: %.2f° * %.2f = %.2f°", 
-                     currentAngle, ackermanFix, actualAngle);
+        // Apply Ackerman fix to current angle if it's negative (left turn)
+        actualAngle = currentAngle;
+        if (actualAngle < 0) {
+            float ackermanFix = config->ackermanFix;
+            actualAngle = actualAngle * ackermanFix;
+            
+            // Log Ackerman fix application periodically
+            if (abs(actualAngle) > 1.0f) {
+                LOG_DEBUG_EVERY(5000, EventSource::AUTOSTEER, "Ackerman fix applied: %.2f° * %.2f = %.2f°", 
+                                (float)currentAngle, ackermanFix, (float)actualAngle);
+            }
         }
     }
     
     // Update motor control
     updateMotorControl();
     
+    // The control lane samples the actuator itself
+    if (!controlLaneActive) {
+        estimator.sample(loopDrive, currentAngle, controlDt, config->highPWM,
+                         motorState != MotorState::DISABLED);
+    }
+    
     // Note: LOCK output is handled by motor driver enable pin (dual-purpose)
     
     // Send PGN 253 status to AgOpenGPS
@@ -994,6 +1028,9 @@ void AutosteerProcessor::handleSteerSettings(uint8_t pgn, const uint8_t* data, s
 
     // Log confirmation that settings are now active
     LOG_INFO(EventSource::AUTOSTEER, "Settings now active - no reboot required. Motor will use new PWM values immediately.");
+    
+    // Hand the new gains to the control lane right away
+    refreshLaneSetpoint();
 }
 
 void AutosteerProcessor::handleSteerData(uint8_t pgn, const uint8_t* data, size_t len) {
@@ -1005,6 +1042,10 @@ void AutosteerProcessor::handleSteerData(uint8_t pgn, const uint8_t* data, size_
         return;  // Too short, ignore
     }
     
+    if (PGNProcessor::instance) {
+        steerDataTraceCycles = PGNProcessor::instance->getRxTraceCycles();
+    }
+    
     // Check if we're recovering from a link down event
     static uint32_t linkUpTime = 0;
     static bool waitingForStableLink = false;
@@ -1044,11 +1085,9 @@ void AutosteerProcessor::handleSteerData(uint8_t pgn, const uint8_t* data, size_
     bool newAutosteerState = (status & 0x40) != 0;  // Bit 6 is autosteer enable
     
     // Debug OSB behavior - log every second during kickout
-    static uint32_t lastStatusLog = 0;
-    if (kickoutMonitor && kickoutMonitor->hasKickout() && millis() - lastStatusLog > 1000) {
-        lastStatusLog = millis();
-        LOG_DEBUG(EventSource::AUTOSTEER, "During kickout - PGN254 status: 0x%02X (guidance=%d, autosteer=%d), steerState=%d",
-                 status, (status & 0x01) != 0, (status & 0x40) != 0, steerState);
+    if (kickoutMonitor && kickoutMonitor->hasKickout()) {
+        LOG_DEBUG_EVERY(1000, EventSource::AUTOSTEER, "During kickout - PGN254 status: 0x%02X (guidance=%d, autosteer=%d), steerState=%d",
+                        status, (status & 0x01) != 0, (status & 0x40) != 0, steerState);
     }
     
     // Also log any status changes
@@ -1079,6 +1118,7 @@ void AutosteerProcessor::handleSteerData(uint8_t pgn, const uint8_t* data, size_
     // Extract steer angle
     int16_t angleRaw = (int16_t)(data[4] << 8 | data[3]);
     targetAngle = angleRaw / 100.0f;
+    updateTargetRate();
     
     // Debug log for AgIO test mode
     if (targetAngle != 0.0f || autosteerEnabled) {
@@ -1125,6 +1165,19 @@ void AutosteerProcessor::handleSteerData(uint8_t pgn, const uint8_t* data, size_
         prevAutosteerEnabled = newAutosteerState;
     }
     autosteerEnabled = newAutosteerState;
+    
+    // Hand the new target angle to the control lane right away
+    refreshLaneSetpoint();
+    if (controlLaneActive && laneSetpoints[laneSetpointIndex].active) {
+        traceSteerCommand();
+    }
+}
+
+void AutosteerProcessor::traceSteerCommand() {
+    // In control lane mode this is the setpoint handover; the ISR applies it
+    // on its next tick, at most one lane period later
+    LatencyTrace::getInstance()->record(LatencyTrace::PGN254_TO_MOTOR, steerDataTraceCycles);
+    steerDataTraceCycles = 0;
 }
 
 // Static callback wrapper
@@ -1182,35 +1235,22 @@ void AutosteerProcessor::sendPGN253() {
     switchByte |= (steerState << 1);  // Steer state in bit 1
     switchByte |= !adProcessor.isWorkSwitchOn();  // Work switch state (inverted) in bit 0
     
-    uint8_t pgn253[] = {
-        0x80, 0x81,                    // Header
-        0x7E,                          // Source: Steer module (126)
-        0xFD,                          // PGN: 253
-        8,                             // Length
-        (uint8_t)(actualSteerAngle & 0xFF),      // Steer angle low
-        (uint8_t)(actualSteerAngle >> 8),        // Steer angle high
-        (uint8_t)(heading & 0xFF),                // Heading low
-        (uint8_t)(heading >> 8),                  // Heading high
-        (uint8_t)(roll & 0xFF),                   // Roll low
-        (uint8_t)(roll >> 8),                     // Roll high
-        switchByte,                               // Switch byte
-        pwmDisplay,                               // PWM display
-        0                                         // CRC placeholder
-    };
-    
-    // Calculate CRC
-    uint8_t crc = 0;
-    for (int i = 2; i < sizeof(pgn253) - 1; i++) {
-        crc += pgn253[i];
-    }
-    pgn253[sizeof(pgn253) - 1] = crc;
-    
-    // Send via UDP
-    sendUDPbytes(pgn253, sizeof(pgn253));
+    // Built in its transmit slot; the header and checksum come from the queue
+    uint8_t* pgn253 = QNEthernetUDPHandler::beginPGN(0x7E, 0xFD, 8);  // Steer module, PGN 253
+    pgn253[0] = (uint8_t)(actualSteerAngle & 0xFF);  // Steer angle low
+    pgn253[1] = (uint8_t)(actualSteerAngle >> 8);    // Steer angle high
+    pgn253[2] = (uint8_t)(heading & 0xFF);           // Heading low
+    pgn253[3] = (uint8_t)(heading >> 8);             // Heading high
+    pgn253[4] = (uint8_t)(roll & 0xFF);              // Roll low
+    pgn253[5] = (uint8_t)(roll >> 8);                // Roll high
+    pgn253[6] = switchByte;                          // Switch byte
+    pgn253[7] = pwmDisplay;                          // PWM display
+    QNEthernetUDPHandler::commitPGN();
 }
 
 void AutosteerProcessor::updateMotorControl() {
     // Current angle is now updated in process() before this function is called
+    const ControlConfig* config = configManager.getControlConfig();
     
     // Check if steering should be active
     bool shouldBeActive = shouldSteerBeActive();
@@ -1218,19 +1258,28 @@ void AutosteerProcessor::updateMotorControl() {
     // Handle state transitions
     if (shouldBeActive && motorState == MotorState::DISABLED) {
         // Transition: Start soft-start sequence
-        motorState = MotorState::SOFT_START;
         softStartBeginTime = millis();
         softStartRampValue = 0.0f;
-        LOG_INFO(EventSource::AUTOSTEER, "Motor STARTING - soft-start sequence (%dms)",
-                 softStartDurationMs);
+        motorState = MotorState::SOFT_START;
+        loggedMotorState = MotorState::SOFT_START;
+        // The control lane resets its own controller while it is inactive
+        if (!controlLaneActive) {
+            controller.reset();
+        }
+        LOG_INFO(EventSource::AUTOSTEER, "Motor STARTING - soft-start sequence (%dms, %s control)",
+                 softStartDurationMs, SteerController::modeName(config->steerControlMode));
         // Update LED immediately
         ledManagerFSM.transitionSteerState(LEDManagerFSM::STEER_ENGAGED);
         LOG_INFO(EventSource::AUTOSTEER, "LED -> GREEN (motor starting)");
     } 
     else if (!shouldBeActive && motorState != MotorState::DISABLED) {
         // Transition: Disable motor
+        // Stop the control lane from driving the motor before we disable it
+        publishLaneSetpoint(false);
         motorState = MotorState::DISABLED;
+        loggedMotorState = MotorState::DISABLED;
         motorPWM = 0;
+        loopDrive = 0;
         if (motorPTR) {
             motorPTR->enable(false);
             motorPTR->setPWM(0);
@@ -1263,6 +1312,7 @@ void AutosteerProcessor::updateMotorControl() {
         } else {
             LOG_INFO(EventSource::AUTOSTEER, "Motor disabled");
         }
+        saveActuatorEstimate();
         return;
     }
     else if (!shouldBeActive) {
@@ -1272,193 +1322,325 @@ void AutosteerProcessor::updateMotorControl() {
     
     // Ackerman fix is now applied in process() before this function is called
     
-    // Calculate angle error
-    float angleError = actualAngle - targetAngle;
-    float errorAbs = abs(angleError);
-    
-    // Get PWM settings from ConfigManager (cached for performance)
-    uint8_t kp = configManager.getKp();
-    uint8_t highPWM = configManager.getHighPWM();
-    uint8_t minPWM = configManager.getMinPWM();
-
-    // Debug log to verify settings are being read
-    static uint32_t lastSettingsVerifyLog = 0;
-    static uint8_t lastKp = 0;
-    static uint8_t lastHighPWM = 0;
-    if (millis() - lastSettingsVerifyLog > 5000 || kp != lastKp || highPWM != lastHighPWM) {
-        lastSettingsVerifyLog = millis();
-        lastKp = kp;
-        lastHighPWM = highPWM;
-        LOG_INFO(EventSource::AUTOSTEER, "Active PWM settings: Kp=%d, highPWM=%d, minPWM=%d", kp, highPWM, minPWM);
-    }
-    
-    // Calculate base PWM output (error * Kp)
-    int16_t pValue = kp * angleError;
-    
-    // Apply PWM calculation similar to V6
-    if (highPWM > 0) {  // Check if we have valid settings
-        // Start with base P value
-        int16_t pwmDrive = pValue;
-        
-        // Add min throttle factor so no delay from motor resistance
-        if (pwmDrive < 0) {
-            pwmDrive -= minPWM;
-        } else if (pwmDrive > 0) {
-            pwmDrive += minPWM;
-        } else {
-            // Dead zone - set pwmDrive to 0
-            pwmDrive = 0;
-        }
-        
-        // Limit the PWM drive to highPWM setting
-        if (pwmDrive > highPWM) {
-            pwmDrive = highPWM;
-        } else if (pwmDrive < -highPWM) {
-            pwmDrive = -highPWM;
-        }
-
-        // Check for hard acceleration - soften if needed
-        uint8_t accelThreshold = (uint8_t)((highPWM - minPWM) * ACCEL_THRESHOLD_RATIO);
-        if ((abs(pwmDrive) > (highPWM - accelThreshold)) &&
-            (abs(motorPWM) < (minPWM + accelThreshold)) &&
-            (motorState == MotorState::NORMAL_CONTROL)) {
-            motorState = MotorState::SOFT_ACCEL;
-            softStartBeginTime = millis();
-            LOG_DEBUG(EventSource::AUTOSTEER, "Hard acceleration detected - entering soft accel mode");
-        }
-
-        // Check for direction change - if so, enter soft-start again
-        if (((motorPWM > 0 && pwmDrive < 0) || (motorPWM < 0 && pwmDrive > 0)) &&
-            (abs(pwmDrive) > (minPWM + DIRECTION_CHANGE_THRESHOLD)) &&
-            (motorState == MotorState::NORMAL_CONTROL)) {
-            motorState = MotorState::SOFT_START;
-            softStartBeginTime = millis();
-            LOG_DEBUG(EventSource::AUTOSTEER, "Direction change detected - entering soft start mode");
+    // PWM settings from the snapshot, Kp/minPWM possibly scheduled by speed
+    SteerController::Gains gains = loadGains(config);
+    uint8_t highPWM = config->highPWM;
+    uint8_t minPWM = config->minPWM;
+    applyScheduledGains(config, gains, minPWM);
+
+    // Log the settings in use whenever a new snapshot arrives
+    if (config->version != gainsConfigVersion) {
+        gainsConfigVersion = config->version;
+        LOG_INFO(EventSource::AUTOSTEER, "Active PWM settings: %s Kp=%d Ki=%.1f Kd=%.2f Kff=%.2f, highPWM=%d, minPWM=%d",
+                 SteerController::modeName(gains.mode), (uint8_t)gains.kp, gains.ki, gains.kd, gains.kff, highPWM, minPWM);
+    }
+    
+    if (highPWM == 0) {
+        // No valid PWM config
+        LOG_ERROR(EventSource::AUTOSTEER, "Invalid PWM configuration");
+    }
+    
+    if (controlLaneActive) {
+        // The control lane ISR computes and sends the PWM; the loop only keeps
+        // the driver enabled (enable() may log) and hands over a fresh setpoint
+        if (motorPTR) {
+            motorPTR->enable(true);
         }
-
-        // Store final PWM value
-        motorPWM = pwmDrive;
+        publishLaneSetpoint(true);
+        traceSteerCommand();
+    } else {
+        // Calculate PWM from the angle error, then apply motor direction from config
+        float actual = actualAngle;
+        int16_t pwmDrive = computeMotorPWM(actual, targetAngle, targetRate, controlDt, gains, highPWM, minPWM);
+        motorPWM = config->motorDriveDirection ? -pwmDrive : pwmDrive;
+        loopDrive = pwmDrive;
         
         // Log the PWM calculation periodically
-        static uint32_t lastPWMCalcLog = 0;
-        if (millis() - lastPWMCalcLog > 5000) {  // Every 5 seconds
-            lastPWMCalcLog = millis();
-            LOG_DEBUG(EventSource::AUTOSTEER, "PWM calc: actual=%.1f° - target=%.1f° = error=%.1f° * Kp=%d = %d, +minPWM=%d, limit=%d, final=%d", 
-                     actualAngle, targetAngle, angleError, kp, pValue, minPWM, highPWM, pwmDrive);
-        }
+        LOG_DEBUG_EVERY(5000, EventSource::AUTOSTEER, "PWM calc: actual=%.1f° - target=%.1f° = error=%.1f°, %s I=%.1f, target rate=%.1f°/s, minPWM=%d, limit=%d, final=%d", 
+                        actual, targetAngle, actual - targetAngle, SteerController::modeName(gains.mode),
+                        controller.getIntegral(), targetRate, minPWM, highPWM, pwmDrive);
         
-        // Debug log final motor PWM periodically
-        static uint32_t lastMotorPWMLog = 0;
-        if (millis() - lastMotorPWMLog > 1000 && abs(motorPWM) > 10) {
-            lastMotorPWMLog = millis();
-            LOG_DEBUG(EventSource::AUTOSTEER, "Motor PWM: %d (highPWM=%d)", 
-                      motorPWM, highPWM);
+        // Send to motor
+        if (motorPTR && motorState != MotorState::DISABLED) {
+            motorPTR->enable(true);
+            motorPTR->setPWM(motorPWM);
+            traceSteerCommand();
+            
+            // Debug log to confirm PWM is being sent
+            LOG_DEBUG_EVERY(1000, EventSource::AUTOSTEER, "Sending to motor: PWM=%d, State=%d", 
+                            (int16_t)motorPWM, (int)motorState);
         }
+    }
+    
+    // Report soft-start/soft-accel transitions made by computeMotorPWM()
+    logMotorStateChange();
+    
+    // Debug log final motor PWM periodically
+    if (abs(motorPWM) > 10) {
+        LOG_DEBUG_EVERY(1000, EventSource::AUTOSTEER, "Motor PWM: %d (highPWM=%d)", 
+                        (int16_t)motorPWM, highPWM);
+    }
+    
+    // Final PWM limit check - ensure we never exceed highPWM setting
+    // Log current settings for debugging (DEBUG level to avoid spam)
+    // Note: PWM settings now come from the ControlConfig snapshot
+    LOG_DEBUG_EVERY(30000, EventSource::AUTOSTEER, "PWM Settings: highPWM=%d, lowPWM=%.0f, minPWM=%d", 
+                    config->highPWM, config->lowPWM, config->minPWM);
+    
+    // LOCK output control
+    // For PWM motors, pin 4 is controlled by the motor driver
+    // For Keya/CAN motors, we need to control pin 4 directly
+    if (motorPTR && motorPTR->getType() == MotorDriverType::KEYA_CAN) {
+        // Directly control LOCK output for Keya motor
+        digitalWrite(4, HIGH);  // SLEEP_PIN = 4, HIGH = LOCK ON
         
-        // Apply soft ramp if active (soft-start or soft-accel)
-        if (motorState == MotorState::SOFT_START || motorState == MotorState::SOFT_ACCEL) {
-            uint32_t elapsed = millis() - softStartBeginTime;
-            uint16_t durationMs = (motorState == MotorState::SOFT_START) ?
-                                  softStartDurationMs : softAccelDurationMs;
-            const char* modeName = (motorState == MotorState::SOFT_START) ?
-                                  "Soft-start" : "Soft-accel";
-
-            if (elapsed >= durationMs) {
-                // Ramp complete, transition to normal
-                motorState = MotorState::NORMAL_CONTROL;
-                LOG_INFO(EventSource::AUTOSTEER, "%s complete - normal steering control", modeName);
-            } else {
-                // Calculate ramp progress (0.0 to 1.0)
-                float rampProgress = (float)elapsed / (float)durationMs;
-
-                // Apply ramp function based on configuration
-                float rampValue;
-                if (useSineRamp) {
-                    // Use sine curve for smooth acceleration (slow-fast-slow)
-                    rampValue = sin(rampProgress * PI / 2.0f);
-                } else {
-                    // Use linear ramp
-                    rampValue = rampProgress;
-                }
+        static bool lockLogged = false;
+        if (motorState == MotorState::NORMAL_CONTROL && !lockLogged) {
+            LOG_INFO(EventSource::AUTOSTEER, "LOCK output: ACTIVE (pin 4 HIGH for Keya motor)");
+            lockLogged = true;
+        } else if (motorState == MotorState::DISABLED) {
+            lockLogged = false;
+        }
+    }
+    
+}
+
+int16_t AutosteerProcessor::computeMotorPWM(float actual, float target, float rate, float dt,
+                                            const SteerController::Gains& gains, uint8_t highPWM, uint8_t minPWM) {
+    // No logging in here - this also runs from the control lane ISR
+    if (highPWM == 0) {
+        return 0;  // No valid PWM config
+    }
+    
+    // Controller output with minPWM added and limited to highPWM. The integral
+    // holds while a soft ramp scales the output down.
+    int16_t pwmDrive = controller.update(gains, actual - target, actual, rate, dt, highPWM, minPWM,
+                                         motorState == MotorState::NORMAL_CONTROL);
+
+    // Check for hard acceleration - soften if needed
+    int16_t lastPWM = motorPWM;
+    uint8_t accelThreshold = (uint8_t)((highPWM - minPWM) * ACCEL_THRESHOLD_RATIO);
+    if ((abs(pwmDrive) > (highPWM - accelThreshold)) &&
+        (abs(lastPWM) < (minPWM + accelThreshold)) &&
+        (motorState == MotorState::NORMAL_CONTROL)) {
+        softStartBeginTime = millis();
+        motorState = MotorState::SOFT_ACCEL;
+    }
 
-                // Apply ramp to motor PWM
-                int16_t originalPWM = motorPWM;
-                motorPWM = (int16_t)((float)motorPWM * rampValue);
+    // Check for direction change - if so, enter soft-start again
+    if (((lastPWM > 0 && pwmDrive < 0) || (lastPWM < 0 && pwmDrive > 0)) &&
+        (abs(pwmDrive) > (minPWM + DIRECTION_CHANGE_THRESHOLD)) &&
+        (motorState == MotorState::NORMAL_CONTROL)) {
+        softStartBeginTime = millis();
+        motorState = MotorState::SOFT_START;
+    }
 
-                // Enforce minimum PWM threshold if motor should be moving
-                if (originalPWM != 0 && abs(motorPWM) < minPWM) {
-                    motorPWM = (originalPWM > 0) ? minPWM : -minPWM;
-                }
+    // Apply soft ramp if active (soft-start or soft-accel)
+    if (motorState == MotorState::SOFT_START || motorState == MotorState::SOFT_ACCEL) {
+        uint32_t elapsed = millis() - softStartBeginTime;
+        uint16_t durationMs = (motorState == MotorState::SOFT_START) ?
+                              softStartDurationMs : softAccelDurationMs;
 
-                softStartRampValue = rampValue;
+        if (elapsed >= durationMs) {
+            // Ramp complete, transition to normal
+            motorState = MotorState::NORMAL_CONTROL;
+        } else {
+            // Calculate ramp progress (0.0 to 1.0)
+            float rampProgress = (float)elapsed / (float)durationMs;
+
+            // Apply ramp function based on configuration
+            float rampValue;
+            if (useSineRamp) {
+                // Use sine curve for smooth acceleration (slow-fast-slow)
+                rampValue = sin(rampProgress * PI / 2.0f);
+            } else {
+                // Use linear ramp
+                rampValue = rampProgress;
+            }
 
-                // Debug logging every 50ms during ramp
-                static uint32_t lastRampDebug = 0;
-                if (millis() - lastRampDebug > 50) {
-                    lastRampDebug = millis();
-                    LOG_DEBUG(EventSource::AUTOSTEER, "%s: elapsed=%dms, progress=%.2f, ramp=%.2f, pwm=%d->%d",
-                              modeName, elapsed, rampProgress, rampValue, originalPWM, motorPWM);
-                }
+            // Apply ramp to motor PWM
+            int16_t originalPWM = pwmDrive;
+            pwmDrive = (int16_t)((float)pwmDrive * rampValue);
+
+            // Enforce minimum PWM threshold if motor should be moving
+            if (originalPWM != 0 && abs(pwmDrive) < minPWM) {
+                pwmDrive = (originalPWM > 0) ? minPWM : -minPWM;
             }
+
+            softStartRampValue = rampValue;
         }
-    } else {
-        // No valid PWM config
-        motorPWM = 0;
-        LOG_ERROR(EventSource::AUTOSTEER, "Invalid PWM configuration");
     }
     
-    // Apply motor direction from config
-    if (configManager.getMotorDriveDirection()) {
-        motorPWM = -motorPWM;  // Invert if configured
+    return pwmDrive;
+}
+
+void AutosteerProcessor::logMotorStateChange() {
+    MotorState state = motorState;
+    if (state == loggedMotorState) {
+        return;
     }
     
-    // Final PWM limit check - ensure we never exceed highPWM setting
-    // Log current settings for debugging (DEBUG level to avoid spam)
-    static uint32_t lastPWMSettingsLog = 0;
-    if (millis() - lastPWMSettingsLog > 30000) {  // Log every 30 seconds
-        lastPWMSettingsLog = millis();
-        // Note: PWM settings now come from ConfigManager
-        LOG_DEBUG(EventSource::AUTOSTEER, "PWM Settings: highPWM=%d, lowPWM=%d, minPWM=%d", 
-                  configManager.getHighPWM(), configManager.getLowPWM(), configManager.getMinPWM());
+    if (state == MotorState::NORMAL_CONTROL) {
+        LOG_INFO(EventSource::AUTOSTEER, "%s complete - normal steering control",
+                 loggedMotorState == MotorState::SOFT_ACCEL ? "Soft-accel" : "Soft-start");
+    } else if (state == MotorState::SOFT_ACCEL) {
+        LOG_DEBUG(EventSource::AUTOSTEER, "Hard acceleration detected - entering soft accel mode");
+    } else if (state == MotorState::SOFT_START) {
+        LOG_DEBUG(EventSource::AUTOSTEER, "Direction change detected - entering soft start mode");
+    }
+    loggedMotorState = state;
+}
+
+void AutosteerProcessor::startControlLane() {
+    uint16_t rateHz = configManager.getControlLaneRateHz();
+    if (rateHz == 0) {
+        LOG_INFO(EventSource::AUTOSTEER, "Control lane disabled - autosteer runs in the 100Hz loop task");
+        return;
     }
     
-    // Motor speed is now properly scaled to respect highPWM limit
-    // No additional limiting needed here since we scale by newHighPWM above
+    if (!motorPTR || !motorPTR->supportsControlLane()) {
+        LOG_WARNING(EventSource::AUTOSTEER, "Control lane not available for %s - using the 100Hz loop task",
+                    motorPTR ? motorPTR->getTypeName() : "no motor");
+        return;
+    }
     
+    // The ISR reads an inactive setpoint until updateMotorControl() publishes one
+    controlLaneActive = ControlLane::getInstance()->start(controlLaneTick, rateHz);
+}
+
+void AutosteerProcessor::publishLaneSetpoint(bool active) {
+    if (!controlLaneActive) {
+        return;
+    }
     
-    // Send to motor
-    if (motorPTR) {
-        // Only enable motor if not in disabled state
-        if (motorState != MotorState::DISABLED) {
-            motorPTR->enable(true);
-            motorPTR->setPWM(motorPWM);
-            
-            // Debug log to confirm PWM is being sent
-            static uint32_t lastMotorCmdLog = 0;
-            if (millis() - lastMotorCmdLog > 1000) {
-                lastMotorCmdLog = millis();
-                LOG_DEBUG(EventSource::AUTOSTEER, "Sending to motor: PWM=%d, State=%d", 
-                          motorPWM, (int)motorState);
-            }
-        }
-        
-        // LOCK output control
-        // For PWM motors, pin 4 is controlled by the motor driver
-        // For Keya/CAN motors, we need to control pin 4 directly
-        if (motorPTR->getType() == MotorDriverType::KEYA_CAN) {
-            // Directly control LOCK output for Keya motor
-            digitalWrite(4, HIGH);  // SLEEP_PIN = 4, HIGH = LOCK ON
-            
-            static bool lockLogged = false;
-            if (motorState == MotorState::NORMAL_CONTROL && !lockLogged) {
-                LOG_INFO(EventSource::AUTOSTEER, "LOCK output: ACTIVE (pin 4 HIGH for Keya motor)");
-                lockLogged = true;
-            } else if (motorState == MotorState::DISABLED) {
-                lockLogged = false;
-            }
-        }
+    // Fill the slot the ISR is not reading, then flip the index. The ISR runs to
+    // completion, so it can never observe a half-written slot.
+    const ControlConfig* config = configManager.getControlConfig();
+    uint8_t next = laneSetpointIndex ^ 1;
+    LaneSetpoint& sp = laneSetpoints[next];
+    sp.targetAngle = targetAngle;
+    sp.targetRate = targetRate;
+    sp.ackermanFix = config->ackermanFix;
+    sp.gains = loadGains(config);
+    sp.highPWM = config->highPWM;
+    sp.minPWM = config->minPWM;
+    applyScheduledGains(config, sp.gains, sp.minPWM);
+    sp.reverseDirection = config->motorDriveDirection;
+    sp.invertWAS = config->invertWAS;
+    sp.useFusedAngle = config->insUseFusion && wheelAngleFusionPtr && wheelAngleFusionPtr->isHealthy();
+    sp.fusedAngle = sp.useFusedAngle ? wheelAngleFusionPtr->getFusedAngle() : 0.0f;
+    sp.active = active;
+    asm volatile("" ::: "memory");
+    laneSetpointIndex = next;
+}
+
+void AutosteerProcessor::controlLaneTick(float dt) {
+    if (instance) {
+        instance->controlTick(dt);
+    }
+}
+
+void AutosteerProcessor::controlTick(float dt) {
+    // Runs in the ControlLane timer ISR - no logging, no network, no I2C
+    const LaneSetpoint& sp = laneSetpoints[laneSetpointIndex];
+    
+    // Sense: fresh WAS sample (or the loop's fused angle), Ackerman corrected
+    float angle;
+    if (sp.useFusedAngle) {
+        angle = sp.fusedAngle;
+    } else {
+        adProcessor.sampleWASFromISR();  // Keeps the previous sample if ADC1 is busy
+        angle = adProcessor.wasRawToAngle(adProcessor.getWASRaw(), sp.invertWAS);
     }
+    float corrected = (angle < 0) ? angle * sp.ackermanFix : angle;
+    currentAngle = angle;
+    actualAngle = corrected;
+    
+    if (!sp.active || motorState == MotorState::DISABLED || !motorPTR) {
+        controller.reset();  // Start clean on the next engagement
+        estimator.sample(0, angle, dt, sp.highPWM, false);
+        return;
+    }
+    
+    // Control - the fused angle only changes at the loop rate, the derivative
+    // filter smooths its steps
+    int16_t pwmDrive = computeMotorPWM(corrected, sp.targetAngle, sp.targetRate, dt, sp.gains, sp.highPWM, sp.minPWM);
+    motorPWM = sp.reverseDirection ? -pwmDrive : pwmDrive;
+    estimator.sample(pwmDrive, angle, dt, sp.highPWM, motorState != MotorState::DISABLED);
     
+    // Actuate
+    motorPTR->setPWM(motorPWM);
+}
+
+SteerController::Gains AutosteerProcessor::loadGains(const ControlConfig* config) const {
+    SteerController::Gains gains;
+    gains.mode = config->steerControlMode;
+    gains.kp = config->kp;
+    gains.ki = config->steerKi;
+    gains.kd = config->steerKd;
+    gains.kff = config->steerKff;
+    return gains;
+}
+
+void AutosteerProcessor::applyScheduledGains(const ControlConfig* config, SteerController::Gains& gains,
+                                             uint8_t& minPWM) const {
+    if (!config->steerAutoGains) {
+        return;
+    }
+    ActuatorEstimator::Estimate estimate;
+    estimator.getEstimate(estimate);
+    if (!estimate.valid) {
+        return;  // Keep the PGN 252 gains until the estimate is confident
+    }
+    ActuatorEstimator::ScheduledGains scheduled =
+        ActuatorEstimator::gainsFor(estimate, ActuatorEstimator::speedBand(vehicleSpeed));
+    gains.kp = scheduled.kp;
+    minPWM = scheduled.minPWM;
+}
+
+void AutosteerProcessor::saveActuatorEstimate() {
+    // Called on disengage: the EEPROM write stalls the loop, so only when the
+    // estimate has moved on by a full confidence window, at most once a minute
+    ActuatorEstimator::Estimate estimate;
+    estimator.getEstimate(estimate);
+    if (!estimate.valid || estimate.updates < savedEstimateUpdates + ActuatorEstimator::MIN_UPDATES) {
+        return;
+    }
+    if (lastEstimateSaveTime != 0 && millis() - lastEstimateSaveTime < ESTIMATE_SAVE_INTERVAL_MS) {
+        return;
+    }
+    configManager.setActuatorEstimate(estimate.gain, estimate.deadband, estimate.lag, estimate.confidence);
+    configManager.saveSteerSettings();
+    savedEstimateUpdates = estimate.updates;
+    lastEstimateSaveTime = millis();
+    LOG_INFO(EventSource::AUTOSTEER, "Saved actuator estimate: gain=%.3f deg/s/PWM, deadband=%.0f PWM, lag=%.0fms, confidence=%.2f",
+             estimate.gain, estimate.deadband, estimate.lag * 1000.0f, estimate.confidence);
+}
+
+void AutosteerProcessor::resetActuatorEstimate() {
+    estimator.requestReset();
+    savedEstimateUpdates = 0;
+    configManager.setActuatorEstimate(0.0f, 0.0f, 0.0f, 0.0f);
+    configManager.saveSteerSettings();
+    LOG_INFO(EventSource::AUTOSTEER, "Actuator estimate reset - identifying from scratch");
+}
+
+void AutosteerProcessor::updateTargetRate() {
+    // PGN 254 setpoints arrive at ~10Hz; the rate between them drives the
+    // feed-forward. Bursts are skipped and long gaps restart the estimate.
+    uint32_t nowMicros = micros();
+    uint32_t gapMicros = nowMicros - rateRefMicros;
+    if (rateRefMicros == 0 || gapMicros > TARGET_RATE_MAX_GAP_US) {
+        targetRate = 0.0f;
+    } else if (gapMicros >= TARGET_RATE_MIN_GAP_US) {
+        float rate = (targetAngle - rateRefAngle) * 1000000.0f / gapMicros;
+        rate = constrain(rate, -MAX_TARGET_RATE, MAX_TARGET_RATE);
+        targetRate += 0.5f * (rate - targetRate);
+    } else {
+        return;
+    }
+    rateRefAngle = targetAngle;
+    rateRefMicros = nowMicros;
 }
 
 bool AutosteerProcessor::shouldSteerBeActive() const {
@@ -1482,15 +1664,11 @@ bool AutosteerProcessor::shouldSteerBeActive() const {
     // because AgOpenGPS may not set bit 6 until it receives confirmation from us
     bool active = guidanceActive &&           // Guidance line active (bit 0 from PGN 254)
                   (steerState == 0) &&        // Our button/OSB state (0=active)
-                  (vehicleSpeed > (configManager.getMinSpeed() / 10.0f));  // Moving (MinSpeed is in 0.1 km/h units)
+                  (vehicleSpeed > (configManager.getControlConfig()->minSpeed / 10.0f));  // Moving (MinSpeed is in 0.1 km/h units)
     
     // Debug logging for test mode
-    static uint32_t lastDebugTime = 0;
-    if (millis() - lastDebugTime > 1000) {
-        lastDebugTime = millis();
-        LOG_DEBUG(EventSource::AUTOSTEER, "shouldSteerBeActive: guidance=%d, steerState=%d, speed=%.1f -> %s",
-                  guidanceActive, steerState, vehicleSpeed, active ? "YES" : "NO");
-    }
+    LOG_DEBUG_EVERY(1000, EventSource::AUTOSTEER, "shouldSteerBeActive: guidance=%d, steerState=%d, speed=%.1f -> %s",
+                    guidanceActive, steerState, vehicleSpeed, active ? "YES" : "NO");
     
     return active;
 }
@@ -1498,6 +1676,9 @@ bool AutosteerProcessor::shouldSteerBeActive() const {
 void AutosteerProcessor::emergencyStop() {
     LOG_WARNING(EventSource::AUTOSTEER, "EMERGENCY STOP");
     
+    // Stop the control lane from driving the motor first
+    publishLaneSetpoint(false);
+    
     // Reset motor state
     motorState = MotorState::DISABLED;
     
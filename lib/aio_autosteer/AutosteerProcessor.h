@@ -8,7 +8,8 @@
 #define AUTOSTEER_PROCESSOR_H
 
 #include <Arduino.h>
-// PIDController removed - functionality absorbed into AutosteerProcessor
+#include "SteerController.h"
+#include "ActuatorEstimator.h"
 
 // External pointers
 class ADProcessor;
@@ -18,6 +19,7 @@ class MotorDriverInterface;
 extern MotorDriverInterface motorDriver;
 
 class KickoutMonitor;
+struct ControlConfig;
 
 // PGN data is parsed directly to ConfigManager
 // No intermediate structs needed
@@ -36,6 +38,15 @@ private:
     float targetAngle = 0.0f;
     uint32_t lastPGN254Time = 0;
     
+    // Target angle rate for feed-forward, from successive PGN 254 setpoints
+    float targetRate = 0.0f;             // deg/s, smoothed
+    float rateRefAngle = 0.0f;
+    uint32_t rateRefMicros = 0;
+    static constexpr uint32_t TARGET_RATE_MIN_GAP_US = 20000;   // Closer setpoints are a burst, not a rate
+    static constexpr uint32_t TARGET_RATE_MAX_GAP_US = 300000;  // Longer gaps restart the estimate
+    static constexpr float MAX_TARGET_RATE = 60.0f;             // deg/s, a new line can jump the setpoint
+    void updateTargetRate();
+    
     // PGN 254 data
     float vehicleSpeed = 0.0f;      // km/h
     bool guidanceActive = false;     // Guidance line active
@@ -55,10 +66,10 @@ private:
     bool prevGuidanceStatus = false;     // Previous guidance status from AgOpenGPS
     bool guidanceStatusChanged = false;  // Flag for guidance status change
     
-    // Motor control
-    float currentAngle = 0.0f;           // Current WAS angle
-    float actualAngle = 0.0f;            // Ackerman-corrected angle
-    int16_t motorPWM = 0;                // Current motor PWM command (-255 to +255)
+    // Motor control (volatile: also written by the control lane ISR)
+    volatile float currentAngle = 0.0f;  // Current WAS angle
+    volatile float actualAngle = 0.0f;   // Ackerman-corrected angle
+    volatile int16_t motorPWM = 0;       // Current motor PWM command (-255 to +255)
     
     // Watchdog
     uint32_t lastCommandTime = 0;        // Last time we received PGN 254
@@ -77,8 +88,9 @@ private:
         NORMAL_CONTROL
     };
 
-    MotorState motorState = MotorState::DISABLED;
-    uint32_t softStartBeginTime = 0;
+    volatile MotorState motorState = MotorState::DISABLED;
+    MotorState loggedMotorState = MotorState::DISABLED;  // Last state reported in the log
+    volatile uint32_t softStartBeginTime = 0;
     float softStartRampValue = 0.0f;
 
     // Soft-start configuration constants
@@ -98,6 +110,61 @@ private:
     int8_t previousCytronDriver = -1;       // Previous Cytron bit state
     bool motorConfigInitialized = false;    // Track if we've initialized from EEPROM
     
+    // ControlConfig versions last logged by process() and updateMotorControl()
+    uint32_t inputsConfigVersion = 0;
+    uint32_t gainsConfigVersion = 0;
+    
+    // Measured loop period for sensor fusion and the controller
+    uint32_t lastProcessMicros = 0;
+    float controlDt = 0.01f;
+    
+    // P/PID/PID+FF engine - owned by the control lane ISR while it runs
+    SteerController controller;
+    SteerController::Gains loadGains(const ControlConfig* config) const;
+    
+    // Online actuator identification, sampled by the control tick. With auto
+    // gains on, a confident estimate replaces Kp and minPWM per speed band.
+    ActuatorEstimator estimator;
+    int16_t loopDrive = 0;                  // Loop task's last drive, 0 while disabled
+    uint32_t savedEstimateUpdates = 0;      // estimator updates at the last EEPROM save
+    uint32_t lastEstimateSaveTime = 0;
+    static constexpr uint32_t ESTIMATE_SAVE_INTERVAL_MS = 60000;
+    void applyScheduledGains(const ControlConfig* config, SteerController::Gains& gains, uint8_t& minPWM) const;
+    void saveActuatorEstimate();
+    
+    // LatencyTrace stamp of the PGN 254 not yet turned into a motor command
+    uint32_t steerDataTraceCycles = 0;
+    void traceSteerCommand();
+    
+    // Hard real-time control lane (ControlLane timer ISR)
+    // Loop -> ISR data is double buffered: the loop fills the inactive slot and
+    // flips laneSetpointIndex, the ISR only ever reads the active slot
+    struct LaneSetpoint {
+        float targetAngle;
+        float ackermanFix;
+        float fusedAngle;           // Used instead of the WAS when useFusedAngle
+        float targetRate;
+        SteerController::Gains gains;
+        uint8_t highPWM;
+        uint8_t minPWM;
+        bool reverseDirection;
+        bool invertWAS;
+        bool useFusedAngle;
+        bool active;                // Motor enabled, ISR may drive it
+    };
+    LaneSetpoint laneSetpoints[2] = {};
+    volatile uint8_t laneSetpointIndex = 0;
+    bool controlLaneActive = false;
+    
+    void startControlLane();
+    void publishLaneSetpoint(bool active);
+    void refreshLaneSetpoint() { publishLaneSetpoint(laneSetpoints[laneSetpointIndex].active); }
+    
+    // Log-free controller + soft ramp shaping, safe from the control lane ISR.
+    // Returns the PWM before motor direction is applied.
+    int16_t computeMotorPWM(float actual, float target, float rate, float dt,
+                            const SteerController::Gains& gains, uint8_t highPWM, uint8_t minPWM);
+    void logMotorStateChange();
     
 public:
     // Singleton access
@@ -133,6 +200,15 @@ public:
     // Static callback wrapper for PGN registration
     static void handlePGNStatic(uint8_t pgn, const uint8_t* data, size_t len);
     
+    // Control lane: sense -> control -> actuate, runs in the timer ISR
+    static void controlLaneTick(float dt);
+    void controlTick(float dt);
+    bool isControlLaneActive() const { return controlLaneActive; }
+    
+    // Actuator identification
+    void getActuatorEstimate(ActuatorEstimator::Estimate& estimate) const { estimator.getEstimate(estimate); }
+    void resetActuatorEstimate();
+    
     
     // Public getters for state
     bool isEnabled() const { return autosteerEnabled; }
@@ -153,6 +229,9 @@ public:
     }
 
     bool getUseSineRamp() const { return useSineRamp; }
+    
+    // Steering controller
+    float getTargetRate() const { return targetRate; }
     void setUseSineRamp(bool useSine) { useSineRamp = useSine; }
 };
 
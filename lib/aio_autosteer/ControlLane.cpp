@@ -0,0 +1,161 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+#include "ControlLane.h"
+#include "EventLogger.h"
+
+// Jitter histogram bucket upper bounds in ns (last bucket is open ended)
+static const uint32_t JITTER_BUCKET_NS[ControlLane::JITTER_BUCKETS - 1] = {
+    1000, 2000, 5000, 10000, 20000, 50000, 100000
+};
+
+ControlLane* ControlLane::instance = nullptr;
+
+ControlLane* ControlLane::getInstance() {
+    if (instance == nullptr) {
+        instance = new ControlLane();
+    }
+    return instance;
+}
+
+bool ControlLane::start(TickFunction tick, uint16_t hz) {
+    if (tick == nullptr || hz < MIN_RATE_HZ || hz > MAX_RATE_HZ) {
+        LOG_ERROR(EventSource::AUTOSTEER, "Control lane: invalid rate %dHz (%d-%dHz)",
+                  hz, MIN_RATE_HZ, MAX_RATE_HZ);
+        return false;
+    }
+
+    if (running) {
+        stop();
+    }
+
+    tickFunction = tick;
+    rateHz = hz;
+    periodCycles = F_CPU_ACTUAL / hz;
+    nominalDt = 1.0f / (float)hz;
+    haveLastTick = false;
+    resetRequested = true;
+
+    uint32_t periodUs = 1000000UL / hz;
+    if (!timer.begin(timerISR, periodUs)) {
+        LOG_ERROR(EventSource::AUTOSTEER, "Control lane: no free IntervalTimer");
+        return false;
+    }
+    timer.priority(TIMER_PRIORITY);
+    running = true;
+
+    LOG_INFO(EventSource::AUTOSTEER, "Control lane started at %dHz (%luus period)", hz, periodUs);
+    return true;
+}
+
+void ControlLane::stop() {
+    if (!running) {
+        return;
+    }
+    timer.end();
+    running = false;
+    LOG_INFO(EventSource::AUTOSTEER, "Control lane stopped");
+}
+
+void ControlLane::timerISR() {
+    if (instance) {
+        instance->onTick();
+    }
+}
+
+void ControlLane::onTick() {
+    uint32_t startCycles = ARM_DWT_CYCCNT;
+
+    // Measure the real period so the controller integrates with the true dt
+    float dt = nominalDt;
+    uint32_t jitterCycles = 0;
+    if (haveLastTick) {
+        uint32_t actualCycles = startCycles - lastTickCycles;
+        dt = (float)actualCycles / (float)F_CPU_ACTUAL;
+        jitterCycles = (actualCycles > periodCycles) ? actualCycles - periodCycles
+                                                     : periodCycles - actualCycles;
+    }
+    lastTickCycles = startCycles;
+
+    tickFunction(dt);
+
+    uint32_t execCycles = ARM_DWT_CYCCNT - startCycles;
+    uint32_t cyclesPerUs = F_CPU_ACTUAL / 1000000UL;
+    uint32_t jitterNs = (uint32_t)(((uint64_t)jitterCycles * 1000ULL) / cyclesPerUs);
+    uint32_t execNs = (uint32_t)(((uint64_t)execCycles * 1000ULL) / cyclesPerUs);
+
+    statsSeq = statsSeq + 1;
+    asm volatile("" ::: "memory");
+    if (resetRequested) {
+        stats = {};
+        resetRequested = false;
+    }
+    stats.ticks++;
+    stats.totalExecNs += execNs;
+    if (execNs > stats.maxExecNs) {
+        stats.maxExecNs = execNs;
+    }
+    if (execCycles > periodCycles) {
+        stats.overruns++;
+    }
+    // The first tick after start/reset has no previous edge to measure against
+    if (haveLastTick) {
+        stats.totalJitterNs += jitterNs;
+        if (jitterNs > stats.maxJitterNs) {
+            stats.maxJitterNs = jitterNs;
+        }
+        uint8_t bucket = 0;
+        while (bucket < JITTER_BUCKETS - 1 && jitterNs >= JITTER_BUCKET_NS[bucket]) {
+            bucket++;
+        }
+        stats.jitterHistogram[bucket]++;
+    }
+    asm volatile("" ::: "memory");
+    statsSeq = statsSeq + 1;
+
+    haveLastTick = true;
+}
+
+void ControlLane::getStats(Stats& out) const {
+    uint32_t seq;
+    do {
+        seq = statsSeq;
+        asm volatile("" ::: "memory");
+        memcpy(&out, &stats, sizeof(Stats));
+        asm volatile("" ::: "memory");
+    } while (seq != statsSeq);
+}
+
+void ControlLane::printStats() const {
+    if (!running) {
+        Serial.print("\r\nControl lane not running (cooperative 100Hz autosteer)\r\n");
+        return;
+    }
+
+    Stats s;
+    getStats(s);
+    uint32_t measured = (s.ticks > 1) ? s.ticks - 1 : 0;
+
+    Serial.printf("\r\n=== Control Lane (%dHz) ===\r\n", rateHz);
+    Serial.printf("Ticks: %lu, overruns: %lu\r\n", s.ticks, s.overruns);
+    if (s.ticks > 0) {
+        Serial.printf("Exec: avg=%.2fus max=%.2fus\r\n",
+                      (float)(s.totalExecNs / s.ticks) / 1000.0f, s.maxExecNs / 1000.0f);
+    }
+    if (measured > 0) {
+        Serial.printf("Jitter: avg=%.2fus max=%.2fus\r\n",
+                      (float)(s.totalJitterNs / measured) / 1000.0f, s.maxJitterNs / 1000.0f);
+    }
+    Serial.print("Jitter histogram:");
+    for (uint8_t i = 0; i < JITTER_BUCKETS; i++) {
+        if (i < JITTER_BUCKETS - 1) {
+            Serial.printf(" <%luus=%lu", JITTER_BUCKET_NS[i] / 1000, s.jitterHistogram[i]);
+        } else {
+            Serial.printf(" >=%luus=%lu", JITTER_BUCKET_NS[i - 1] / 1000, s.jitterHistogram[i]);
+        }
+    }
+    Serial.print("\r\n");
+}
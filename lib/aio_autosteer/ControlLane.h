@@ -0,0 +1,84 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+#ifndef CONTROL_LANE_H
+#define CONTROL_LANE_H
+
+#include <Arduino.h>
+
+/**
+ * ControlLane - Hard real-time execution tier on a Teensy IntervalTimer
+ *
+ * Runs a single tick function (sense -> control -> actuate) at a fixed rate
+ * from a timer interrupt, independent of how busy the cooperative loop is.
+ * The tick receives the measured period since the previous tick as dt.
+ *
+ * Rules for the tick function:
+ * - No logging, no network, no I2C, no blocking calls
+ * - Read loop-side data only through lock-free snapshots
+ *
+ * Jitter and execution time are measured with the ARM cycle counter and
+ * published to the loop through a sequence counter, so reading the stats
+ * never blocks the ISR.
+ */
+class ControlLane {
+public:
+    typedef void (*TickFunction)(float dt);
+
+    static constexpr uint16_t MIN_RATE_HZ = 100;
+    static constexpr uint16_t MAX_RATE_HZ = 1000;
+    static constexpr uint8_t TIMER_PRIORITY = 64;    // Preempts Ethernet, serial and USB ISRs (lower = higher)
+
+    // Jitter histogram: <1, <2, <5, <10, <20, <50, <100, >=100 us
+    static constexpr uint8_t JITTER_BUCKETS = 8;
+
+    struct Stats {
+        uint32_t ticks;
+        uint32_t maxJitterNs;         // Worst |actual period - nominal period|
+        uint64_t totalJitterNs;
+        uint32_t maxExecNs;           // Worst tick function run time
+        uint64_t totalExecNs;
+        uint32_t overruns;            // Tick function longer than the period
+        uint32_t jitterHistogram[JITTER_BUCKETS];
+    };
+
+    static ControlLane* getInstance();
+
+    bool start(TickFunction tick, uint16_t rateHz);
+    void stop();
+    bool isRunning() const { return running; }
+    uint16_t getRateHz() const { return rateHz; }
+
+    // Consistent copy of the ISR-side stats (retries if a tick lands mid-copy)
+    void getStats(Stats& out) const;
+    void resetStats() { resetRequested = true; }  // Applied by the ISR on its next tick
+    void printStats() const;
+
+private:
+    ControlLane() = default;
+    static ControlLane* instance;
+
+    static void timerISR();
+    void onTick();
+
+    IntervalTimer timer;
+    TickFunction tickFunction = nullptr;
+    uint16_t rateHz = 0;
+    bool running = false;
+
+    // ISR-only timing state
+    uint32_t periodCycles = 0;
+    uint32_t lastTickCycles = 0;
+    bool haveLastTick = false;
+    float nominalDt = 0.0f;
+
+    // ISR -> loop stats (seqlock: ISR bumps the counter around each update)
+    Stats stats = {};
+    volatile uint32_t statsSeq = 0;
+    volatile bool resetRequested = false;
+};
+
+#endif // CONTROL_LANE_H
@@ -50,6 +50,7 @@ public:
     void setPWM(int16_t pwm) override;
     void stop() override;
     void process() override;
+    bool supportsControlLane() const override { return true; }  // setPWM only stores the target
     MotorStatus getStatus() const override;
     
     // Type information
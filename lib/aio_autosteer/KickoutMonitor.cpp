@@ -10,6 +10,7 @@
 #include "EncoderProcessor.h"
 #include "HardwareManager.h"  // For KICKOUT_D_PIN and KICKOUT_A_PIN
 #include "EventLogger.h"
+#include "QNEthernetUDPHandler.h"
 #include "TurnSensorTypes.h"
 #include "KeyaCANDriver.h"
 
@@ -28,6 +29,8 @@ KickoutMonitor* KickoutMonitor::instance = nullptr;
 
 KickoutMonitor::KickoutMonitor() : 
     configMgr(nullptr),
+    config(nullptr),
+    loggedConfigVersion(0),
     adProcessor(nullptr),
     motorDriver(nullptr),
     encoderProc(nullptr),
@@ -59,6 +62,7 @@ bool KickoutMonitor::init(MotorDriverInterface* driver) {
     
     // Get external dependencies
     configMgr = &configManager;
+    config = configMgr->getControlConfig();
     this->adProcessor = &::adProcessor;  // Use global scope
     motorDriver = driver;
     encoderProc = encoderProcessor;
@@ -86,6 +90,9 @@ bool KickoutMonitor::init(MotorDriverInterface* driver) {
 }
 
 void KickoutMonitor::process() {
+    // One settings snapshot for this pass and the checks it runs
+    config = configMgr->getControlConfig();
+    
     // Get encoder processor if we don't have it yet
     if (!encoderProc) {
         encoderProc = encoderProcessor;  // Try to get the global instance
@@ -97,10 +104,9 @@ void KickoutMonitor::process() {
                        motorType == MotorDriverType::KEYA_SERIAL ||
                        motorType == MotorDriverType::TRACTOR_CAN);  // TRACTOR_CAN handles its own kickout
     
-    // Debug motor type and sensor configuration
-    static uint32_t lastDebugTime = 0;
-    if (millis() - lastDebugTime > 10000) {  // Every 10 seconds
-        lastDebugTime = millis();
+    // Debug motor type and sensor configuration whenever the settings change
+    if (config->version != loggedConfigVersion) {
+        loggedConfigVersion = config->version;
         if (motorDriver) {
             const char* motorTypeName = "Unknown";
             switch (motorDriver->getType()) {
@@ -116,9 +122,9 @@ void KickoutMonitor::process() {
             }
             LOG_DEBUG(EventSource::AUTOSTEER, "KickoutMonitor: Motor=%s, isKeya=%d, Encoder=%d, Pressure=%d, Current=%d",
                      motorTypeName, isKeyaMotor,
-                     configMgr->getShaftEncoder(),
-                     configMgr->getPressureSensor(),
-                     configMgr->getCurrentSensor());
+                     config->shaftEncoder,
+                     config->pressureSensor,
+                     config->currentSensor);
         }
     }
     
@@ -132,7 +138,7 @@ void KickoutMonitor::process() {
             static int32_t lastLoggedCount = 0;
             
             if (abs(newCount - lastLoggedCount) >= 10) {  // Log every 10 counts
-                uint16_t maxPulses = configMgr->getPulseCountMax();
+                uint16_t maxPulses = config->pulseCountMax;
                 LOG_DEBUG(EventSource::AUTOSTEER, "Encoder count: %d (max: %u)", newCount, maxPulses);
                 lastLoggedCount = newCount;
             }
@@ -152,15 +158,13 @@ void KickoutMonitor::process() {
         // Not currently in kickout - check if we should trigger one
         
         // Debug JD PWM status periodically
-        static uint32_t lastJDDebug = 0;
-        if (configMgr->getJDPWMEnabled() && (millis() - lastJDDebug > 2000)) {
-            LOG_DEBUG(EventSource::AUTOSTEER, "JD_PWM_KICKOUT: enabled=%d, motion_as_pressure=%u (AOG handles threshold), isKeyaMotor=%d",
-                      configMgr->getJDPWMEnabled(), lastPressureReading, isKeyaMotor);
-            lastJDDebug = millis();
+        if (config->jdPWMEnabled) {
+            LOG_DEBUG_EVERY(2000, EventSource::AUTOSTEER, "JD_PWM_KICKOUT: enabled=%d, motion_as_pressure=%u (AOG handles threshold), isKeyaMotor=%d",
+                            config->jdPWMEnabled, lastPressureReading, isKeyaMotor);
         }
         
         // External sensor checks - NOT for Keya motors
-        if (!isKeyaMotor && configMgr->getShaftEncoder()) {
+        if (!isKeyaMotor && config->shaftEncoder) {
             // Encoder is enabled for non-Keya motors
             if (checkEncoderKickout()) {
             kickoutActive = true;
@@ -175,7 +179,7 @@ void KickoutMonitor::process() {
                 }
             }
         }
-        else if (!isKeyaMotor && configMgr->getJDPWMEnabled() && checkPressureKickout()) {
+        else if (!isKeyaMotor && config->jdPWMEnabled && checkPressureKickout()) {
             // JD PWM mode uses pressure kickout mechanism since motion is sent as pressure
             kickoutActive = true;
             kickoutReason = JD_PWM_MOTION;
@@ -189,7 +193,7 @@ void KickoutMonitor::process() {
                 motorDriver->handleKickout(KickoutType::PRESSURE_SENSOR, lastPressureReading);
             }
         }
-        else if (!isKeyaMotor && configMgr->getPressureSensor() && !configMgr->getJDPWMEnabled() && checkPressureKickout()) {
+        else if (!isKeyaMotor && config->pressureSensor && !config->jdPWMEnabled && checkPressureKickout()) {
             LOG_DEBUG(EventSource::AUTOSTEER, "PRESSURE_KICKOUT: Regular pressure mode (JD PWM disabled)");
             kickoutActive = true;
             kickoutReason = PRESSURE_HIGH;
@@ -203,7 +207,7 @@ void KickoutMonitor::process() {
                 motorDriver->handleKickout(KickoutType::PRESSURE_SENSOR, pressureVolts);
             }
         }
-        else if (!isKeyaMotor && configMgr->getCurrentSensor() && checkCurrentKickout()) {
+        else if (!isKeyaMotor && config->currentSensor && checkCurrentKickout()) {
             kickoutActive = true;
             kickoutReason = CURRENT_HIGH;
             kickoutTime = millis();
@@ -237,25 +241,25 @@ void KickoutMonitor::process() {
         // Check the condition that caused the kickout
         switch (kickoutReason) {
             case ENCODER_OVERSPEED:
-                if (!isKeyaMotor && configMgr->getShaftEncoder() && checkEncoderKickout()) {
+                if (!isKeyaMotor && config->shaftEncoder && checkEncoderKickout()) {
                     conditionsNormal = false;
                 }
                 break;
                 
             case JD_PWM_MOTION:
-                if (!isKeyaMotor && configMgr->getJDPWMEnabled() && checkJDPWMKickout()) {
+                if (!isKeyaMotor && config->jdPWMEnabled && checkJDPWMKickout()) {
                     conditionsNormal = false;
                 }
                 break;
                 
             case PRESSURE_HIGH:
-                if (!isKeyaMotor && configMgr->getPressureSensor() && !configMgr->getJDPWMEnabled() && checkPressureKickout()) {
+                if (!isKeyaMotor && config->pressureSensor && !config->jdPWMEnabled && checkPressureKickout()) {
                     conditionsNormal = false;
                 }
                 break;
                 
             case CURRENT_HIGH:
-                if (!isKeyaMotor && configMgr->getCurrentSensor() && checkCurrentKickout()) {
+                if (!isKeyaMotor && config->currentSensor && checkCurrentKickout()) {
                     conditionsNormal = false;
                 }
                 break;
@@ -281,7 +285,7 @@ void KickoutMonitor::process() {
 
 bool KickoutMonitor::checkEncoderKickout() {
     // Get max pulse count from config - this is the absolute count threshold
-    uint16_t maxPulses = configMgr->getPulseCountMax();
+    uint16_t maxPulses = config->pulseCountMax;
     
     // Get absolute value of encoder count (handles both directions)
     // encoderPulseCount is int32_t from EncoderProcessor
@@ -309,7 +313,7 @@ bool KickoutMonitor::checkPressureKickout() {
     // This is the filtered/scaled value (0-255 range)
     
     // Get pressure threshold from config
-    uint8_t threshold = configMgr->getPulseCountMax();
+    uint8_t threshold = config->pulseCountMax;
     
     if (lastPressureReading > threshold) {
         // Only log when first detecting kickout (not already active) or every 1 second
@@ -332,7 +336,7 @@ bool KickoutMonitor::checkCurrentKickout() {
     lastCurrentReading = adProcessor->getMotorCurrent();
     
     // Get threshold from config (0-255, same scale as PGN250)
-    uint8_t thresholdPercent = configMgr->getCurrentThreshold();
+    uint8_t thresholdPercent = config->currentThreshold;
     
     
     // Convert threshold to raw ADC counts to match what ADProcessor returns
@@ -399,7 +403,7 @@ bool KickoutMonitor::checkMotorSlipOverCurrentKickout() {
             return true;
         }
         float current = keyaDriver->getKeyaCurrentX32();      // Get current from Keya x32, as only 1A resolution
-        uint8_t threshold = configMgr->getCurrentThreshold(); // Get threshold from config (0-255, same scale as PGN250)
+        uint8_t threshold = config->currentThreshold; // Get threshold from config (0-255, same scale as PGN250)
         //Serial.print("Keya current: "); Serial.print(current); Serial.print(" Threshold: "); Serial.println(threshold);
         if (current > threshold) { 
             LOG_WARNING(EventSource::AUTOSTEER, "KICKOUT: Keya motor current (A) %.1f value (Ax32): %.f over threshold %u",
@@ -424,15 +428,10 @@ bool KickoutMonitor::checkJDPWMKickout() {
     // AgOpenGPS will handle the kickout through its pressure threshold
     // This function now only exists for logging purposes
     
-    if (configMgr->getJDPWMEnabled()) {
-        // Debug output
-        static uint32_t lastDebugTime = 0;
-        uint32_t now = millis();
-        if (now - lastDebugTime > 1000) { // Debug every second
-            LOG_DEBUG(EventSource::AUTOSTEER, "JD_PWM_CHECK: motion_as_pressure=%u (AOG handles threshold)",
-                      lastPressureReading);
-            lastDebugTime = now;
-        }
+    if (config->jdPWMEnabled) {
+        // Debug output every second
+        LOG_DEBUG_EVERY(1000, EventSource::AUTOSTEER, "JD_PWM_CHECK: motion_as_pressure=%u (AOG handles threshold)",
+                        lastPressureReading);
     }
     
     // Always return false - let pressure kickout handle it
@@ -478,10 +477,11 @@ uint8_t KickoutMonitor::getTurnSensorReading() const {
     // Determine which turn sensor type is active
     TurnSensorType sensorType = TurnSensorType::NONE;
     
-    bool hasEncoder = configMgr->getShaftEncoder();
-    bool hasPressure = configMgr->getPressureSensor();
-    bool hasCurrent = configMgr->getCurrentSensor();
-    bool hasJDPWM = configMgr->getJDPWMEnabled();
+    const ControlConfig* config = configMgr->getControlConfig();
+    bool hasEncoder = config->shaftEncoder;
+    bool hasPressure = config->pressureSensor;
+    bool hasCurrent = config->currentSensor;
+    bool hasJDPWM = config->jdPWMEnabled;
     
     if (hasEncoder) {
         sensorType = TurnSensorType::ENCODER;
@@ -533,33 +533,9 @@ void KickoutMonitor::sendPGN250() {
 
     // PGN 250 - Turn Sensor Data to AgOpenGPS
     // Format per NG-V6: {header, source, pgn, length, sensorValue, 0, 0, 0, 0, 0, 0, 0, checksum}
-    uint8_t pgn250[] = {
-        0x80, 0x81,      // Header
-        126,             // Source: Steer module (0x7E)
-        0xFA,            // PGN: 250
-        8,               // Length
-        0,               // Sensor value (byte 5)
-        0,               // Reserved
-        0,               // Reserved
-        0,               // Reserved
-        0,               // Reserved
-        0,               // Reserved
-        0,               // Reserved
-        0,               // Reserved
-        0                // Checksum
-    };
-    
-    // Get the sensor reading based on active turn sensor type
-    pgn250[5] = getTurnSensorReading();
-    
-    // Calculate checksum
-    uint8_t checksum = 0;
-    for (int i = 2; i < sizeof(pgn250) - 1; i++) {
-        checksum += pgn250[i];
-    }
-    pgn250[sizeof(pgn250) - 1] = checksum;
-    
-    // Send via UDP
-    sendUDPbytes(pgn250, sizeof(pgn250));
+    uint8_t* pgn250 = QNEthernetUDPHandler::beginPGN(126, 0xFA, 8);  // Steer module, PGN 250
+    memset(pgn250, 0, 8);
+    pgn250[0] = getTurnSensorReading();  // Sensor value (byte 5), the rest reserved
+    QNEthernetUDPHandler::commitPGN();
     
 }
\ No newline at end of file
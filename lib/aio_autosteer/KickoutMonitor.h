@@ -11,6 +11,7 @@
 #include "MotorDriverInterface.h"
 
 class ConfigManager;
+struct ControlConfig;
 class ADProcessor;
 class MotorDriverInterface;
 class EncoderProcessor;
@@ -70,6 +71,8 @@ private:
 
     // External dependencies
     ConfigManager *configMgr;
+    const ControlConfig *config;     // Settings snapshot, refreshed each process()
+    uint32_t loggedConfigVersion;
     ADProcessor *adProcessor;
     MotorDriverInterface *motorDriver;
     EncoderProcessor *encoderProc;
@@ -69,6 +69,10 @@ public:
     // Process function for drivers that need regular updates
     virtual void process() { }
     
+    // True if setPWM() is safe to call from the ControlLane timer ISR
+    // (no logging, no I2C, no blocking bus access)
+    virtual bool supportsControlLane() const { return false; }
+    
     // Detection and identification
     virtual bool isDetected() = 0;
     
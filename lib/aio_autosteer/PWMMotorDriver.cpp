@@ -10,6 +10,7 @@
 #include "EventLogger.h"
 #include "HardwareManager.h"
 #include "ConfigManager.h"
+#include "ADProcessor.h"
 
 // External objects
 extern ConfigManager configManager;
@@ -161,16 +162,27 @@ void PWMMotorDriver::setPWM(int16_t pwm) {
         analogWrite(pwm2Pin, 0);
     }
     
-    // Debug output
+    // For PWM motors, actual PWM follows target immediately
+    status.actualPWM = pwm;
+    status.lastUpdateMs = millis();
+}
+
+void PWMMotorDriver::process() {
+    // Debug output lives here rather than in setPWM() so setPWM() stays safe
+    // to call from the control lane ISR
     static uint32_t lastDebug = 0;
     if (millis() - lastDebug > 1000) {
         lastDebug = millis();
+        int16_t pwm = status.targetPWM;
+        uint16_t pwmValue = ((uint16_t)abs(pwm) * 4095) / 255;
+        bool brakeMode = configManager.getPWMBrakeMode();
         if (hasCurrentSense) {
+            // Commanded values - reading the PWM pins back would convert on ADC1
             LOG_DEBUG(EventSource::AUTOSTEER, "PWM %s mode: %d -> PWM1=%d, PWM2=%d, Current: %.2fA", 
                      brakeMode ? "BRAKE" : "COAST",
                      pwm, 
-                     analogRead(pwm1Pin),
-                     analogRead(pwm2Pin),
+                     pwm < 0 ? pwmValue : 0,
+                     pwm > 0 ? pwmValue : 0,
                      getCurrent());
         } else {
             LOG_DEBUG(EventSource::AUTOSTEER, "PWM: %d -> PWM1=%d, PWM2=%d", 
@@ -179,10 +191,6 @@ void PWMMotorDriver::setPWM(int16_t pwm) {
                      pwm > 0 ? pwmValue : 0);
         }
     }
-    
-    // For PWM motors, actual PWM follows target immediately
-    status.actualPWM = pwm;
-    status.lastUpdateMs = millis();
 }
 
 void PWMMotorDriver::stop() {
@@ -198,8 +206,11 @@ void PWMMotorDriver::stop() {
 float PWMMotorDriver::getCurrent() const {
     if (!hasCurrentSense) return 0.0f;
     
-    // Read ADC value (Teensy 4.1 has 12-bit ADC)
-    int adcValue = analogRead(currentPin);
+    // Read ADC value (Teensy 4.1 has 12-bit ADC) through ADProcessor, which
+    // keeps the control lane ISR off ADC1 during the conversion
+    ADProcessor* adProcessor = ADProcessor::instance;
+    if (adProcessor == nullptr) return 0.0f;
+    int adcValue = adProcessor->readADC1(currentPin);
     
     // Convert to voltage (3.3V reference)
     float voltage = (adcValue * 3.3f) / 4095.0f;
@@ -42,6 +42,8 @@ public:
     void enable(bool en) override;
     void setPWM(int16_t pwm) override;
     void stop() override;
+    void process() override;
+    bool supportsControlLane() const override { return true; }
     
     MotorStatus getStatus() const override { return status; }
     MotorDriverType getType() const override { return driverType; }
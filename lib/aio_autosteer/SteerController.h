@@ -0,0 +1,133 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// SteerController.h
+// Steering controller engine shared by the 100Hz loop task and the control
+// lane ISR. Turns the wheel angle error into a signed PWM drive, adds minPWM
+// to overcome valve/motor deadband and limits to highPWM - the soft-start and
+// soft-accel shaping stays in AutosteerProcessor.
+//
+// Modes:
+//   P      - Kp * error, exactly the original AgOpenGPS behaviour
+//   PID    - adds an integral (conditional integration: it stops while the
+//            output is saturated in the direction the error pushes, and is
+//            frozen during soft ramps) and a derivative on the measured
+//            angle through a low-pass filter, so PGN 254 steps don't kick it
+//   PID_FF - PID plus Kff times the target angle rate AgOpenGPS is asking
+//            for, estimated from successive PGN 254 setpoints
+//
+// Error is actual - target, as in AgOpenGPS, so a positive drive turns the
+// wheels towards negative angles. Log-free and allocation-free; safe from an
+// ISR. Header-only with no Arduino dependencies so host tools can use it.
+
+#ifndef STEER_CONTROLLER_H
+#define STEER_CONTROLLER_H
+
+#include <stdint.h>
+#include <math.h>
+
+class SteerController {
+public:
+    enum Mode : uint8_t {
+        P = 0,
+        PID = 1,
+        PID_FF = 2,
+        MODE_COUNT
+    };
+
+    struct Gains {
+        uint8_t mode;
+        float kp;    // PWM per degree (PGN 252 Kp)
+        float ki;    // PWM per degree-second
+        float kd;    // PWM per degree/s of measured wheel angle rate
+        float kff;   // PWM per degree/s of target angle rate
+    };
+
+    static constexpr float D_FILTER_HZ = 15.0f;   // Derivative low-pass corner
+
+    static const char* modeName(uint8_t mode)
+    {
+        switch (mode) {
+            case P:      return "P";
+            case PID:    return "PID";
+            case PID_FF: return "PID+FF";
+            default:     return "?";
+        }
+    }
+
+    // error = actual - target (degrees), actual = measured angle (degrees),
+    // targetRate in degrees/s, dt in seconds. integrate = false holds the
+    // integral (e.g. while a soft ramp scales the output).
+    int16_t update(const Gains& gains, float error, float actual, float targetRate, float dt,
+                   uint8_t highPWM, uint8_t minPWM, bool integrate)
+    {
+        if (highPWM == 0) {
+            return 0;  // No valid PWM config
+        }
+
+        float drive = gains.kp * error;
+
+        if (gains.mode != P && dt > 0.0f) {
+            // Derivative on measurement, filtered
+            if (haveLast) {
+                float rate = (actual - lastActual) / dt;
+                float alpha = dt / (dt + 1.0f / (2.0f * (float)M_PI * D_FILTER_HZ));
+                actualRate += alpha * (rate - actualRate);
+            }
+            lastActual = actual;
+            haveLast = true;
+
+            float feedForward = (gains.mode == PID_FF) ? -gains.kff * targetRate : 0.0f;
+            float unsaturated = drive + gains.kd * actualRate + feedForward;
+
+            // Conditional integration: only while the output has headroom in
+            // the direction this error would push the integral
+            float headroom = (float)(highPWM > minPWM ? highPWM - minPWM : 0);
+            float candidate = integral + gains.ki * error * dt;
+            float total = unsaturated + candidate;
+            bool windingUp = (total > headroom && error > 0.0f) || (total < -headroom && error < 0.0f);
+            if (integrate && gains.ki > 0.0f && !windingUp) {
+                integral = candidate;
+            }
+            if (integral > headroom) integral = headroom;
+            if (integral < -headroom) integral = -headroom;
+
+            drive = unsaturated + integral;
+        }
+
+        // Same integer truncation, minPWM offset and limit as the P controller
+        int16_t pwmDrive = (int16_t)fmaxf(fminf(drive, 32767.0f), -32767.0f);
+        if (pwmDrive < 0) {
+            pwmDrive -= minPWM;
+        } else if (pwmDrive > 0) {
+            pwmDrive += minPWM;
+        }
+        if (pwmDrive > highPWM) {
+            pwmDrive = highPWM;
+        } else if (pwmDrive < -highPWM) {
+            pwmDrive = -highPWM;
+        }
+        return pwmDrive;
+    }
+
+    void reset()
+    {
+        integral = 0.0f;
+        actualRate = 0.0f;
+        haveLast = false;
+    }
+
+    float getIntegral() const { return integral; }
+    float getActualRate() const { return actualRate; }
+
+private:
+    float integral = 0.0f;
+    float lastActual = 0.0f;
+    float actualRate = 0.0f;   // Filtered d(actual)/dt
+    bool haveLast = false;
+};
+
+#endif // STEER_CONTROLLER_H
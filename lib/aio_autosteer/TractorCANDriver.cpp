@@ -6,6 +6,7 @@
 
 // TractorCANDriver.cpp - Unified CAN driver implementation
 #include "TractorCANDriver.h"
+#include "LatencyTrace.h"
 
 bool TractorCANDriver::init() {
     // Load configuration from EEPROM
@@ -272,6 +273,8 @@ void TractorCANDriver::sendSteerCommands() {
 void TractorCANDriver::processKeyaMessage(const CAN_message_t& msg) {
     // Check for heartbeat message (ID: 0x07000001)
     if (msg.id == 0x07000001 && msg.flags.extended) {
+        heartbeatTraceCycles = LatencyTrace::stamp();
+
         // Heartbeat format (big-endian/MSB first):
         // Bytes 0-1: Position/Angle (uint16)
         // Bytes 2-3: Speed/RPM (int16)
@@ -59,6 +59,7 @@ private:
     uint16_t motorErrorCode = 0;
     bool heartbeatValid = false;
     uint32_t lastHeartbeat = 0;
+    uint32_t heartbeatTraceCycles = 0;  // LatencyTrace stamp of the newest unconsumed heartbeat
 
     // Command alternation for Keya
     enum CommandState {
@@ -135,6 +136,7 @@ public:
     void setPWM(int16_t pwm) override;
     void stop() override;
     void process() override;
+    bool supportsControlLane() const override { return true; }  // setPWM only stores the target
     MotorStatus getStatus() const override;
 
     // Configuration
@@ -170,6 +172,13 @@ public:
     // Fendt-specific methods
     bool isFendtButtonPressed() const { return fendtButtonPressed; }
 
+    // LatencyTrace stamp of the newest Keya heartbeat, 0 if already taken
+    uint32_t takeHeartbeatTrace() {
+        uint32_t cycles = heartbeatTraceCycles;
+        heartbeatTraceCycles = 0;
+        return cycles;
+    }
+
     // Case IH-specific methods
     bool isCaseIHEngaged() const { return caseIHEngaged; }
 
@@ -0,0 +1,171 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// ESP32BridgeFramer.h
+// Streaming deframer for the ESP32 bridge's serial stream: AgOpenGPS PGNs
+// ([0x80][0x81][Source][PGN][Length][Data...][CRC], so length-prefixed)
+// with "ESP32-hello" announcements between them. Input may be split
+// anywhere and is consumed a block at a time; each byte is looked at a
+// bounded number of times. A frame is handed on only when its checksum
+// matches - the AgOpenGPS sum of Source..Data, or the XOR of 0x80..Data the
+// bridge spec documents. After a bad header or checksum the search restarts
+// at the byte after the false 0x80, so a real frame inside the rejected
+// bytes is still found. Header-only with no Arduino dependencies.
+
+#ifndef ESP32_BRIDGE_FRAMER_H
+#define ESP32_BRIDGE_FRAMER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+namespace ESP32Bridge {
+
+static constexpr uint8_t SYNC1 = 0x80;
+static constexpr uint8_t SYNC2 = 0x81;
+static constexpr uint16_t HEADER_SIZE = 5;  // Sync, source, PGN, length
+static constexpr uint16_t MAX_FRAME = HEADER_SIZE + 255 + 1;
+static constexpr char HELLO[] = "ESP32-hello";
+static constexpr uint8_t HELLO_LENGTH = sizeof(HELLO) - 1;
+
+// True when frame[length - 1] is either checksum the bridge may send
+inline bool checksumValid(const uint8_t* frame, uint16_t length)
+{
+    uint8_t sum = 0;
+    uint8_t x = 0;
+    for (uint16_t i = 0; i < length - 1; i++) {
+        if (i >= 2) sum += frame[i];
+        x ^= frame[i];
+    }
+    return frame[length - 1] == sum || frame[length - 1] == x;
+}
+
+class Framer {
+public:
+    uint32_t validFrames = 0;
+    uint32_t badCRC = 0;
+    uint32_t resyncs = 0;       // Frames abandoned: bad header or checksum, or cut off
+    uint32_t skippedBytes = 0;  // Bytes outside any valid frame or hello
+    uint32_t hellos = 0;
+
+    // Calls onFrame(frame, length) for every complete frame whose checksum
+    // matches and onHello() for every "ESP32-hello" between frames
+    template <typename OnFrame, typename OnHello>
+    void feed(const uint8_t* data, size_t length, OnFrame&& onFrame, OnHello&& onHello)
+    {
+        for (;;) {
+            if (have == 0) {
+                // Between frames: only a 0x80 starts one, the rest may be hello
+                const uint8_t* start = (const uint8_t*)memchr(data, SYNC1, length);
+                size_t skip = start ? (size_t)(start - data) : length;
+                between(data, skip, onHello);
+                if (!start) return;
+                skippedBytes += helloMatched;  // A hello cut short by a frame
+                helloMatched = 0;
+                data = start;
+                length -= skip;
+                need = HEADER_SIZE;
+            }
+
+            if (have < need) {
+                uint16_t want = need - have;
+                uint16_t take = length < want ? (uint16_t)length : want;
+                memcpy(buffer + have, data, take);
+                have += take;
+                data += take;
+                length -= take;
+                if (have < need) {
+                    // A lone 0x80 can't wait for a header that isn't 0x81
+                    if (have >= 2 && buffer[1] != SYNC2) {
+                        resyncs++;
+                        drop(1, onHello);
+                        continue;
+                    }
+                    return;
+                }
+            }
+
+            if (need == HEADER_SIZE) {
+                if (buffer[1] != SYNC2) {
+                    resyncs++;
+                    drop(1, onHello);
+                } else {
+                    need = HEADER_SIZE + buffer[4] + 1;
+                }
+                continue;
+            }
+
+            if (checksumValid(buffer, need)) {
+                validFrames++;
+                onFrame((const uint8_t*)buffer, need);
+                have = 0;
+                need = HEADER_SIZE;
+            } else {
+                badCRC++;
+                resyncs++;
+                drop(1, onHello);
+            }
+        }
+    }
+
+    // Drops a partial frame (e.g. the bridge went quiet mid-frame)
+    void reset()
+    {
+        if (have > 0) resyncs++;
+        skippedBytes += have;
+        have = 0;
+        need = HEADER_SIZE;
+        helloMatched = 0;
+    }
+    uint16_t pending() const { return have; }
+
+private:
+    uint8_t buffer[MAX_FRAME];
+    uint16_t have = 0;
+    uint16_t need = HEADER_SIZE;
+    uint8_t helloMatched = 0;
+
+    // Bytes outside a frame: match the hello across calls, count the rest
+    template <typename OnHello>
+    void between(const uint8_t* data, size_t length, OnHello& onHello)
+    {
+        for (size_t i = 0; i < length; i++) {
+            if (data[i] == (uint8_t)HELLO[helloMatched]) {
+                if (++helloMatched == HELLO_LENGTH) {
+                    helloMatched = 0;
+                    hellos++;
+                    onHello();
+                }
+            } else {
+                skippedBytes += helloMatched;
+                helloMatched = data[i] == (uint8_t)HELLO[0] ? 1 : 0;
+                skippedBytes += 1 - helloMatched;
+            }
+        }
+    }
+
+    // Discards count bytes from the front, then anything up to the next
+    // buffered 0x80. Bytes after a false 0x80 may hold a frame or a hello.
+    template <typename OnHello>
+    void drop(uint16_t count, OnHello& onHello)
+    {
+        const uint8_t* next = have > count ? (const uint8_t*)memchr(buffer + count, SYNC1, have - count) : nullptr;
+        uint16_t keep = next ? have - (uint16_t)(next - buffer) : 0;
+        skippedBytes += count;
+        between(buffer + count, have - keep - count, onHello);
+        if (keep > 0) {
+            skippedBytes += helloMatched;
+            helloMatched = 0;
+        }
+        memmove(buffer, buffer + (have - keep), keep);
+        have = keep;
+        need = HEADER_SIZE;
+    }
+};
+
+} // namespace ESP32Bridge
+
+#endif // ESP32_BRIDGE_FRAMER_H
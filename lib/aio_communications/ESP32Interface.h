@@ -9,6 +9,7 @@
 
 #include <Arduino.h>
 #include "EventLogger.h"
+#include "ESP32BridgeFramer.h"
 
 /**
  * ESP32Interface - Transparent serial-to-WiFi bridge for ESP32 module
@@ -17,8 +18,25 @@
  * - UDP8888 packets are forwarded to ESP32 via serial
  * - ESP32 serial data is broadcast on UDP9999
  * - ESP32 announces presence with "ESP32-hello"
+ *
+ * Serial input is read in blocks and deframed by ESP32Bridge::Framer, which
+ * checks each PGN's checksum and resynchronises after garbage. Outbound
+ * PGNs are collected during the loop pass and written in one go from
+ * process(); a PGN that doesn't fit whole is dropped, never cut.
  */
 class ESP32Interface {
+public:
+    struct Stats {
+        uint32_t rxBytes;
+        uint32_t rxOverflows;     // Serial RX buffer found full - the UART dropped bytes
+        uint32_t txFrames;
+        uint32_t txBytes;
+        uint32_t txDropped;       // Didn't fit in the TX batch
+        uint16_t txPeak;          // Most bytes waiting in the TX batch
+        uint32_t rxBytesPerSec;   // Over the last second
+        uint32_t txBytesPerSec;
+    };
+
 private:    
     // Detection state
     bool esp32Detected = false;
@@ -27,14 +45,29 @@ private:
 
     // Serial configuration handled by SerialManager (BAUD_ESP32 = 460800)
 
-    // Receive buffer for serial data
-    static constexpr size_t RX_BUFFER_SIZE = 512;
-    uint8_t rxBuffer[RX_BUFFER_SIZE];
-    size_t rxBufferIndex = 0;
+    static constexpr uint16_t RX_BLOCK_SIZE = 128;
+    static constexpr uint16_t RX_DRAIN_BUDGET = 2048;        // Bytes per process() call
+    static constexpr uint32_t PARTIAL_FRAME_TIMEOUT_MS = 100;  // Bridge went quiet mid-frame
+    
+    ESP32Bridge::Framer framer;
+    uint32_t lastRxTime = 0;
+    
+    // PGNs from UDP 8888 waiting for the next process()
+    static constexpr size_t TX_BATCH_SIZE = 1024;
+    uint8_t txBatch[TX_BATCH_SIZE];
+    size_t txBatchUsed = 0;
+    
+    Stats stats = {};
+    uint32_t rateSampleTime = 0;
+    uint32_t rxBytesAtSample = 0;
+    uint32_t txBytesAtSample = 0;
     
     // Helper methods
     void processIncomingData();
-    void checkForHello();
+    void handleFrame(const uint8_t* frame, uint16_t length);
+    void handleHello();
+    void flushTx();
+    void updateRates();
     
 public:
     ESP32Interface() = default;
@@ -44,11 +77,15 @@ public:
     void init();
     void process();  // Called from main loop
     
-    // Send data to ESP32
+    // Queue data for the ESP32; sent from the next process()
     void sendToESP32(const uint8_t* data, size_t length);
+    bool hasPendingTx() const { return txBatchUsed > 0; }
     
     // Status
     bool isDetected() const { return esp32Detected; }
+    const Stats& getStats() const { return stats; }
+    const ESP32Bridge::Framer& getFramer() const { return framer; }
+    void resetStats();
     void printStatus();
 };
 
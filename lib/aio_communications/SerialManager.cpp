@@ -321,8 +321,7 @@ void SerialManager::updateBufferStats()
     if (radioAvail > radioRxStats.peakUsage) {
         radioRxStats.peakUsage = radioAvail;
     }
-    // Radio buffer is only 64 bytes
-    if (radioAvail > 48) {
+    if (radioAvail > RADIO_BUFFER_SIZE * 3 / 4) {
         radioRxStats.overflowCount++;
     }
 
@@ -331,7 +330,7 @@ void SerialManager::updateBufferStats()
     if (esp32Avail > esp32RxStats.peakUsage) {
         esp32RxStats.peakUsage = esp32Avail;
     }
-    if (esp32Avail > 192) {
+    if (esp32Avail > ESP32_BUFFER_SIZE * 3 / 4) {
         esp32RxStats.overflowCount++;
     }
 
@@ -361,9 +360,9 @@ void SerialManager::printBufferUsage()
     LOG_INFO(EventSource::SYSTEM, "GPS2 RX: Peak=%u bytes (custom buf=128), overflows=%u",
              gps2RxStats.peakUsage, gps2RxStats.overflowCount);
 
-    // Radio - custom 64 byte RX buffer + core default
-    LOG_INFO(EventSource::SYSTEM, "Radio RX: Peak=%u bytes (custom buf=64), overflows=%u",
-             radioRxStats.peakUsage, radioRxStats.overflowCount);
+    // Radio - custom 2048 byte RX buffer + core default
+    LOG_INFO(EventSource::SYSTEM, "Radio RX: Peak=%u bytes (custom buf=%u), overflows=%u",
+             radioRxStats.peakUsage, RADIO_BUFFER_SIZE, radioRxStats.overflowCount);
 
     // ESP32 - custom 256 byte RX buffer + core default
     LOG_INFO(EventSource::SYSTEM, "ESP32 RX: Peak=%u bytes (custom buf=256), overflows=%u",
@@ -379,15 +378,15 @@ void SerialManager::printBufferUsage()
     if (gps1RxStats.peakUsage > 128 || gps2RxStats.peakUsage > 128) {
         LOG_WARNING(EventSource::SYSTEM, "GPS buffer peak exceeds custom 128 bytes - using core buffers!");
     }
-    if (radioRxStats.peakUsage > 64) {
-        LOG_WARNING(EventSource::SYSTEM, "Radio buffer peak exceeds custom 64 bytes - using core buffers!");
+    if (radioRxStats.peakUsage > RADIO_BUFFER_SIZE) {
+        LOG_WARNING(EventSource::SYSTEM, "Radio buffer peak exceeds custom %u bytes - using core buffers!", RADIO_BUFFER_SIZE);
     }
     if (esp32RxStats.peakUsage > 256) {
         LOG_WARNING(EventSource::SYSTEM, "ESP32 buffer peak exceeds custom 256 bytes - using core buffers!");
     }
 
     if (gps1RxStats.peakUsage <= 128 && gps2RxStats.peakUsage <= 128 &&
-        radioRxStats.peakUsage <= 64 && esp32RxStats.peakUsage <= 256) {
+        radioRxStats.peakUsage <= RADIO_BUFFER_SIZE && esp32RxStats.peakUsage <= 256) {
         LOG_INFO(EventSource::SYSTEM, "All buffers within custom sizes - core buffers may be reducible!");
     }
 }
\ No newline at end of file
@@ -27,13 +27,13 @@ private:
 
     // Private serial buffers (encapsulated, not global)
     uint8_t gps1RxBuffer[128];
-    uint8_t gps1TxBuffer[256];
+    uint8_t gps1TxBuffer[1024];   // Holds a whole RTCM frame so forwarding doesn't block
     uint8_t gps2RxBuffer[128];
-    uint8_t gps2TxBuffer[256];
-    uint8_t radioRxBuffer[64];
-    uint8_t rs232TxBuffer[256];
-    uint8_t esp32RxBuffer[256];
-    uint8_t esp32TxBuffer[256];
+    uint8_t gps2TxBuffer[1024];   // Whole RTCM frames when corrections fan out to GPS2
+    uint8_t radioRxBuffer[2048];  // ~180ms at 115200 - rides out loop stalls
+    uint8_t rs232TxBuffer[1024];  // Whole RTCM frames when corrections fan out to RS232
+    uint8_t esp32RxBuffer[1024];  // ~22ms at 460800
+    uint8_t esp32TxBuffer[1024];  // Takes a loop pass's batch of PGNs in one write
 
     // SerialIMU - owned by SerialManager
     HardwareSerial *serialIMU;
@@ -45,10 +45,11 @@ private:
 public:
     // Buffer sizes
     static const uint16_t GPS_BUFFER_SIZE = 128;
-    static const uint16_t GPS_TX_BUFFER_SIZE = 256;
-    static const uint16_t RADIO_BUFFER_SIZE = 64;
-    static const uint16_t RS232_BUFFER_SIZE = 256;
-    static const uint16_t ESP32_BUFFER_SIZE = 256;
+    static const uint16_t GPS_TX_BUFFER_SIZE = 1024;
+    static const uint16_t GPS1_TX_BUFFER_SIZE = 1024;
+    static const uint16_t RADIO_BUFFER_SIZE = 2048;
+    static const uint16_t RS232_BUFFER_SIZE = 1024;
+    static const uint16_t ESP32_BUFFER_SIZE = 1024;
 
     // Baud rates
     static const int32_t BAUD_GPS = 460800;
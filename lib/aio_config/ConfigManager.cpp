@@ -21,6 +21,9 @@ ConfigManager::ConfigManager()
 {
     instance = this;
     initialized = false;
+    memset(controlConfigs, 0, sizeof(controlConfigs));
+    controlConfigIndex = 0;
+    controlConfigVersion = 0;
     // Defer actual initialization until Serial is ready
 }
 
@@ -60,6 +63,38 @@ ConfigManager *ConfigManager::getInstance()
     return instance;
 }
 
+void ConfigManager::publishControlConfig()
+{
+    // Fill the slot readers are not using, then flip the index
+    uint8_t next = controlConfigIndex ^ 1;
+    ControlConfig &c = controlConfigs[next];
+    c.version = ++controlConfigVersion;
+    c.kp = kp;
+    c.highPWM = highPWM;
+    c.lowPWM = lowPWM;
+    c.minPWM = minPWM;
+    c.ackermanFix = ackermanFix;
+    c.steerControlMode = steerControlMode;
+    c.steerKi = steerKi;
+    c.steerKd = steerKd;
+    c.steerKff = steerKff;
+    c.steerAutoGains = steerAutoGains;
+    c.invertWAS = invertWAS;
+    c.motorDriveDirection = motorDriveDirection;
+    c.steerSwitch = steerSwitch;
+    c.steerButton = steerButton;
+    c.shaftEncoder = shaftEncoder;
+    c.pressureSensor = pressureSensor;
+    c.currentSensor = currentSensor;
+    c.pulseCountMax = pulseCountMax;
+    c.minSpeed = minSpeed;
+    c.currentThreshold = currentThreshold;
+    c.jdPWMEnabled = jdPWMEnabled;
+    c.insUseFusion = insUseFusion;
+    asm volatile("" ::: "memory");
+    controlConfigIndex = next;
+}
+
 // Static init method removed - use instance init() instead
 
 // EEPROM operations
@@ -118,6 +153,8 @@ void ConfigManager::saveSteerConfig()
     EEPROM.get(STEER_CONFIG_ADDR, verifyByte1);
     LOG_DEBUG(EventSource::CONFIG, "Steer config verification: wrote=0x%02X, read=0x%02X",
               configByte1, verifyByte1);
+
+    publishControlConfig();
 }
 
 void ConfigManager::loadSteerConfig()
@@ -152,6 +189,8 @@ void ConfigManager::loadSteerConfig()
     currentSensor = (configByte2 & 0x04) != 0;
     isUseYAxis = (configByte2 & 0x08) != 0;
     pwmBrakeMode = (configByte2 & 0x10) != 0;
+
+    publishControlConfig();
 }
 
 void ConfigManager::saveSteerSettings()
@@ -173,12 +212,32 @@ void ConfigManager::saveSteerSettings()
     EEPROM.put(addr, wasOffset);
     addr += sizeof(wasOffset);
     EEPROM.put(addr, ackermanFix);
+    addr += sizeof(ackermanFix);
+    EEPROM.put(addr, steerControlMode);
+    addr += sizeof(steerControlMode);
+    EEPROM.put(addr, steerKi);
+    addr += sizeof(steerKi);
+    EEPROM.put(addr, steerKd);
+    addr += sizeof(steerKd);
+    EEPROM.put(addr, steerKff);
+    addr += sizeof(steerKff);
+    EEPROM.put(addr, steerAutoGains);
+    addr += sizeof(steerAutoGains);
+    EEPROM.put(addr, actuatorGain);
+    addr += sizeof(actuatorGain);
+    EEPROM.put(addr, actuatorDeadband);
+    addr += sizeof(actuatorDeadband);
+    EEPROM.put(addr, actuatorLag);
+    addr += sizeof(actuatorLag);
+    EEPROM.put(addr, actuatorConfidence);
 
     // Verify the save
     uint8_t verifyHighPWM;
     EEPROM.get(STEER_SETTINGS_ADDR + sizeof(kp), verifyHighPWM);
     LOG_DEBUG(EventSource::CONFIG, "Steer settings verification: saved highPWM=%d, read back=%d",
               highPWM, verifyHighPWM);
+
+    publishControlConfig();
 }
 
 void ConfigManager::loadSteerSettings()
@@ -197,9 +256,40 @@ void ConfigManager::loadSteerSettings()
     EEPROM.get(addr, wasOffset);
     addr += sizeof(wasOffset);
     EEPROM.get(addr, ackermanFix);
-
-    LOG_DEBUG(EventSource::CONFIG, "Loaded steer settings: Kp=%.1f, High=%d, Low=%.1f, Min=%d",
-              kp, highPWM, lowPWM, minPWM);
+    addr += sizeof(ackermanFix);
+    EEPROM.get(addr, steerControlMode);
+    addr += sizeof(steerControlMode);
+    EEPROM.get(addr, steerKi);
+    addr += sizeof(steerKi);
+    EEPROM.get(addr, steerKd);
+    addr += sizeof(steerKd);
+    EEPROM.get(addr, steerKff);
+    addr += sizeof(steerKff);
+    uint8_t autoGainsByte;
+    EEPROM.get(addr, autoGainsByte);
+    addr += sizeof(steerAutoGains);
+    EEPROM.get(addr, actuatorGain);
+    addr += sizeof(actuatorGain);
+    EEPROM.get(addr, actuatorDeadband);
+    addr += sizeof(actuatorDeadband);
+    EEPROM.get(addr, actuatorLag);
+    addr += sizeof(actuatorLag);
+    EEPROM.get(addr, actuatorConfidence);
+
+    // Validate - boards saved before the controller settings read 0xFF here
+    setSteerControlMode(steerControlMode);
+    setSteerKi(steerKi);
+    setSteerKd(steerKd);
+    setSteerKff(steerKff);
+    steerAutoGains = (autoGainsByte == 1);
+    setActuatorEstimate(actuatorGain, actuatorDeadband, actuatorLag, actuatorConfidence);
+
+    LOG_DEBUG(EventSource::CONFIG, "Loaded steer settings: Kp=%.1f, High=%d, Low=%.1f, Min=%d, Mode=%d, Ki=%.1f, Kd=%.2f, Kff=%.2f",
+              kp, highPWM, lowPWM, minPWM, steerControlMode, steerKi, steerKd, steerKff);
+    LOG_DEBUG(EventSource::CONFIG, "Loaded actuator estimate: gain=%.3f deadband=%.1f lag=%.3f confidence=%.2f, auto gains=%d",
+              actuatorGain, actuatorDeadband, actuatorLag, actuatorConfidence, steerAutoGains);
+
+    publishControlConfig();
 }
 
 void ConfigManager::saveGPSConfig()
@@ -219,6 +309,14 @@ void ConfigManager::saveGPSConfig()
     EEPROM.put(addr, gpsProtocol);
     addr += sizeof(gpsProtocol);
     EEPROM.put(addr, serialRadioBaudRate);
+    addr += sizeof(serialRadioBaudRate);
+    EEPROM.put(addr, navEmitMode);
+    addr += sizeof(navEmitMode);
+    EEPROM.put(addr, rtcmOutputMask);
+    addr += sizeof(rtcmOutputMask);
+    EEPROM.put(addr, rtcmUdpIP);
+    addr += sizeof(rtcmUdpIP);
+    EEPROM.put(addr, rtcmUdpPort);
 }
 
 void ConfigManager::loadGPSConfig()
@@ -233,6 +331,14 @@ void ConfigManager::loadGPSConfig()
     EEPROM.get(addr, gpsProtocol);
     addr += sizeof(gpsProtocol);
     EEPROM.get(addr, serialRadioBaudRate);
+    addr += sizeof(serialRadioBaudRate);
+    EEPROM.get(addr, navEmitMode);
+    addr += sizeof(navEmitMode);
+    EEPROM.get(addr, rtcmOutputMask);
+    addr += sizeof(rtcmOutputMask);
+    EEPROM.get(addr, rtcmUdpIP);
+    addr += sizeof(rtcmUdpIP);
+    EEPROM.get(addr, rtcmUdpPort);
 
     gpsSyncMode = (gpsConfigByte & 0x01) != 0;
     gpsPassThrough = (gpsConfigByte & 0x02) != 0;
@@ -242,6 +348,15 @@ void ConfigManager::loadGPSConfig()
     {
         serialRadioBaudRate = 115200; // Default to 115200
     }
+
+    // Unwritten EEPROM reads 0xFF - falls back to auto, RTCM fan-out off
+    setNavEmitMode(navEmitMode);
+    setRTCMOutputMask(rtcmOutputMask);
+    setRTCMUdpPort(rtcmUdpPort);
+    if (rtcmOutputMask == 0 && rtcmUdpIP[0] == 0xFF)
+    {
+        memset(rtcmUdpIP, 0, sizeof(rtcmUdpIP));
+    }
 }
 
 void ConfigManager::saveMachineConfig()
@@ -371,6 +486,8 @@ void ConfigManager::saveINSConfig()
     EEPROM.put(addr, insVarianceRoll);
     addr += sizeof(insVarianceRoll);
     EEPROM.put(addr, insVariancePitch);
+
+    publishControlConfig();
 }
 
 void ConfigManager::loadINSConfig()
@@ -398,6 +515,8 @@ void ConfigManager::loadINSConfig()
 
     insEnabled = (insConfigByte & 0x01) != 0;
     insUseFusion = (insConfigByte & 0x02) != 0;
+
+    publishControlConfig();
 }
 
 void ConfigManager::loadAllConfigs()
@@ -459,6 +578,15 @@ void ConfigManager::resetToDefaults()
     steerSensorCounts = 30;
     wasOffset = 0;
     ackermanFix = 1.0;
+    steerControlMode = 0;  // P control, as AgOpenGPS expects
+    steerKi = 0.0f;
+    steerKd = 0.0f;
+    steerKff = 0.0f;
+    steerAutoGains = false;  // Identify only until the user opts in
+    actuatorGain = 0.0f;
+    actuatorDeadband = 0.0f;
+    actuatorLag = 0.0f;
+    actuatorConfidence = 0.0f;
 
     // GPS config defaults
     gpsBaudRate = 460800;
@@ -466,6 +594,10 @@ void ConfigManager::resetToDefaults()
     gpsPassThrough = false;
     gpsProtocol = 0;
     serialRadioBaudRate = 115200; // Default serial radio baud rate
+    navEmitMode = 1;              // Send PANDA/PAOGI as soon as a fix epoch completes
+    rtcmOutputMask = 0;           // Corrections to GPS1 only
+    memset(rtcmUdpIP, 0, sizeof(rtcmUdpIP));
+    rtcmUdpPort = 2234;
 
     // Machine config defaults
     sectionCount = 8;
@@ -506,6 +638,9 @@ void ConfigManager::resetToDefaults()
     // Buzzer defaults
     buzzerLoudMode = true; // Default to loud mode for field use
 
+    // Control lane defaults
+    controlLaneRateHz = 0; // Cooperative 100Hz autosteer until enabled
+
     // JD PWM defaults
     jdPWMSensitivity = 5; // Middle sensitivity
 
@@ -615,6 +750,8 @@ void ConfigManager::saveTurnSensorConfig()
     // Use the previously skipped byte for jdPWMSensitivity
     EEPROM.put(addr, jdPWMSensitivity);
     addr += sizeof(jdPWMSensitivity);
+
+    publishControlConfig();
 }
 
 void ConfigManager::loadTurnSensorConfig()
@@ -640,6 +777,8 @@ void ConfigManager::loadTurnSensorConfig()
 
     LOG_DEBUG(EventSource::CONFIG, "Loaded turn sensor config: Type=%d, EncoderType=%d, JDPWM=%d",
               turnSensorType, encoderType, jdPWMEnabled);
+
+    publishControlConfig();
 }
 
 void ConfigManager::saveAnalogWorkSwitchConfig()
@@ -684,8 +823,8 @@ void ConfigManager::loadAnalogWorkSwitchConfig()
 
 void ConfigManager::saveMiscConfig()
 {
-    LOG_DEBUG(EventSource::CONFIG, "Saving misc config: LED=%d%%, BuzzerLoud=%d, JD_PWM=%d",
-              ledBrightness, buzzerLoudMode, jdPWMSensitivity);
+    LOG_DEBUG(EventSource::CONFIG, "Saving misc config: LED=%d%%, BuzzerLoud=%d, JD_PWM=%d, ControlLane=%dHz",
+              ledBrightness, buzzerLoudMode, jdPWMSensitivity, controlLaneRateHz);
 
     int addr = MISC_CONFIG_ADDR;
     EEPROM.put(addr, ledBrightness);
@@ -693,6 +832,8 @@ void ConfigManager::saveMiscConfig()
     EEPROM.put(addr, buzzerLoudMode);
     addr += sizeof(buzzerLoudMode);
     EEPROM.put(addr, jdPWMSensitivity);
+    addr += sizeof(jdPWMSensitivity);
+    EEPROM.put(addr, controlLaneRateHz);
 }
 
 void ConfigManager::loadMiscConfig()
@@ -718,6 +859,8 @@ void ConfigManager::loadMiscConfig()
     }
 
     EEPROM.get(addr, jdPWMSensitivity);
+    addr += sizeof(jdPWMSensitivity);
+    EEPROM.get(addr, controlLaneRateHz);
 
     // Validate loaded values
     if (ledBrightness < 5 || ledBrightness > 100)
@@ -728,9 +871,11 @@ void ConfigManager::loadMiscConfig()
     {
         jdPWMSensitivity = 5; // Default
     }
+    // Unwritten EEPROM reads 0xFFFF - treat anything out of range as disabled
+    setControlLaneRateHz(controlLaneRateHz);
 
-    LOG_INFO(EventSource::CONFIG, "Loaded misc config from EEPROM: LED=%d%%, BuzzerLoud=%d, JD_PWM=%d",
-             ledBrightness, buzzerLoudMode, jdPWMSensitivity);
+    LOG_INFO(EventSource::CONFIG, "Loaded misc config from EEPROM: LED=%d%%, BuzzerLoud=%d, JD_PWM=%d, ControlLane=%dHz",
+             ledBrightness, buzzerLoudMode, jdPWMSensitivity, controlLaneRateHz);
 }
 
 void ConfigManager::saveNetworkConfig()
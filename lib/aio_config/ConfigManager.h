@@ -53,6 +53,49 @@ struct CANSteerConfig {
     uint8_t reserved[1];        // Future expansion
 };
 
+// Settings the control hot path reads on every tick, as one immutable
+// snapshot. ConfigManager rebuilds it whenever the steer config (PGN 251),
+// steer settings (PGN 252), turn sensor or INS config is loaded or saved -
+// the PGN handlers and the web pages save after every change - into the slot
+// readers are not using, then flips the index. version goes up on every
+// publish, so consumers fetch the pointer once per tick and compare versions
+// instead of keeping their own copies of the settings to spot changes.
+struct ControlConfig {
+    uint32_t version;
+
+    // PGN 252 steer settings
+    float kp;
+    uint8_t highPWM;
+    float lowPWM;
+    uint8_t minPWM;
+    float ackermanFix;
+
+    // Steering controller (Device Settings page)
+    uint8_t steerControlMode;
+    float steerKi;
+    float steerKd;
+    float steerKff;
+    bool steerAutoGains;
+
+    // PGN 251 steer config
+    bool invertWAS;
+    bool motorDriveDirection;
+    bool steerSwitch;
+    bool steerButton;
+    bool shaftEncoder;
+    bool pressureSensor;
+    bool currentSensor;
+    uint8_t pulseCountMax;
+    uint8_t minSpeed;            // 0.1 km/h
+
+    // Turn sensor
+    uint8_t currentThreshold;
+    bool jdPWMEnabled;
+
+    // INS
+    bool insUseFusion;
+};
+
 // ConfigManager Pattern for PGN Settings Access
 // ============================================
 // All runtime access to PGN settings should go through ConfigManager methods.
@@ -97,6 +140,15 @@ private:
     uint8_t steerSensorCounts;
     int16_t wasOffset;
     float ackermanFix;
+    uint8_t steerControlMode;    // SteerController::Mode: 0=P, 1=PID, 2=PID+feed-forward
+    float steerKi;               // PWM per degree-second
+    float steerKd;               // PWM per degree/s of wheel angle rate
+    float steerKff;              // PWM per degree/s of target angle rate
+    bool steerAutoGains;         // Use Kp/minPWM scheduled from the actuator estimate
+    float actuatorGain;          // Identified actuator: wheel deg/s per PWM past the deadband
+    float actuatorDeadband;      // PWM
+    float actuatorLag;           // s
+    float actuatorConfidence;    // 0..1, 0 = no estimate saved
 
     // GPS configuration (EEPROM 400-499)
     uint32_t gpsBaudRate;
@@ -104,6 +156,10 @@ private:
     bool gpsPassThrough;
     uint8_t gpsProtocol;
     uint32_t serialRadioBaudRate;  // RTK radio baud rate (4800-921600)
+    uint8_t navEmitMode;           // PANDA/PAOGI trigger: 0=10Hz poll, 1=auto, 2=GGA+VTG, 3=GGA+dual, 4=INS
+    uint8_t rtcmOutputMask;        // RTCM fan-out: bit 0=GPS2, 1=RS232, 2=UDP
+    uint8_t rtcmUdpIP[4];          // 0.0.0.0 = module broadcast address
+    uint16_t rtcmUdpPort;
 
     // Machine settings (EEPROM 500-599)
     uint8_t sectionCount;
@@ -144,6 +200,9 @@ private:
     // Buzzer settings
     bool buzzerLoudMode;         // true = loud for field use, false = quiet for development
     
+    // Control lane (hardware timer autosteer)
+    uint16_t controlLaneRateHz;  // 0 = cooperative 100Hz loop, 100-1000 = timer ISR rate
+    
     // Turn sensor configuration
     uint8_t turnSensorType;      // 0=None, 1=Encoder, 2=Pressure, 3=Current, 4=JD PWM
     uint8_t encoderType;         // 1=Single, 2=Quadrature
@@ -179,6 +238,11 @@ private:
     // Initialization tracking
     bool initialized;
 
+    // Hot path snapshot, see ControlConfig
+    ControlConfig controlConfigs[2];
+    volatile uint8_t controlConfigIndex;
+    uint32_t controlConfigVersion;
+
 public:
     ConfigManager();
     ~ConfigManager();
@@ -187,6 +251,12 @@ public:
     static ConfigManager *getInstance();
     void init();
 
+    // Hot path settings snapshot. The pointer stays valid and unchanged until
+    // the next publish; call publishControlConfig() after changing a setting
+    // it holds without saving it.
+    const ControlConfig *getControlConfig() const { return &controlConfigs[controlConfigIndex]; }
+    void publishControlConfig();
+
     // Steer configuration methods
     bool getInvertWAS() const { return invertWAS; }
     void setInvertWAS(bool value) { invertWAS = value; }
@@ -238,6 +308,34 @@ public:
     void setWasOffset(int16_t value) { wasOffset = value; }
     float getAckermanFix() const { return ackermanFix; }
     void setAckermanFix(float value) { ackermanFix = value; }
+    
+    // Steering controller (Kp, highPWM and minPWM come from PGN 252)
+    // Out of range or NaN (unwritten EEPROM) falls back to P control / zero gain
+    uint8_t getSteerControlMode() const { return steerControlMode; }
+    void setSteerControlMode(uint8_t value) { steerControlMode = (value <= 2) ? value : 0; }
+    float getSteerKi() const { return steerKi; }
+    void setSteerKi(float value) { steerKi = (value >= 0.0f && value <= 100.0f) ? value : 0.0f; }
+    float getSteerKd() const { return steerKd; }
+    void setSteerKd(float value) { steerKd = (value >= 0.0f && value <= 20.0f) ? value : 0.0f; }
+    float getSteerKff() const { return steerKff; }
+    void setSteerKff(float value) { steerKff = (value >= 0.0f && value <= 20.0f) ? value : 0.0f; }
+
+    // Actuator identification (see ActuatorEstimator). An out of range value
+    // clears the whole estimate, so unwritten EEPROM loads as "none saved"
+    bool getSteerAutoGains() const { return steerAutoGains; }
+    void setSteerAutoGains(bool value) { steerAutoGains = value; }
+    float getActuatorGain() const { return actuatorGain; }
+    float getActuatorDeadband() const { return actuatorDeadband; }
+    float getActuatorLag() const { return actuatorLag; }
+    float getActuatorConfidence() const { return actuatorConfidence; }
+    void setActuatorEstimate(float gain, float deadband, float lag, float confidence) {
+        bool valid = gain > 0.0f && gain <= 10.0f && deadband >= 0.0f && deadband <= 255.0f &&
+                     lag > 0.0f && lag <= 2.0f && confidence > 0.0f && confidence <= 1.0f;
+        actuatorGain = valid ? gain : 0.0f;
+        actuatorDeadband = valid ? deadband : 0.0f;
+        actuatorLag = valid ? lag : 0.0f;
+        actuatorConfidence = valid ? confidence : 0.0f;
+    }
 
     // LED configuration
     uint8_t getLEDBrightness() const { return ledBrightness; }
@@ -249,6 +347,12 @@ public:
     bool getBuzzerLoudMode() const { return buzzerLoudMode; }
     void setBuzzerLoudMode(bool value) { buzzerLoudMode = value; }
     
+    // Control lane configuration
+    uint16_t getControlLaneRateHz() const { return controlLaneRateHz; }
+    void setControlLaneRateHz(uint16_t value) {
+        controlLaneRateHz = (value >= 100 && value <= 1000) ? value : 0;
+    }
+    
     // GPS configuration methods
     uint32_t getGPSBaudRate() const { return gpsBaudRate; }
     void setGPSBaudRate(uint32_t value) { gpsBaudRate = value; }
@@ -260,6 +364,14 @@ public:
     void setGPSProtocol(uint8_t value) { gpsProtocol = value; }
     uint32_t getSerialRadioBaudRate() const { return serialRadioBaudRate; }
     void setSerialRadioBaudRate(uint32_t value) { serialRadioBaudRate = value; }
+    uint8_t getNavEmitMode() const { return navEmitMode; }
+    void setNavEmitMode(uint8_t value) { navEmitMode = (value <= 4) ? value : 1; }
+    uint8_t getRTCMOutputMask() const { return rtcmOutputMask; }
+    void setRTCMOutputMask(uint8_t value) { rtcmOutputMask = (value <= 0x07) ? value : 0; }
+    void getRTCMUdpIP(uint8_t ip[4]) const { memcpy(ip, rtcmUdpIP, 4); }
+    void setRTCMUdpIP(const uint8_t ip[4]) { memcpy(rtcmUdpIP, ip, 4); }
+    uint16_t getRTCMUdpPort() const { return rtcmUdpPort; }
+    void setRTCMUdpPort(uint16_t value) { rtcmUdpPort = (value != 0 && value != 0xFFFF) ? value : 2234; }
 
     // Machine configuration methods
     uint8_t getSectionCount() const { return sectionCount; }
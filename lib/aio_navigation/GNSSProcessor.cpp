@@ -7,8 +7,10 @@
 #include "GNSSProcessor.h"
 #include "UBXParser.h"
 #include "calc_crc32.h"
+#include "NMEAScanner.h"
 #include "PGNUtils.h"
 #include "EventLogger.h"
+#include "LatencyTrace.h"
 #include "QNetworkBase.h"
 #include "ConfigManager.h"
 #include <string.h>
@@ -27,19 +29,32 @@ GNSSProcessor::GNSSProcessor() : bufferIndex(0),
                                  udpPassthroughEnabled(false),
                                  processingPaused(false),
                                  lastGGALatitude(0.0),
-                                 lastGGALongitude(0.0)
+                                 lastGGALongitude(0.0),
+                                 epochTrigger(EPOCH_POLLED),
+                                 epochSeen(0),
+                                 epochStartMicros(0),
+                                 lastMessageMicros(0),
+                                 epochCallback(nullptr),
+                                 sentenceTraceCycles(0),
+                                 epochTraceCycles(0),
+                                 ubxFrameTraceCycles(0),
+                                 ubxEpochTraceCycles(0),
+                                 ubxEpochInvalid(0),
+                                 lastGPS1PositionMillis(0)
 {
+    static_assert(UnicoreBinary::MAX_FRAME < sizeof(parseBuffer), "parseBuffer too small for Unicore binary frames");
 
     // Initialize data structures
     memset(&gpsData, 0, sizeof(gpsData));
+    memset(&ingestStats, 0, sizeof(ingestStats));
     // Initialize data
 
     gpsData.hdop = 99.9f;
     gpsData.fixTimeFractional = 0.0f;
     
     // Initialize NMEA coordinate cache with valid defaults
-    gpsData.latitudeNMEA = 0.0;
-    gpsData.longitudeNMEA = 0.0;
+    gpsData.latitudeNMEA = {0, 6};
+    gpsData.longitudeNMEA = {0, 6};
     gpsData.latDir = 'N';  // Default to North
     gpsData.lonDir = 'W';  // Default to West
     resetParser();
@@ -132,13 +147,26 @@ bool GNSSProcessor::processNMEAChar(char c)
         if (c == '$' || c == '#')
         {
             resetParser();
+            sentenceTraceCycles = LatencyTrace::stamp();
             state = READ_DATA;
             calculatedChecksum = 0;
             isUnicoreMessage = (c == '#');
             parseBuffer[bufferIndex++] = c;
         }
+        else if ((uint8_t)c == UnicoreBinary::SYNC1)
+        {
+            resetParser();
+            sentenceTraceCycles = LatencyTrace::stamp();
+            state = READ_BINARY;
+            binaryRemaining = UnicoreBinary::HEADER_SIZE - 1;
+            parseBuffer[bufferIndex++] = c;
+        }
         break;
 
+    case READ_BINARY:
+    case SKIP_BINARY:
+        return processBinaryByte((uint8_t)c);
+
     case READ_DATA:
         if (c == '*')
         {
@@ -167,6 +195,11 @@ bool GNSSProcessor::processNMEAChar(char c)
                     calculatedChecksum ^= c;
                 }
             }
+            else if (!parseOverflowed)
+            {
+                parseOverflowed = true;
+                ingestStats.parseOverflows++;
+            }
         }
         break;
 
@@ -303,15 +336,77 @@ uint16_t GNSSProcessor::processNMEAStream(const char *data, uint16_t length)
     if (processingPaused) {
         return 0;
     }
-    
+
+    ingestStats.bytes += length;
+    ingestStats.bursts++;
+    if (length > ingestStats.maxBurst) {
+        ingestStats.maxBurst = length;
+    }
+
     uint16_t processed = 0;
+    uint16_t i = 0;
 
-    for (uint16_t i = 0; i < length; i++)
+    while (i < length)
     {
+        if (state == WAIT_START)
+        {
+            // Skip noise between sentences a word at a time
+            i += NMEAScanner::findStart(data + i, length - i);
+            if (i >= length) break;
+        }
+        else if (state == READ_DATA)
+        {
+            // Bulk-copy the sentence body up to the next delimiter, folding the
+            // checksum from whole words instead of branching per character
+            uint8_t runChecksum = 0;
+            uint16_t run = NMEAScanner::scanBody(data + i, length - i, runChecksum);
+            uint16_t room = sizeof(parseBuffer) - 1 - bufferIndex;
+            uint16_t copy = run < room ? run : room;
+
+            memcpy(parseBuffer + bufferIndex, data + i, copy);
+            bufferIndex += copy;
+
+            if (copy < run)
+            {
+                // Match processNMEAChar(): dropped bytes don't count toward the checksum
+                runChecksum = NMEAScanner::xorBlock(data + i, copy);
+                if (!parseOverflowed)
+                {
+                    parseOverflowed = true;
+                    ingestStats.parseOverflows++;
+                }
+            }
+            if (!isUnicoreMessage)
+            {
+                calculatedChecksum ^= runChecksum;
+            }
+
+            i += run;
+            if (i >= length) break;
+        }
+        else if ((state == READ_BINARY && bufferIndex >= 3) || state == SKIP_BINARY)
+        {
+            // Binary frames have a known length - take all but the last byte
+            // in one go and leave that one to the state machine
+            uint16_t want = binaryRemaining - 1;
+            uint16_t run = want < length - i ? want : length - i;
+            if (state == READ_BINARY)
+            {
+                memcpy(parseBuffer + bufferIndex, data + i, run);
+                bufferIndex += run;
+            }
+            binaryRemaining -= run;
+
+            i += run;
+            if (i >= length) break;
+        }
+
+        // Sentence start, delimiters and checksum digits go through the state machine
         if (processNMEAChar(data[i]))
         {
             processed++;
         }
+        i++;
     }
 
     return processed;
@@ -324,9 +419,56 @@ void GNSSProcessor::resetParser()
     fieldCount = 0;
     checksumIndex = 0;
     isUnicoreMessage = false;
+    parseOverflowed = false;
+    binaryRemaining = 0;
     memset(parseBuffer, 0, sizeof(parseBuffer));
 }
 
+bool GNSSProcessor::processBinaryByte(uint8_t b)
+{
+    if (state == SKIP_BINARY)
+    {
+        if (--binaryRemaining == 0)
+        {
+            resetParser();
+        }
+        return false;
+    }
+
+    // AA 44 B5 - anything else was a stray 0xAA, so hand the byte back to the
+    // text state machine (it may be the '$' of the next sentence)
+    if (bufferIndex < 3)
+    {
+        const uint8_t expected = bufferIndex == 1 ? UnicoreBinary::SYNC2 : UnicoreBinary::SYNC3;
+        if (b != expected)
+        {
+            resetParser();
+            return processNMEAChar((char)b);
+        }
+    }
+
+    parseBuffer[bufferIndex++] = (char)b;
+    if (--binaryRemaining > 0)
+    {
+        return false;
+    }
+
+    if (bufferIndex == UnicoreBinary::HEADER_SIZE)
+    {
+        // Header complete - the body length decides whether we keep the frame
+        uint16_t bodyLength = UnicoreBinary::readU16((const uint8_t*)parseBuffer + UnicoreBinary::HDR_MSG_LENGTH);
+        binaryRemaining = bodyLength + UnicoreBinary::CRC_SIZE;
+        if (bodyLength > UnicoreBinary::MAX_BODY)
+        {
+            ingestStats.binarySkipped++;
+            state = SKIP_BINARY;
+        }
+        return false;
+    }
+
+    return processUnicoreBinary();
+}
+
 bool GNSSProcessor::validateChecksum()
 {
     if (isUnicoreMessage)
@@ -508,6 +650,22 @@ bool GNSSProcessor::processMessage()
     {
         // Valid GPS message received
         // Note: lastUpdateTime is now set by individual message parsers
+        if (type == MSG_GGA || type == MSG_GNS || type == MSG_KSXT ||
+            type == MSG_INSPVAA || type == MSG_INSPVAXA)
+        {
+            lastGPS1PositionMillis = millis();
+        }
+
+        switch (type) {
+            case MSG_GGA:      noteEpochMessage(0, sentenceTraceCycles); break;
+            case MSG_GNS:      noteEpochMessage(1, sentenceTraceCycles); break;
+            case MSG_VTG:      noteEpochMessage(2, sentenceTraceCycles); break;
+            case MSG_HPR:      noteEpochMessage(4, sentenceTraceCycles); break;
+            case MSG_KSXT:     noteEpochMessage(6, sentenceTraceCycles); break;
+            case MSG_INSPVAA:
+            case MSG_INSPVAXA: noteEpochMessage(7, sentenceTraceCycles); break;
+            default: break;
+        }
         
         // Debug log to track hasDualHeading status after each message
         static uint32_t lastTraceTime = 0;
@@ -528,6 +686,66 @@ bool GNSSProcessor::processMessage()
 
 
 
+void GNSSProcessor::noteEpochMessages(uint8_t bits, uint32_t traceCycles)
+{
+    uint32_t now = micros();
+    lastMessageMicros = now;
+
+    if (epochTrigger == EPOCH_POLLED || !epochCallback)
+    {
+        gpsData.traceCycles = traceCycles;
+        return;
+    }
+
+    // Anything left over from a previous, incomplete epoch is stale
+    if (epochSeen == 0 || now - epochStartMicros > EPOCH_WINDOW_US)
+    {
+        epochSeen = 0;
+        epochStartMicros = now;
+        epochTraceCycles = traceCycles;
+    }
+    epochSeen |= bits;
+    gpsData.traceCycles = epochTraceCycles;
+
+    if (isEpochComplete())
+    {
+        epochSeen = 0;
+        epochCallback(now);
+    }
+}
+
+bool GNSSProcessor::isEpochComplete() const
+{
+    const uint8_t POSITION = (1 << 0) | (1 << 1);  // GGA or GNS
+    const uint8_t VTG = (1 << 2);
+    const uint8_t HEADING = (1 << 3) | (1 << 4);   // RELPOSNED or HPR
+    const uint8_t KSXT = (1 << 6);
+    const uint8_t INSPVA = (1 << 7);
+
+    uint8_t trigger = epochTrigger;
+    if (trigger == EPOCH_AUTO)
+    {
+        if (gpsData.messageTypeMask & INSPVA)
+            trigger = EPOCH_INS;
+        else if (gpsData.hasDualHeading)
+            trigger = EPOCH_GGA_DUAL;
+        else
+            trigger = EPOCH_GGA_VTG;
+    }
+
+    switch (trigger)
+    {
+    case EPOCH_GGA_VTG:
+        return (epochSeen & POSITION) && (epochSeen & VTG);
+    case EPOCH_GGA_DUAL:
+        return (epochSeen & KSXT) || ((epochSeen & POSITION) && (epochSeen & HEADING));
+    case EPOCH_INS:
+        return (epochSeen & INSPVA) != 0;
+    default:
+        return false;
+    }
+}
+
 bool GNSSProcessor::parseKSXT()
 {
     if (fieldCount < 10)
@@ -556,20 +774,23 @@ bool GNSSProcessor::parseKSXT()
         }
     }
 
+    NMEACoordinate::Angle latNMEA = gpsData.latitudeNMEA;
+    NMEACoordinate::Angle lonNMEA = gpsData.longitudeNMEA;
+
     // Field 2: Longitude (decimal degrees)
     if (fieldRefs[2].length > 0)
     {
-        gpsData.longitude = parseDoubleZeroCopy(fieldRefs[2]);
+        gpsData.longitude = parseDegreesZeroCopy(fieldRefs[2], lonNMEA);
     }
 
     // Field 3: Latitude (decimal degrees)
     if (fieldRefs[3].length > 0)
     {
-        gpsData.latitude = parseDoubleZeroCopy(fieldRefs[3]);
+        gpsData.latitude = parseDegreesZeroCopy(fieldRefs[3], latNMEA);
     }
     
     // Cache NMEA format coordinates
-    cacheNMEACoordinates(gpsData.latitude, gpsData.longitude);
+    cacheNMEACoordinates(latNMEA, lonNMEA);
 
     // Field 4: Altitude
     if (fieldRefs[4].length > 0)
@@ -636,44 +857,22 @@ bool GNSSProcessor::parseKSXT()
 // Parsing utilities
 double GNSSProcessor::parseLatitude(const char *lat, const char *ns)
 {
-    if (!lat || !ns || strlen(lat) < 4)
+    if (!lat || !ns)
         return 0.0;
 
-    // Cache the original NMEA value and direction
-    gpsData.latitudeNMEA = atof(lat);
-    gpsData.latDir = ns[0];
-
-    double degrees = gpsData.latitudeNMEA / 100.0;
-    int wholeDegrees = (int)degrees;
-    double minutes = (degrees - wholeDegrees) * 100.0;
-
-    double result = wholeDegrees + (minutes / 60.0);
-
-    if (ns[0] == 'S')
-        result = -result;
-
-    return result;
+    FieldRef latRef = {lat, (uint8_t)strnlen(lat, 255)};
+    FieldRef nsRef = {ns, (uint8_t)strnlen(ns, 255)};
+    return parseLatitudeZeroCopy(latRef, nsRef);
 }
 
 double GNSSProcessor::parseLongitude(const char *lon, const char *ew)
 {
-    if (!lon || !ew || strlen(lon) < 5)
+    if (!lon || !ew)
         return 0.0;
 
-    // Cache the original NMEA value and direction
-    gpsData.longitudeNMEA = atof(lon);
-    gpsData.lonDir = ew[0];
-
-    double degrees = gpsData.longitudeNMEA / 100.0;
-    int wholeDegrees = (int)degrees;
-    double minutes = (degrees - wholeDegrees) * 100.0;
-
-    double result = wholeDegrees + (minutes / 60.0);
-
-    if (ew[0] == 'W')
-        result = -result;
-
-    return result;
+    FieldRef lonRef = {lon, (uint8_t)strnlen(lon, 255)};
+    FieldRef ewRef = {ew, (uint8_t)strnlen(ew, 255)};
+    return parseLongitudeZeroCopy(lonRef, ewRef);
 }
 
 float GNSSProcessor::parseFloat(const char *str)
@@ -743,6 +942,18 @@ void GNSSProcessor::logDebug(const char *msg)
     }
 }
 
+void GNSSProcessor::printIngestStats() const
+{
+    LOG_INFO(EventSource::GNSS, "GNSS ingest: %lu bytes in %lu bursts (avg %lu, max %u)",
+             ingestStats.bytes, ingestStats.bursts,
+             ingestStats.bursts ? ingestStats.bytes / ingestStats.bursts : 0,
+             ingestStats.maxBurst);
+    LOG_INFO(EventSource::GNSS, "GNSS ingest: parse overflows=%lu, RX saturations=%lu",
+             ingestStats.parseOverflows, ingestStats.rxSaturations);
+    LOG_INFO(EventSource::GNSS, "GNSS ingest: binary frames=%lu, bad CRC=%lu, skipped=%lu",
+             ingestStats.binaryFrames, ingestStats.binaryBadCRC, ingestStats.binarySkipped);
+}
+
 uint32_t GNSSProcessor::getDataAge() const
 {
     return millis() - gpsData.lastUpdateTime;
@@ -780,12 +991,136 @@ void GNSSProcessor::printData() const
 bool GNSSProcessor::processUBXByte(uint8_t b)
 {
     if (!ubxParser) return false;
-    
-    // Parse the UBX byte - parse() doesn't return a value, check relPosNedReady flag
+
+    // Same condition UBX_Parser uses to start a frame
+    if (b == 0xB5 && ubxParser->waitingForSync())
+    {
+        ubxFrameTraceCycles = LatencyTrace::stamp();
+    }
+
     ubxParser->parse(b);
-    
-    // Check if a new RELPOSNED message was received
-    if (ubxParser->relPosNedReady)
+    if (!ubxParser->frameReady || ubxParser->frameClass != UBXNav::CLASS_NAV)
+    {
+        return false;
+    }
+
+    // Decode straight from the parser's frame buffer
+    const uint8_t* payload = ubxParser->framePayload();
+    uint16_t length = (uint16_t)ubxParser->frameLength;
+
+    switch (ubxParser->frameId)
+    {
+    case UBXNav::ID_PVT:
+        return parseUBXNavPVT(payload, length);
+
+    case UBXNav::ID_HPPOSLLH:
+        return parseUBXNavHPPOSLLH(payload, length);
+
+    case UBXNav::ID_RELPOSNED:
+        return parseUBXNavRELPOSNED(payload, length);
+
+    case UBXNav::ID_EOE:
+        if (length >= UBXNav::EOE_LENGTH)
+        {
+            reportUBXEpoch(ubxEpoch.endOfEpoch(UBXNav::readU32(payload)));
+        }
+        return false;
+
+    default:
+        return false;
+    }
+}
+
+bool GNSSProcessor::ubxOwnsPosition() const
+{
+    // An F9P on GPS2 alone supplies position; with NMEA/Unicore on GPS1 it is
+    // the moving-base rover and only its RELPOSNED is wanted
+    return lastGPS1PositionMillis == 0 || millis() - lastGPS1PositionMillis > UBX_POSITION_HOLDOFF_MS;
+}
+
+bool GNSSProcessor::parseUBXNavPVT(const uint8_t* payload, uint16_t length)
+{
+    UBXNav::PVT pvt;
+    if (!UBXNav::decodePVT(payload, length, pvt) || !ubxOwnsPosition())
+    {
+        return false;
+    }
+
+    gpsData.fixQuality = UBXNav::fixQuality(pvt);
+    gpsData.numSatellites = pvt.numSV;
+    gpsData.hdop = pvt.pDOP * 0.01f;  // NAV-PVT only carries PDOP
+    gpsData.ageDGPS = UBXNav::correctionAgeSeconds(pvt.flags3);
+    gpsData.altitude = pvt.hMSL * 0.001f;
+    gpsData.posStdDevLat = pvt.hAcc * 0.001f;
+    gpsData.posStdDevLon = pvt.hAcc * 0.001f;
+    gpsData.posStdDevAlt = pvt.vAcc * 0.001f;
+
+    // HPPOSLLH has the finer position if it came first this epoch
+    if (!ubxEpoch.has(pvt.iTOW, UBXNav::EpochGrouper::MSG_HPPOSLLH))
+    {
+        setUBXPosition((int64_t)pvt.lat * 100, (int64_t)pvt.lon * 100, 7);
+    }
+
+    gpsData.northVelocity = pvt.velN * 0.001f;
+    gpsData.eastVelocity = pvt.velE * 0.001f;
+    gpsData.upVelocity = -pvt.velD * 0.001f;
+    gpsData.speedKnots = pvt.gSpeed * 0.001f * 1.94384f; // mm/s to knots
+    gpsData.headingTrue = pvt.headMot * 1e-5f;
+    gpsData.hasVelocity = true;
+
+    // UTC time of day, fraction from iTOW (leap seconds are whole)
+    gpsData.fixTime = pvt.hour * 10000 + pvt.min * 100 + pvt.sec;
+    gpsData.fixTimeFractional = (pvt.iTOW % 1000) / 1000.0f;
+    gpsData.gpsSeconds = pvt.iTOW / 1000.0f;
+
+    gpsData.messageTypeMask |= (1 << 0) | (1 << 2);  // Position and velocity, as GGA + VTG
+    addUBXEpoch(pvt.iTOW, UBXNav::EpochGrouper::MSG_PVT, true);
+
+    if (enableDebug)
+    {
+        LOG_DEBUG(EventSource::GNSS, "NAV-PVT: iTOW=%lu Lat=%.7f Lon=%.7f fix=%u sats=%u",
+                  pvt.iTOW, gpsData.latitude, gpsData.longitude, gpsData.fixQuality, gpsData.numSatellites);
+    }
+
+    return true;
+}
+
+bool GNSSProcessor::parseUBXNavHPPOSLLH(const uint8_t* payload, uint16_t length)
+{
+    UBXNav::HPPOSLLH hp;
+    if (!UBXNav::decodeHPPOSLLH(payload, length, hp) || !ubxOwnsPosition())
+    {
+        return false;
+    }
+
+    gpsData.altitude = hp.hMSL01 * 0.0001f;
+    gpsData.posStdDevLat = hp.hAcc * 0.0001f;
+    gpsData.posStdDevLon = hp.hAcc * 0.0001f;
+    gpsData.posStdDevAlt = hp.vAcc * 0.0001f;
+    setUBXPosition(hp.latNano, hp.lonNano, 9);
+
+    gpsData.messageTypeMask |= (1 << 0);  // Position, as GGA
+    addUBXEpoch(hp.iTOW, UBXNav::EpochGrouper::MSG_HPPOSLLH, true);
+
+    if (enableDebug)
+    {
+        LOG_DEBUG(EventSource::GNSS, "NAV-HPPOSLLH: iTOW=%lu Lat=%.9f Lon=%.9f hAcc=%.4f",
+                  hp.iTOW, gpsData.latitude, gpsData.longitude, gpsData.posStdDevLat);
+    }
+
+    return true;
+}
+
+bool GNSSProcessor::parseUBXNavRELPOSNED(const uint8_t* payload, uint16_t length)
+{
+    if (length < UBXNav::RELPOSNED_LENGTH)
+    {
+        return false;
+    }
+
+    // UBX_Parser has already checked the flags and worked out heading and roll
+    bool ready = ubxParser->relPosNedReady;
+    if (ready)
     {
         // Extract dual antenna heading and roll from RELPOSNED
         gpsData.dualHeading = ubxParser->ubxData.baseRelH;
@@ -802,11 +1137,52 @@ bool GNSSProcessor::processUBXByte(uint8_t b)
             LOG_DEBUG(EventSource::GNSS, "RELPOSNED: Heading=%.2f Roll=%.2f Quality=%d",
                      gpsData.dualHeading, gpsData.dualRoll, gpsData.headingQuality);
         }
-        
-        return true;
     }
-    
-    return false;
+
+    addUBXEpoch(UBXNav::readU32(payload + 4), UBXNav::EpochGrouper::MSG_RELPOSNED, ready);
+    return ready;
+}
+
+void GNSSProcessor::setUBXPosition(int64_t latNano, int64_t lonNano, uint8_t degreeDecimals)
+{
+    gpsData.latitude = latNano * 1e-9;
+    gpsData.longitude = lonNano * 1e-9;
+    gpsData.hasPosition = (latNano != 0 || lonNano != 0) && gpsData.fixQuality >= 1;
+    if (gpsData.hasPosition)
+    {
+        cacheNMEACoordinates(NMEACoordinate::fromNanoDegrees(latNano, degreeDecimals),
+                             NMEACoordinate::fromNanoDegrees(lonNano, degreeDecimals));
+    }
+    gpsData.isValid = gpsData.hasPosition;
+    gpsData.lastUpdateTime = millis();
+}
+
+void GNSSProcessor::addUBXEpoch(uint32_t iTOW, uint8_t msg, bool valid)
+{
+    if (ubxEpoch.isNewEpoch(iTOW))
+    {
+        ubxEpochTraceCycles = ubxFrameTraceCycles;
+        ubxEpochInvalid = 0;
+    }
+    if (!valid)
+    {
+        ubxEpochInvalid |= msg;
+    }
+    reportUBXEpoch(ubxEpoch.add(iTOW, msg));
+}
+
+void GNSSProcessor::reportUBXEpoch(uint8_t completed)
+{
+    // The whole iTOW epoch goes to the epoch logic at once
+    completed &= ~ubxEpochInvalid;
+    uint8_t bits = 0;
+    if (completed & (UBXNav::EpochGrouper::MSG_PVT | UBXNav::EpochGrouper::MSG_HPPOSLLH)) bits |= (1 << 0);
+    if (completed & UBXNav::EpochGrouper::MSG_PVT) bits |= (1 << 2);
+    if (completed & UBXNav::EpochGrouper::MSG_RELPOSNED) bits |= (1 << 3);
+    if (bits)
+    {
+        noteEpochMessages(bits, ubxEpochTraceCycles);
+    }
 }
 
 bool GNSSProcessor::parseINSPVAA()
@@ -826,22 +1202,25 @@ bool GNSSProcessor::parseINSPVAA()
         }
     }
     
+    NMEACoordinate::Angle latNMEA = gpsData.latitudeNMEA;
+    NMEACoordinate::Angle lonNMEA = gpsData.longitudeNMEA;
+    
     // Field 12: Latitude (degrees)
     if (fieldRefs[12].length > 0)
     {
-        gpsData.latitude = parseDoubleZeroCopy(fieldRefs[12]);
+        gpsData.latitude = parseDegreesZeroCopy(fieldRefs[12], latNMEA);
         gpsData.hasPosition = true;
     }
     
     // Field 13: Longitude (degrees)
     if (fieldRefs[13].length > 0)
     {
-        gpsData.longitude = parseDoubleZeroCopy(fieldRefs[13]);
+        gpsData.longitude = parseDegreesZeroCopy(fieldRefs[13], lonNMEA);
     }
     
     // Cache NMEA format coordinates
     if (gpsData.hasPosition) {
-        cacheNMEACoordinates(gpsData.latitude, gpsData.longitude);
+        cacheNMEACoordinates(latNMEA, lonNMEA);
     }
     
     // Field 14: Height (meters)
@@ -1079,10 +1458,13 @@ bool GNSSProcessor::parseINSPVAXA()
         }
     }
     
+    NMEACoordinate::Angle latNMEA = gpsData.latitudeNMEA;
+    NMEACoordinate::Angle lonNMEA = gpsData.longitudeNMEA;
+    
     // Field 12: Latitude (degrees)
     if (fieldRefs[12].length > 0)
     {
-        gpsData.latitude = parseDoubleZeroCopy(fieldRefs[12]);
+        gpsData.latitude = parseDegreesZeroCopy(fieldRefs[12], latNMEA);
         gpsData.hasPosition = insValid && 
                              (gpsData.latitude != 0.0 || gpsData.longitude != 0.0);
     }
@@ -1090,12 +1472,12 @@ bool GNSSProcessor::parseINSPVAXA()
     // Field 13: Longitude (degrees)
     if (fieldRefs[13].length > 0)
     {
-        gpsData.longitude = parseDoubleZeroCopy(fieldRefs[13]);
+        gpsData.longitude = parseDegreesZeroCopy(fieldRefs[13], lonNMEA);
     }
     
     // Cache NMEA format coordinates
     if (gpsData.hasPosition) {
-        cacheNMEACoordinates(gpsData.latitude, gpsData.longitude);
+        cacheNMEACoordinates(latNMEA, lonNMEA);
     }
     
     // Field 14: Height (meters)
@@ -1237,6 +1619,304 @@ bool GNSSProcessor::parseINSPVAXA()
     return true;
 }
 
+bool GNSSProcessor::processUnicoreBinary()
+{
+    const uint8_t* frame = (const uint8_t*)parseBuffer;
+    uint16_t bodyLength = UnicoreBinary::readU16(frame + UnicoreBinary::HDR_MSG_LENGTH);
+    uint16_t crcOffset = UnicoreBinary::HEADER_SIZE + bodyLength;
+
+    // CRC32 covers sync, header and body
+    if (CalculateCRC32(parseBuffer, crcOffset) != UnicoreBinary::readU32(frame + crcOffset))
+    {
+        ingestStats.binaryBadCRC++;
+        resetParser();
+        return false;
+    }
+    ingestStats.binaryFrames++;
+
+    // AgIO only takes text sentences, so binary logs can't be passed through
+    if (udpPassthroughEnabled)
+    {
+        resetParser();
+        return false;
+    }
+
+    const uint8_t* body = frame + UnicoreBinary::HEADER_SIZE;
+    bool processed = false;
+
+    switch (UnicoreBinary::readU16(frame + UnicoreBinary::HDR_MSG_ID))
+    {
+    case UnicoreBinary::MSG_BESTNAV:
+        if (bodyLength >= UnicoreBinary::BESTNAV_LENGTH && parseBESTNAVB(frame, body))
+        {
+            // One log stands in for GGA + VTG
+            noteEpochMessages((1 << 0) | (1 << 2), sentenceTraceCycles);
+            lastGPS1PositionMillis = millis();
+            processed = true;
+        }
+        break;
+
+    case UnicoreBinary::MSG_INSPVAX:
+        if (bodyLength >= UnicoreBinary::INSPVAX_LENGTH && parseINSPVAXB(frame, body))
+        {
+            noteEpochMessage(7, sentenceTraceCycles);
+            lastGPS1PositionMillis = millis();
+            processed = true;
+        }
+        break;
+
+    case UnicoreBinary::MSG_HEADING2:
+        if (bodyLength >= UnicoreBinary::HEADING2_LENGTH && parseHEADING2B(body))
+        {
+            noteEpochMessage(4, sentenceTraceCycles);
+            processed = true;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    resetParser();
+    return processed;
+}
+
+uint8_t GNSSProcessor::fixQualityFromPosType(uint32_t posType)
+{
+    // Unicore/NovAtel position type to GGA fix quality
+    switch (posType)
+    {
+    case 1:   // FIXEDPOS
+    case 16:  // SINGLE
+    case 52:  // INS
+    case 53:  // INS_PSRSP
+        return 1;
+    case 17:  // PSRDIFF
+    case 18:  // SBAS
+    case 54:  // INS_PSRDIFF
+        return 2;
+    case 32:  // L1_FLOAT
+    case 33:  // IONOFREE_FLOAT
+    case 34:  // NARROW_FLOAT
+    case 55:  // INS_RTKFLOAT
+        return 5;
+    case 48:  // L1_INT
+    case 49:  // WIDE_INT
+    case 50:  // NARROW_INT
+    case 56:  // INS_RTKFIXED
+        return 4;
+    default:  // NONE and anything we don't map
+        return 0;
+    }
+}
+
+void GNSSProcessor::setBinaryTime(const uint8_t* frame)
+{
+    // GPS week and ms of week from the frame header
+    uint32_t msOfWeek = UnicoreBinary::readU32(frame + UnicoreBinary::HDR_MS);
+    gpsData.gpsWeek = UnicoreBinary::readU16(frame + UnicoreBinary::HDR_WEEK);
+    gpsData.gpsSeconds = msOfWeek / 1000.0f;
+
+    // fixTime is UTC like GGA - take off the leap seconds the header carries
+    uint32_t leapMs = frame[UnicoreBinary::HDR_LEAP_SECONDS] * 1000UL;
+    uint32_t msOfDay = (msOfWeek + 7 * 86400000UL - leapMs) % 86400000UL;
+    uint32_t secs = msOfDay / 1000;
+    gpsData.fixTime = (secs / 3600) * 10000 + ((secs / 60) % 60) * 100 + secs % 60;
+    gpsData.fixTimeFractional = (msOfDay % 1000) / 1000.0f;
+}
+
+bool GNSSProcessor::parseBESTNAVB(const uint8_t* frame, const uint8_t* body)
+{
+    using namespace UnicoreBinary;
+
+    bool solComputed = readU32(body + BESTNAV_SOL_STATUS) == 0;
+    gpsData.posType = (uint8_t)readU32(body + BESTNAV_POS_TYPE);
+    gpsData.fixQuality = solComputed ? fixQualityFromPosType(gpsData.posType) : 0;
+
+    gpsData.latitude = readDouble(body + BESTNAV_LAT);
+    gpsData.longitude = readDouble(body + BESTNAV_LON);
+    gpsData.altitude = (float)readDouble(body + BESTNAV_HEIGHT);
+    gpsData.posStdDevLat = readFloat(body + BESTNAV_LAT_SIGMA);
+    gpsData.posStdDevLon = readFloat(body + BESTNAV_LON_SIGMA);
+    gpsData.posStdDevAlt = readFloat(body + BESTNAV_HGT_SIGMA);
+    gpsData.ageDGPS = (uint16_t)readFloat(body + BESTNAV_DIFF_AGE);
+    gpsData.numSatellites = body[BESTNAV_SVS_USED];
+    gpsData.hdop = 0.9f;  // BESTNAV carries sigmas, not DOP - same placeholder as INSPVAXA
+
+    gpsData.hasPosition = (gpsData.latitude != 0.0 || gpsData.longitude != 0.0) &&
+                          gpsData.fixQuality >= 1;
+    if (gpsData.hasPosition)
+    {
+        cacheNMEACoordinates(NMEACoordinate::fromDegrees(gpsData.latitude),
+                             NMEACoordinate::fromDegrees(gpsData.longitude));
+    }
+
+    // Velocity half of the log
+    if (readU32(body + BESTNAV_VEL_STATUS) == 0)
+    {
+        gpsData.speedKnots = (float)readDouble(body + BESTNAV_HOR_SPEED) * 1.94384f; // m/s to knots
+        gpsData.headingTrue = (float)readDouble(body + BESTNAV_TRACK);
+        gpsData.upVelocity = (float)readDouble(body + BESTNAV_VERT_SPEED);
+        gpsData.hasVelocity = true;
+    }
+
+    setBinaryTime(frame);
+
+    gpsData.isValid = gpsData.hasPosition;
+    gpsData.lastUpdateTime = millis();
+    gpsData.messageTypeMask |= (1 << 0) | (1 << 2);  // Position and velocity, as GGA + VTG
+
+    if (enableDebug)
+    {
+        LOG_DEBUG(EventSource::GNSS, "BESTNAVB: Lat=%.9f Lon=%.9f Alt=%.2f posType=%u fix=%u sats=%u",
+                  gpsData.latitude, gpsData.longitude, gpsData.altitude,
+                  gpsData.posType, gpsData.fixQuality, gpsData.numSatellites);
+    }
+
+    return true;
+}
+
+bool GNSSProcessor::parseINSPVAXB(const uint8_t* frame, const uint8_t* body)
+{
+    using namespace UnicoreBinary;
+
+    // Same INS status and position type mapping as parseINSPVAXA()
+    uint32_t insState = readU32(body + INSPVAX_INS_STATUS);
+    bool insValid = true;
+    switch (insState)
+    {
+    case 0:  // INS_INACTIVE
+        gpsData.insAlignmentStatus = 0;
+        gpsData.fixQuality = 0;
+        insValid = false;
+        break;
+    case 1:  // INS_ALIGNING
+        gpsData.insAlignmentStatus = 1;
+        gpsData.fixQuality = 1;
+        break;
+    case 2:  // INS_HIGH_VARIANCE
+        gpsData.insAlignmentStatus = 2;
+        gpsData.fixQuality = 2;
+        break;
+    case 3:  // INS_SOLUTION_GOOD
+        gpsData.insAlignmentStatus = 3;
+        gpsData.fixQuality = 4;
+        break;
+    case 6:  // INS_SOLUTION_FREE
+        gpsData.insAlignmentStatus = 6;
+        gpsData.fixQuality = 1;
+        break;
+    case 7:  // INS_ALIGNMENT_COMPLETE
+        gpsData.insAlignmentStatus = 7;
+        gpsData.fixQuality = 5;
+        break;
+    default:
+        gpsData.insAlignmentStatus = 0;
+        gpsData.fixQuality = 1;
+        break;
+    }
+
+    uint32_t posType = readU32(body + INSPVAX_POS_TYPE);
+    if (posType >= 52 && posType <= 56)  // INS .. INS_RTKFIXED
+    {
+        gpsData.posType = (uint8_t)posType;
+        gpsData.fixQuality = fixQualityFromPosType(posType);
+    }
+    else
+    {
+        gpsData.posType = 0;
+        if (insValid) gpsData.fixQuality = 1;
+    }
+
+    gpsData.latitude = readDouble(body + INSPVAX_LAT);
+    gpsData.longitude = readDouble(body + INSPVAX_LON);
+    gpsData.altitude = (float)readDouble(body + INSPVAX_HEIGHT);
+    gpsData.hasPosition = insValid && (gpsData.latitude != 0.0 || gpsData.longitude != 0.0);
+    if (gpsData.hasPosition)
+    {
+        cacheNMEACoordinates(NMEACoordinate::fromDegrees(gpsData.latitude),
+                             NMEACoordinate::fromDegrees(gpsData.longitude));
+    }
+
+    gpsData.northVelocity = (float)readDouble(body + INSPVAX_NORTH_VEL);
+    gpsData.eastVelocity = (float)readDouble(body + INSPVAX_EAST_VEL);
+    gpsData.upVelocity = (float)readDouble(body + INSPVAX_UP_VEL);
+    float speedMs = sqrt(gpsData.northVelocity * gpsData.northVelocity +
+                         gpsData.eastVelocity * gpsData.eastVelocity);
+    gpsData.speedKnots = speedMs * 1.94384f; // m/s to knots
+    gpsData.hasVelocity = true;
+
+    gpsData.insRoll = (float)readDouble(body + INSPVAX_ROLL);
+    gpsData.insPitch = (float)readDouble(body + INSPVAX_PITCH);
+    gpsData.insHeading = (float)readDouble(body + INSPVAX_AZIMUTH);
+
+    // For UM981, use INS heading/roll as dual antenna data
+    gpsData.dualHeading = gpsData.insHeading;
+    gpsData.dualRoll = gpsData.insRoll;
+    gpsData.hasDualHeading = true;
+
+    gpsData.posStdDevLat = readFloat(body + INSPVAX_LAT_SIGMA);
+    gpsData.posStdDevLon = readFloat(body + INSPVAX_LAT_SIGMA + 4);
+    gpsData.posStdDevAlt = readFloat(body + INSPVAX_LAT_SIGMA + 8);
+    gpsData.velStdDevNorth = readFloat(body + INSPVAX_VEL_SIGMA);
+    gpsData.velStdDevEast = readFloat(body + INSPVAX_VEL_SIGMA + 4);
+    gpsData.velStdDevUp = readFloat(body + INSPVAX_VEL_SIGMA + 8);
+    gpsData.extSolStatus = (uint16_t)readU32(body + INSPVAX_EXT_STATUS);
+    gpsData.timeSinceUpdate = readU16(body + INSPVAX_SINCE_UPDATE);
+    gpsData.ageDGPS = (uint16_t)gpsData.timeSinceUpdate;
+
+    // Not carried by INSPVAX - same placeholders as parseINSPVAXA()
+    gpsData.numSatellites = 12;
+    gpsData.hdop = 0.9f;
+    gpsData.insStatus = 1;
+
+    setBinaryTime(frame);
+
+    gpsData.hasINS = true;
+    gpsData.isValid = true;
+    gpsData.messageTypeMask |= (1 << 7);  // Set INSPVA bit
+    gpsData.lastUpdateTime = millis();
+
+    if (enableDebug)
+    {
+        LOG_DEBUG(EventSource::GNSS, "INSPVAXB: Lat=%.9f Lon=%.9f Hdg=%.1f Roll=%.1f status=%lu posType=%lu",
+                  gpsData.latitude, gpsData.longitude, gpsData.insHeading, gpsData.insRoll,
+                  insState, posType);
+    }
+
+    return true;
+}
+
+bool GNSSProcessor::parseHEADING2B(const uint8_t* body)
+{
+    using namespace UnicoreBinary;
+
+    // Like HPR: heading, and pitch used as roll for AgOpenGPS
+    if (readU32(body + HEADING2_SOL_STATUS) == 0)
+    {
+        gpsData.dualHeading = readFloat(body + HEADING2_HEADING);
+        gpsData.dualRoll = readFloat(body + HEADING2_PITCH);
+        gpsData.headingQuality = fixQualityFromPosType(readU32(body + HEADING2_POS_TYPE));
+    }
+    else
+    {
+        gpsData.headingQuality = 0;
+    }
+
+    gpsData.hasDualHeading = true;
+    gpsData.isValid = true;
+    // HEADING2 doesn't contain position data, so don't update lastUpdateTime
+    gpsData.messageTypeMask |= (1 << 4);  // Set HPR bit
+
+    if (enableDebug)
+    {
+        LOG_DEBUG(EventSource::GNSS, "HEADING2B: heading=%.2f roll=%.2f quality=%u sats=%u",
+                  gpsData.dualHeading, gpsData.dualRoll, gpsData.headingQuality, body[HEADING2_SVS_USED]);
+    }
+
+    return true;
+}
+
 // PGN Support Implementation
 
 // External reference to NetworkBase send function
@@ -1399,22 +2079,12 @@ GNSSProcessor::MessageType GNSSProcessor::detectMessageType(const char* msgType)
     return MSG_UNKNOWN;
 }
 
-void GNSSProcessor::cacheNMEACoordinates(double lat, double lon) {
-    // Convert decimal degrees to NMEA format for caching
-    
-    // Latitude
-    gpsData.latDir = (lat < 0) ? 'S' : 'N';
-    double absLat = fabs(lat);
-    int latDegrees = (int)absLat;
-    double latMinutes = (absLat - latDegrees) * 60.0;
-    gpsData.latitudeNMEA = latDegrees * 100.0 + latMinutes;
-    
-    // Longitude
-    gpsData.lonDir = (lon < 0) ? 'W' : 'E';
-    double absLon = fabs(lon);
-    int lonDegrees = (int)absLon;
-    double lonMinutes = (absLon - lonDegrees) * 60.0;
-    gpsData.longitudeNMEA = lonDegrees * 100.0 + lonMinutes;
+void GNSSProcessor::cacheNMEACoordinates(const NMEACoordinate::Angle& lat, const NMEACoordinate::Angle& lon) {
+    // Magnitudes come straight from the integer parse, only the hemisphere is derived
+    gpsData.latitudeNMEA = lat;
+    gpsData.latDir = (gpsData.latitude < 0) ? 'S' : 'N';
+    gpsData.longitudeNMEA = lon;
+    gpsData.lonDir = (gpsData.longitude < 0) ? 'W' : 'E';
 }
 
 void GNSSProcessor::parseFieldsZeroCopy() {
@@ -1497,15 +2167,13 @@ bool GNSSProcessor::fieldStartsWith(const FieldRef& field, const char* prefix) {
 double GNSSProcessor::parseLatitudeZeroCopy(const FieldRef& lat, const FieldRef& ns) {
     if (lat.length < 4 || ns.length < 1) return 0.0;
     
-    // Cache the original NMEA value and direction
-    gpsData.latitudeNMEA = parseDoubleZeroCopy(lat);
+    // Integer parse of DDMM.MMMM - the cached NMEA value keeps every receiver digit
+    NMEACoordinate::Angle angle;
+    if (!NMEACoordinate::parseDegMin(lat.start, lat.length, angle)) return 0.0;
+    gpsData.latitudeNMEA = angle;
     gpsData.latDir = ns.start[0];
     
-    double degrees = gpsData.latitudeNMEA / 100.0;
-    int wholeDegrees = (int)degrees;
-    double minutes = (degrees - wholeDegrees) * 100.0;
-    
-    double result = wholeDegrees + (minutes / 60.0);
+    double result = NMEACoordinate::toDegrees(angle);
     
     if (ns.start[0] == 'S')
         result = -result;
@@ -1516,15 +2184,13 @@ double GNSSProcessor::parseLatitudeZeroCopy(const FieldRef& lat, const FieldRef&
 double GNSSProcessor::parseLongitudeZeroCopy(const FieldRef& lon, const FieldRef& ew) {
     if (lon.length < 5 || ew.length < 1) return 0.0;
     
-    // Cache the original NMEA value and direction
-    gpsData.longitudeNMEA = parseDoubleZeroCopy(lon);
+    // Integer parse of DDDMM.MMMM - the cached NMEA value keeps every receiver digit
+    NMEACoordinate::Angle angle;
+    if (!NMEACoordinate::parseDegMin(lon.start, lon.length, angle)) return 0.0;
+    gpsData.longitudeNMEA = angle;
     gpsData.lonDir = ew.start[0];
     
-    double degrees = gpsData.longitudeNMEA / 100.0;
-    int wholeDegrees = (int)degrees;
-    double minutes = (degrees - wholeDegrees) * 100.0;
-    
-    double result = wholeDegrees + (minutes / 60.0);
+    double result = NMEACoordinate::toDegrees(angle);
     
     if (ew.start[0] == 'W')
         result = -result;
@@ -1532,6 +2198,18 @@ double GNSSProcessor::parseLongitudeZeroCopy(const FieldRef& lon, const FieldRef
     return result;
 }
 
+double GNSSProcessor::parseDegreesZeroCopy(const FieldRef& field, NMEACoordinate::Angle& nmea) {
+    // Signed decimal degrees (KSXT, INSPVA) - nmea gets the exact DDMM.MMMM magnitude
+    bool negative;
+    if (!NMEACoordinate::parseDegrees(field.start, field.length, nmea, negative)) {
+        nmea.nanoMinutes = 0;
+        return 0.0;
+    }
+    
+    double result = NMEACoordinate::toDegrees(nmea);
+    return negative ? -result : result;
+}
+
 bool GNSSProcessor::parseGGAZeroCopy() {
     if (fieldCount < 9)
         return false;
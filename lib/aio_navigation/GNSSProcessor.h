@@ -14,6 +14,9 @@
 #include <stdint.h>
 #include "PGNProcessor.h"
 #include "EventLogger.h"
+#include "NMEACoordinate.h"
+#include "UnicoreBinary.h"
+#include "UBXNav.h"
 
 // PGN Constants for GPS module
 constexpr uint8_t GPS_SOURCE_ID = 0x78;     // 120 decimal - GPS source address (from PGN.md GPS Reply)
@@ -36,9 +39,9 @@ public:
         uint32_t fixTime; // HHMMSS as integer
         float fixTimeFractional; // Fractional seconds (0.0-0.999)
         
-        // NMEA format cached coordinates (to avoid repeated conversions)
-        double latitudeNMEA;  // DDMM.MMMM format
-        double longitudeNMEA; // DDDMM.MMMM format
+        // NMEA format cached coordinates, exact receiver digits (integer, no float round trip)
+        NMEACoordinate::Angle latitudeNMEA;  // DDMM.MMMM magnitude
+        NMEACoordinate::Angle longitudeNMEA; // DDDMM.MMMM magnitude
         char latDir;          // 'N' or 'S'
         char lonDir;          // 'E' or 'W'
         
@@ -91,13 +94,43 @@ public:
         bool hasINS;            // Has INS data from INSPVAA/INSPVAXA
         
         // Message tracking (bit mask)
-        // Bit 0: GGA, Bit 1: VTG, Bit 2: GNS
-        // Bit 3: RELPOSNED, Bit 4: PVT
-        // Bit 5: HPR, Bit 6: KSXT
-        // Bit 7: INSPVA/INSPVAXA
+        // Bit 0: GGA/BESTNAVB, Bit 1: GNS, Bit 2: VTG/BESTNAVB
+        // Bit 3: RELPOSNED, Bit 4: HPR/HEADING2B
+        // Bit 6: KSXT, Bit 7: INSPVAA/INSPVAXA/INSPVAXB
         uint8_t messageTypeMask;
+
+        // LatencyTrace stamp of the first byte of the fix epoch behind this data
+        uint32_t traceCycles;
+    };
+
+    // Serial ingest counters (see processNMEAStream)
+    struct IngestStats
+    {
+        uint32_t bytes;           // Bytes handed to processNMEAStream
+        uint32_t bursts;          // processNMEAStream calls
+        uint16_t maxBurst;        // Largest single burst
+        uint32_t parseOverflows;  // Sentences truncated because parseBuffer was full
+        uint32_t rxSaturations;   // Drains that found the UART RX buffer full (bytes likely lost)
+        uint32_t binaryFrames;    // Unicore binary frames with a good CRC
+        uint32_t binaryBadCRC;    // Unicore binary frames with a bad CRC
+        uint32_t binarySkipped;   // Unicore binary logs too long to buffer (not ones we parse)
     };
 
+    // Fix epoch detection - which messages make up one navigation solution.
+    // Stored in ConfigManager as navEmitMode.
+    enum EpochTrigger : uint8_t
+    {
+        EPOCH_POLLED = 0,    // No detection - NAVProcessor sends on its 10Hz tick
+        EPOCH_AUTO = 1,      // INS, dual or single, from what the receiver sends
+        EPOCH_GGA_VTG = 2,   // Single antenna: GGA/GNS + VTG
+        EPOCH_GGA_DUAL = 3,  // Dual antenna: GGA/GNS + HPR/RELPOSNED, or KSXT alone
+        EPOCH_INS = 4        // UM981 INS: INSPVAA/INSPVAXA alone
+    };
+    static constexpr uint8_t EPOCH_TRIGGER_MAX = EPOCH_INS;
+
+    // Called from the GPS serial task when an epoch completes
+    typedef void (*EpochCallback)(uint32_t completeMicros);
+
     // UDP passthrough control
     void setUDPPassthrough(bool enabled) { 
         udpPassthroughEnabled = enabled; 
@@ -111,7 +144,9 @@ private:
     {
         WAIT_START,
         READ_DATA,
-        READ_CHECKSUM
+        READ_CHECKSUM,
+        READ_BINARY,    // Unicore binary frame, buffered in parseBuffer
+        SKIP_BINARY     // Unicore binary log we don't parse, counted past
     };
 
     // Parse buffer and state
@@ -123,6 +158,8 @@ private:
     uint32_t receivedChecksum32;  // For Unicore 32-bit CRC
     uint8_t checksumIndex;
     bool isUnicoreMessage;        // Track if current message starts with #
+    bool parseOverflowed;         // Current sentence no longer fits in parseBuffer
+    uint16_t binaryRemaining;     // Bytes until the binary header or frame is complete
 
     // Message type enum for fast detection
     enum MessageType {
@@ -159,7 +196,7 @@ private:
     double lastGGALongitude;
     bool enableDebug;
     
-    // UBX parser for GPS2 RELPOSNED
+    // UBX parser for GPS2 (RELPOSNED, and PVT/HPPOSLLH when GPS1 has no position)
     UBX_Parser* ubxParser;
     
     // UDP passthrough
@@ -168,6 +205,29 @@ private:
     // Processing control
     bool processingPaused;
 
+    IngestStats ingestStats;
+
+    // Fix epoch tracking (messageTypeMask bit numbers)
+    static constexpr uint32_t EPOCH_WINDOW_US = 50000;  // Sentences of one epoch arrive within a few ms
+    uint8_t epochTrigger;
+    uint8_t epochSeen;
+    uint32_t epochStartMicros;
+    uint32_t lastMessageMicros;
+    EpochCallback epochCallback;
+    uint32_t sentenceTraceCycles;  // Stamp of the current sentence's '$'/'#'
+    uint32_t epochTraceCycles;     // Stamp of the first sentence of the current epoch
+    void noteEpochMessage(uint8_t bit, uint32_t traceCycles) { noteEpochMessages(1 << bit, traceCycles); }
+    void noteEpochMessages(uint8_t bits, uint32_t traceCycles);
+    bool isEpochComplete() const;
+
+    // UBX NAV epoch tracking (GPS2)
+    UBXNav::EpochGrouper ubxEpoch;
+    uint32_t ubxFrameTraceCycles;   // Stamp of the current UBX frame's sync byte
+    uint32_t ubxEpochTraceCycles;   // Stamp of the first frame of the current iTOW
+    uint8_t ubxEpochInvalid;        // EpochGrouper messages that arrived unusable this epoch
+    static constexpr uint32_t UBX_POSITION_HOLDOFF_MS = 2000;
+    uint32_t lastGPS1PositionMillis;  // GPS1 position wins over UBX PVT/HPPOSLLH while fresh
+
     // Internal parsing methods
     void resetParser();
     bool validateChecksum();
@@ -182,6 +242,24 @@ private:
     bool parseKSXT();
     bool parseINSPVAA();
     bool parseINSPVAXA();
+
+    // Unicore binary logs - fixed layouts, no field splitting
+    bool processBinaryByte(uint8_t b);
+    bool processUnicoreBinary();
+    bool parseBESTNAVB(const uint8_t* frame, const uint8_t* body);
+    bool parseINSPVAXB(const uint8_t* frame, const uint8_t* body);
+    bool parseHEADING2B(const uint8_t* body);
+    void setBinaryTime(const uint8_t* frame);
+    static uint8_t fixQualityFromPosType(uint32_t posType);
+
+    // UBX NAV messages from GPS2 - decoded in place from UBX_Parser's frame
+    bool parseUBXNavPVT(const uint8_t* payload, uint16_t length);
+    bool parseUBXNavHPPOSLLH(const uint8_t* payload, uint16_t length);
+    bool parseUBXNavRELPOSNED(const uint8_t* payload, uint16_t length);
+    void setUBXPosition(int64_t latNano, int64_t lonNano, uint8_t degreeDecimals);
+    bool ubxOwnsPosition() const;
+    void addUBXEpoch(uint32_t iTOW, uint8_t msg, bool valid);
+    void reportUBXEpoch(uint8_t completed);
     
     // UDP passthrough
     void sendCompleteNMEA();
@@ -199,8 +277,8 @@ private:
     // Fast message type detection
     MessageType detectMessageType(const char* msgType);
     
-    // Convert decimal degrees to NMEA format and cache
-    void cacheNMEACoordinates(double lat, double lon);
+    // Cache NMEA format coordinates, hemispheres from the sign of latitude/longitude
+    void cacheNMEACoordinates(const NMEACoordinate::Angle& lat, const NMEACoordinate::Angle& lon);
     
     // Zero-copy string utilities
     float parseFloatZeroCopy(const FieldRef& field);
@@ -212,6 +290,7 @@ private:
     // Zero-copy coordinate parsers
     double parseLatitudeZeroCopy(const FieldRef& lat, const FieldRef& ns);
     double parseLongitudeZeroCopy(const FieldRef& lon, const FieldRef& ew);
+    double parseDegreesZeroCopy(const FieldRef& field, NMEACoordinate::Angle& nmea);
 
 public:
     GNSSProcessor();
@@ -229,9 +308,22 @@ public:
     bool processNMEAChar(char c);
     bool processUBXByte(uint8_t b);
 
-    // Batch processing
+    // Batch processing - scans sentence bodies a word at a time, so prefer
+    // this over processNMEAChar() when draining a UART in bursts
     uint16_t processNMEAStream(const char *data, uint16_t length);
 
+    // Fix epoch notification
+    void setEpochTrigger(uint8_t trigger) { epochTrigger = trigger <= EPOCH_TRIGGER_MAX ? trigger : EPOCH_POLLED; epochSeen = 0; }
+    uint8_t getEpochTrigger() const { return epochTrigger; }
+    void setEpochCallback(EpochCallback cb) { epochCallback = cb; }
+    uint32_t getLastMessageMicros() const { return lastMessageMicros; }  // micros() when the newest message was parsed
+
+    // Ingest diagnostics
+    void noteRxSaturated() { ingestStats.rxSaturations++; }
+    const IngestStats &getIngestStats() const { return ingestStats; }
+    void resetIngestStats() { memset(&ingestStats, 0, sizeof(ingestStats)); }
+    void printIngestStats() const;
+
     // Data access
     const GNSSData &getData() const { return gpsData; }
     bool isValid() const { return gpsData.isValid; }  // Deprecated - use hasFix()
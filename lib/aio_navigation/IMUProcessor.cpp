@@ -8,7 +8,9 @@
 #include "TM171AiOParser.h"
 #include "PGNUtils.h"
 #include "EventLogger.h"
+#include "LatencyTrace.h"
 #include "QNetworkBase.h"
+#include "QNEthernetUDPHandler.h"
 #include "ConfigManager.h"
 #include "SerialManager.h"
 
@@ -24,7 +26,7 @@ IMUProcessor::IMUProcessor()
     instance = this;
 
     // Initialize current data
-    currentData = {0, 0, 0, 0, 0, 0, false};
+    currentData = {0, 0, 0, 0, 0, 0, false, 0};
 }
 
 IMUProcessor::~IMUProcessor()
@@ -234,6 +236,8 @@ void IMUProcessor::processBNO085Data()
     while (imuSerial->available())
     {
         uint8_t byte = imuSerial->read();
+        if (!pendingTraceCycles)
+            pendingTraceCycles = LatencyTrace::stamp();
         serialDataReceived = true;
         lastSerialDataTime = millis();
         bnoParser->processByte(byte);
@@ -242,6 +246,12 @@ void IMUProcessor::processBNO085Data()
     // Update current data if valid
     if (bnoParser->isDataValid())
     {
+        if (pendingTraceCycles)
+        {
+            currentData.traceCycles = pendingTraceCycles;
+            pendingTraceCycles = 0;
+        }
+
         extern ConfigManager configManager;
 
         // Update current data
@@ -283,6 +293,8 @@ void IMUProcessor::processTM171Data()
     while (imuSerial->available())
     {
         uint8_t byte = imuSerial->read();
+        if (!pendingTraceCycles)
+            pendingTraceCycles = LatencyTrace::stamp();
         serialDataReceived = true;
         lastSerialDataTime = millis();
         tm171Parser->processByte(byte);
@@ -290,6 +302,9 @@ void IMUProcessor::processTM171Data()
         // Check if we have new valid data
         if (tm171Parser->isDataValid())
         {
+            currentData.traceCycles = pendingTraceCycles;
+            pendingTraceCycles = 0;
+
             // Update current data structure
             currentData.heading = tm171Parser->getYaw();
             currentData.pitch = tm171Parser->getPitch();
@@ -466,25 +481,14 @@ void IMUProcessor::sendIMUData()
     int16_t rollX10 = (int16_t)(currentData.roll * 10);
     int16_t gyroX10 = (int16_t)(currentData.yawRate * 10);  // yaw rate as gyro
     
-    uint8_t imuData[] = {
-        0x80, 0x81,                     // PGN header
-        IMU_SOURCE_ID,                  // Source: 0x79 (121)
-        IMU_PGN_DATA,                   // PGN: 0xD3 (211)
-        8,                              // Data length
-        (uint8_t)(headingX10 & 0xFF),   // Heading low byte
-        (uint8_t)(headingX10 >> 8),     // Heading high byte
-        (uint8_t)(rollX10 & 0xFF),      // Roll low byte
-        (uint8_t)(rollX10 >> 8),        // Roll high byte
-        (uint8_t)(gyroX10 & 0xFF),      // Gyro low byte
-        (uint8_t)(gyroX10 >> 8),        // Gyro high byte
-        0,                              // Reserved
-        0,                              // Reserved
-        0                               // CRC placeholder
-    };
-    
-    // Calculate and set CRC
-    calculateAndSetCRC(imuData, sizeof(imuData));
-    
-    // Send the data
-    sendUDPbytes(imuData, sizeof(imuData));
+    uint8_t* imuData = QNEthernetUDPHandler::beginPGN(IMU_SOURCE_ID, IMU_PGN_DATA, 8);
+    imuData[0] = (uint8_t)(headingX10 & 0xFF);  // Heading low byte
+    imuData[1] = (uint8_t)(headingX10 >> 8);    // Heading high byte
+    imuData[2] = (uint8_t)(rollX10 & 0xFF);     // Roll low byte
+    imuData[3] = (uint8_t)(rollX10 >> 8);       // Roll high byte
+    imuData[4] = (uint8_t)(gyroX10 & 0xFF);     // Gyro low byte
+    imuData[5] = (uint8_t)(gyroX10 >> 8);       // Gyro high byte
+    imuData[6] = 0;                             // Reserved
+    imuData[7] = 0;                             // Reserved
+    QNEthernetUDPHandler::commitPGN();
 }
\ No newline at end of file
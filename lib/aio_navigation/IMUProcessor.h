@@ -30,6 +30,7 @@ struct IMUData
     uint8_t quality;    // 0-10 quality indicator
     uint32_t timestamp; // millis() when data was received
     bool isValid;       // data validity flag
+    uint32_t traceCycles; // LatencyTrace stamp of the packet's first byte
 };
 
 // IMU Processor class
@@ -57,6 +58,7 @@ private:
     // Serial data tracking
     uint32_t lastSerialDataTime = 0;
     bool serialDataReceived = false;
+    uint32_t pendingTraceCycles = 0;  // Stamp of the first byte of the packet in progress
 
     // Private methods
     bool initBNO085();
@@ -9,6 +9,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include "NMEACoordinate.h"
 
 // Efficient NMEA message builder without format string parsing
 class NMEAMessageBuilder {
@@ -93,33 +94,15 @@ public:
         ptr = writeFloat(value, decimals);
     }
     
-    // Add latitude in NMEA format (DDMM.MMMMMM)
-    void addLatitude(double lat) {
-        int degrees = (int)(lat / 100);
-        double minutes = lat - (degrees * 100);
-        
-        // Pad degrees to 2 digits
-        if (degrees < 10) *ptr++ = '0';
-        ptr = writeInt(degrees);
-        
-        // Pad minutes 
-        if (minutes < 10) *ptr++ = '0';
-        ptr = writeFloat(minutes, 6);
+    // Add latitude in NMEA format (DDMM.MMMM) with the receiver's own minute
+    // decimals - integer formatting, so the digits go out exactly as received
+    void addLatitude(const NMEACoordinate::Angle& lat) {
+        ptr = NMEACoordinate::format(ptr, lat, 2);
     }
     
-    // Add longitude in NMEA format (DDDMM.MMMMMM)
-    void addLongitude(double lon) {
-        int degrees = (int)(lon / 100);
-        double minutes = lon - (degrees * 100);
-        
-        // Pad degrees to 3 digits
-        if (degrees < 100) *ptr++ = '0';
-        if (degrees < 10) *ptr++ = '0';
-        ptr = writeInt(degrees);
-        
-        // Pad minutes
-        if (minutes < 10) *ptr++ = '0';
-        ptr = writeFloat(minutes, 6);
+    // Add longitude in NMEA format (DDDMM.MMMM), same as addLatitude
+    void addLongitude(const NMEACoordinate::Angle& lon) {
+        ptr = NMEACoordinate::format(ptr, lon, 3);
     }
     
     int length() const {
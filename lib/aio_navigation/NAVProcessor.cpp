@@ -11,6 +11,7 @@
 #include "EventLogger.h"
 #include "ConfigManager.h"
 #include "MessageBuilder.h"
+#include "LatencyTrace.h"
 
 // External processor instances from main.cpp
 extern GNSSProcessor gnssProcessor;
@@ -33,6 +34,9 @@ NAVProcessor::NAVProcessor() {
     lastPAOGILatitude = 0.0;
     lastPAOGILongitude = 0.0;
     
+    lastEpochSendTime = 0;
+    memset(&latency, 0, sizeof(latency));
+    
     // Clear message buffer
     memset(messageBuffer, 0, BUFFER_SIZE);
     
@@ -77,6 +81,23 @@ void NAVProcessor::init() {
         instance = new NAVProcessor();
         // Note: navPTR is set in main.cpp after calling init()
     }
+    
+    extern ConfigManager configManager;
+    gnssProcessor.setEpochCallback(onFixEpoch);
+    instance->setEmitMode(configManager.getNavEmitMode());
+}
+
+void NAVProcessor::setEmitMode(uint8_t mode) {
+    gnssProcessor.setEpochTrigger(mode);
+    
+    static const char* const modeNames[] = {"10Hz poll", "auto", "GGA+VTG", "GGA+dual", "INS"};
+    LOG_INFO(EventSource::GNSS, "PANDA/PAOGI trigger: %s", modeNames[gnssProcessor.getEpochTrigger()]);
+}
+
+void NAVProcessor::onFixEpoch(uint32_t completeMicros) {
+    if (instance && instance->emitNavMessage(true, completeMicros)) {
+        instance->lastEpochSendTime = millis();
+    }
 }
 
 NavMessageType NAVProcessor::selectMessageType() {
@@ -177,8 +198,8 @@ bool NAVProcessor::formatPANDAMessage() {
     const auto& gnssData = gnssProcessor.getData();
     
     // Use cached NMEA coordinates - no conversion needed!
-    double latNMEA = gnssData.latitudeNMEA;
-    double lonNMEA = gnssData.longitudeNMEA;
+    const NMEACoordinate::Angle& latNMEA = gnssData.latitudeNMEA;
+    const NMEACoordinate::Angle& lonNMEA = gnssData.longitudeNMEA;
     char latDir = gnssData.latDir;
     char lonDir = gnssData.lonDir;
     
@@ -283,8 +304,8 @@ bool NAVProcessor::formatPAOGIMessage() {
     lastPAOGILongitude = gnssData.longitude;
     
     // Use cached NMEA coordinates - no conversion needed!
-    double latNMEA = gnssData.latitudeNMEA;
-    double lonNMEA = gnssData.longitudeNMEA;
+    const NMEACoordinate::Angle& latNMEA = gnssData.latitudeNMEA;
+    const NMEACoordinate::Angle& lonNMEA = gnssData.longitudeNMEA;
     char latDir = gnssData.latDir;
     char lonDir = gnssData.lonDir;
     
@@ -379,6 +400,17 @@ void NAVProcessor::sendMessage(const char* message) {
 }
 
 void NAVProcessor::process() {
+    // Epoch-driven mode: only step in if the receiver stopped completing epochs
+    // (e.g. a message the trigger waits for isn't enabled on the receiver)
+    if (gnssProcessor.getEpochTrigger() != GNSSProcessor::EPOCH_POLLED &&
+        millis() - lastEpochSendTime < EPOCH_BACKSTOP_MS) {
+        return;
+    }
+    
+    emitNavMessage(false, gnssProcessor.getLastMessageMicros());
+}
+
+bool NAVProcessor::emitNavMessage(bool fromEpoch, uint32_t fixMicros) {
     // Check if UDP passthrough is enabled - if so, don't send PANDA/PAOGI
     extern ConfigManager configManager;
     bool passthroughEnabled = configManager.getGPSPassThrough();
@@ -392,7 +424,7 @@ void NAVProcessor::process() {
     }
     
     if (passthroughEnabled) {
-        return;  // UDP passthrough is enabled, skip PANDA/PAOGI messages
+        return false;  // UDP passthrough is enabled, skip PANDA/PAOGI messages
     }
     
     // For single antenna systems, we need at least position data
@@ -401,13 +433,13 @@ void NAVProcessor::process() {
     bool isDualSystem = gnssData.hasDualHeading || gnssData.hasINS;
     
     if (!isDualSystem && !gnssData.hasPosition) {
-        return;  // Don't send messages yet
+        return false;  // Don't send messages yet
     }
     
     // Check if we have new GPS data since last send
     if (!hasNewGPSData()) {
         // No new GPS data, skip this cycle
-        return;
+        return false;
     }
     
     // Select and format appropriate message type
@@ -428,20 +460,10 @@ void NAVProcessor::process() {
     switch (msgType) {
         case NavMessageType::PANDA:
             success = formatPANDAMessage();
-            if (success) {
-                sendMessage(messageBuffer);
-                // Message sent successfully
-                lastGPSUpdateTime = gnssProcessor.getData().lastUpdateTime;
-            }
             break;
             
         case NavMessageType::PAOGI:
             success = formatPAOGIMessage();
-            if (success) {
-                sendMessage(messageBuffer);
-                // Message sent successfully
-                lastGPSUpdateTime = gnssProcessor.getData().lastUpdateTime;
-            }
             break;
             
         case NavMessageType::NONE:
@@ -450,13 +472,54 @@ void NAVProcessor::process() {
             break;
     }
     
-    if (!success && msgType != NavMessageType::NONE) {
+    if (success) {
+        sendMessage(messageBuffer);
+        recordLatency(fixMicros, fromEpoch);
+
+        // End-to-end trace from the first byte on the wire to the UDP queue;
+        // time in the queue shows on the PGN Traffic page
+        LatencyTrace* trace = LatencyTrace::getInstance();
+        trace->record(LatencyTrace::GNSS_TO_NAV, gnssProcessor.getData().traceCycles);
+        if (msgType == NavMessageType::PANDA && imuProcessor.hasValidData()) {
+            // Each IMU packet is counted once even if it rides in two sends
+            static uint32_t lastImuTrace = 0;
+            uint32_t imuTrace = imuProcessor.getCurrentData().traceCycles;
+            if (imuTrace != lastImuTrace) {
+                trace->record(LatencyTrace::IMU_TO_NAV, imuTrace);
+                lastImuTrace = imuTrace;
+            }
+        }
+        // Message sent successfully
+        lastGPSUpdateTime = gnssProcessor.getData().lastUpdateTime;
+    } else if (msgType != NavMessageType::NONE) {
         // Message format error occurred
         LOG_ERROR(EventSource::GNSS, "Failed to format %s message", 
                   msgType == NavMessageType::PANDA ? "PANDA" : "PAOGI");
     }
     
     lastGPSMessageTime = millis();
+    return success;
+}
+
+void NAVProcessor::recordLatency(uint32_t fixMicros, bool fromEpoch) {
+    static const uint32_t bucketLimitsUs[LATENCY_BUCKETS - 1] = {1000, 2000, 5000, 10000, 20000, 50000, 100000};
+    
+    uint32_t us = micros() - fixMicros;
+    uint8_t bucket = 0;
+    while (bucket < LATENCY_BUCKETS - 1 && us >= bucketLimitsUs[bucket]) {
+        bucket++;
+    }
+    
+    latency.histogram[bucket]++;
+    latency.totalUs += us;
+    if (us > latency.maxUs) {
+        latency.maxUs = us;
+    }
+    if (fromEpoch) {
+        latency.epochSends++;
+    } else {
+        latency.polledSends++;
+    }
 }
 
 void NAVProcessor::setMessageRate(uint32_t intervalMs) {
@@ -482,6 +545,17 @@ void NAVProcessor::printStatus() {
     
     LOG_INFO(EventSource::GNSS, "Message rate: %d Hz", 1000 / MESSAGE_INTERVAL_MS);
     
+    uint32_t sends = latency.epochSends + latency.polledSends;
+    LOG_INFO(EventSource::GNSS, "Sends: %lu on fix epoch, %lu on 10Hz poll", 
+        latency.epochSends, latency.polledSends);
+    if (sends > 0) {
+        LOG_INFO(EventSource::GNSS, "Fix-to-UDP latency: avg %lu us, max %lu us", 
+            (uint32_t)(latency.totalUs / sends), latency.maxUs);
+        LOG_INFO(EventSource::GNSS, "  <1ms:%lu <2:%lu <5:%lu <10:%lu <20:%lu <50:%lu <100:%lu >=100:%lu",
+            latency.histogram[0], latency.histogram[1], latency.histogram[2], latency.histogram[3],
+            latency.histogram[4], latency.histogram[5], latency.histogram[6], latency.histogram[7]);
+    }
+    
     if (lastGPSMessageTime > 0) {
         LOG_INFO(EventSource::GNSS, "Time since last GPS message: %lu ms", 
             millis() - lastGPSMessageTime);
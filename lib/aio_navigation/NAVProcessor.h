@@ -40,6 +40,23 @@ private:
     double lastPAOGILatitude;
     double lastPAOGILongitude;
     
+    // Epoch-driven sending - GNSSProcessor calls back as soon as a fix epoch
+    // completes; the 10Hz process() tick only sends if epochs stop arriving
+    static constexpr uint32_t EPOCH_BACKSTOP_MS = 300;
+    uint32_t lastEpochSendTime;
+    
+    // Fix-to-UDP latency: newest parsed GNSS message -> sendUDPbytes() returned
+    // Histogram: <1, <2, <5, <10, <20, <50, <100, >=100 ms
+    static constexpr uint8_t LATENCY_BUCKETS = 8;
+    struct LatencyStats {
+        uint32_t epochSends;
+        uint32_t polledSends;
+        uint32_t maxUs;
+        uint64_t totalUs;
+        uint32_t histogram[LATENCY_BUCKETS];
+    };
+    LatencyStats latency;
+    
     // Private constructor for singleton
     NAVProcessor();
     
@@ -54,6 +71,9 @@ private:
     uint8_t calculateNMEAChecksum(const char* sentence);
     float convertGPStoUTC(uint16_t gpsWeek, float gpsSeconds);
     void sendMessage(const char* message);
+    bool emitNavMessage(bool fromEpoch, uint32_t fixMicros);
+    void recordLatency(uint32_t fixMicros, bool fromEpoch);
+    static void onFixEpoch(uint32_t completeMicros);
     
 public:
     ~NAVProcessor();
@@ -70,9 +90,11 @@ public:
     
     // Configuration
     void setMessageRate(uint32_t intervalMs);
+    void setEmitMode(uint8_t mode);  // GNSSProcessor::EpochTrigger
     
     // Status and debugging
     void printStatus();
+    void resetLatencyStats() { memset(&latency, 0, sizeof(latency)); }
     uint32_t getLastGPSMessageTime() const { return lastGPSMessageTime; }
     NavMessageType getCurrentMessageType();
     
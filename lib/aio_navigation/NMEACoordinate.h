@@ -0,0 +1,171 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// NMEACoordinate.h
+// Integer lat/lon handling for GNSSProcessor and the PANDA/PAOGI builder.
+// A coordinate magnitude is kept as int64 nano-arc-minutes plus the number of
+// minute decimals to re-emit. NMEA DDMM.MMMM fields parse into it exactly (up
+// to 9 decimals), and so do decimal-degree fields (KSXT, INSPVA) because
+// nano-degrees * 60 is a whole number of nano-minutes. Re-emitting is pure
+// integer formatting, so the receiver's digits go out unchanged. Binary-log
+// doubles (BESTNAVB, INSPVAXB) and UBX integers come in through fromDegrees()
+// and fromNanoDegrees(). Header-only with no Arduino dependencies so
+// tools/coord_bench can build it on the host.
+
+#ifndef NMEA_COORDINATE_H
+#define NMEA_COORDINATE_H
+
+#include <stdint.h>
+#include <math.h>
+
+namespace NMEACoordinate {
+
+static constexpr uint8_t MAX_DECIMALS = 9;
+static constexpr int64_t NANO = 1000000000LL;
+static constexpr int64_t NANO_MINUTES_PER_DEGREE = 60 * NANO;
+
+static constexpr uint32_t POW10[MAX_DECIMALS + 1] = {
+    1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+};
+
+// Unsigned angle; the hemisphere travels separately (latDir/lonDir)
+struct Angle {
+    int64_t nanoMinutes;  // (degrees * 60 + minutes) * 1e9
+    uint8_t decimals;     // Minute decimals to emit
+};
+
+inline bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+// NMEA "DDMM.MMMM" / "DDDMM.MMMM". Digits past the 9th decimal are dropped.
+inline bool parseDegMin(const char* text, uint16_t length, Angle& out)
+{
+    uint16_t i = 0;
+    uint32_t whole = 0;
+    while (i < length && isDigit(text[i])) {
+        whole = whole * 10 + (text[i] - '0');
+        i++;
+    }
+    if (i < 3 || i > 5) return false;  // DMM to DDDMM
+
+    uint32_t fraction = 0;
+    uint8_t decimals = 0;
+    if (i < length) {
+        if (text[i++] != '.') return false;
+        for (; i < length; i++) {
+            if (!isDigit(text[i])) return false;
+            if (decimals < MAX_DECIMALS) {
+                fraction = fraction * 10 + (text[i] - '0');
+                decimals++;
+            }
+        }
+    }
+
+    uint32_t minutes = whole % 100;
+    if (minutes >= 60) return false;
+
+    out.nanoMinutes = (int64_t)((whole / 100) * 60 + minutes) * NANO +
+                      (int64_t)fraction * POW10[MAX_DECIMALS - decimals];
+    out.decimals = decimals;
+    return true;
+}
+
+// Signed decimal degrees "-DDD.DDDDDDDDD", rounded to the nearest nano-degree.
+// decimals is chosen so the minute form is exact: d degree decimals need d-1.
+inline bool parseDegrees(const char* text, uint16_t length, Angle& out, bool& negative)
+{
+    uint16_t i = 0;
+    negative = false;
+    if (i < length && (text[i] == '-' || text[i] == '+')) {
+        negative = (text[i] == '-');
+        i++;
+    }
+
+    uint16_t wholeStart = i;
+    uint32_t whole = 0;
+    while (i < length && isDigit(text[i])) {
+        whole = whole * 10 + (text[i] - '0');
+        i++;
+    }
+    if (i == wholeStart || i - wholeStart > 3) return false;
+
+    uint32_t fraction = 0;
+    uint8_t decimals = 0;
+    bool dropped = false;
+    bool roundUp = false;
+    if (i < length) {
+        if (text[i++] != '.') return false;
+        for (; i < length; i++) {
+            if (!isDigit(text[i])) return false;
+            if (decimals < MAX_DECIMALS) {
+                fraction = fraction * 10 + (text[i] - '0');
+                decimals++;
+            } else if (!dropped) {
+                // Only the first dropped digit decides rounding
+                roundUp = (text[i] >= '5');
+                dropped = true;
+            }
+        }
+    }
+
+    int64_t nanoDegrees = (int64_t)whole * NANO + (int64_t)fraction * POW10[MAX_DECIMALS - decimals];
+    if (roundUp) nanoDegrees++;
+
+    out.nanoMinutes = nanoDegrees * 60;
+    out.decimals = decimals > 1 ? decimals - 1 : 1;
+    return true;
+}
+
+inline double toDegrees(const Angle& angle)
+{
+    return (double)angle.nanoMinutes / (double)NANO_MINUTES_PER_DEGREE;
+}
+
+// Magnitude of signed nano-degrees from a binary log that carries degreeDecimals
+// of resolution (UBX NAV-PVT 7, NAV-HPPOSLLH 9)
+inline Angle fromNanoDegrees(int64_t nanoDegrees, uint8_t degreeDecimals)
+{
+    Angle out;
+    out.nanoMinutes = (nanoDegrees < 0 ? -nanoDegrees : nanoDegrees) * 60;
+    out.decimals = degreeDecimals > 1 ? degreeDecimals - 1 : 1;
+    return out;
+}
+
+// Magnitude of a binary-log double (BESTNAVB, INSPVAXB), rounded to the nearest
+// nano-degree - the same resolution a 9-decimal text field parses to
+inline Angle fromDegrees(double degrees)
+{
+    return fromNanoDegrees(llround(degrees * NANO), MAX_DECIMALS);
+}
+
+// Writes DD(D)MM.MMMM with degreeDigits zero-padded degrees, returns the new end
+inline char* format(char* p, const Angle& angle, uint8_t degreeDigits)
+{
+    uint32_t degrees = (uint32_t)(angle.nanoMinutes / NANO_MINUTES_PER_DEGREE);
+    int64_t remainder = angle.nanoMinutes % NANO_MINUTES_PER_DEGREE;
+    uint32_t minutes = (uint32_t)(remainder / NANO);
+    uint32_t fraction = (uint32_t)(remainder % NANO) / POW10[MAX_DECIMALS - angle.decimals];
+
+    for (int8_t d = degreeDigits - 1; d >= 0; d--) {
+        p[d] = '0' + degrees % 10;
+        degrees /= 10;
+    }
+    p += degreeDigits;
+    *p++ = '0' + minutes / 10;
+    *p++ = '0' + minutes % 10;
+    if (angle.decimals > 0) {
+        *p++ = '.';
+        for (int8_t d = angle.decimals - 1; d >= 0; d--) {
+            p[d] = '0' + fraction % 10;
+            fraction /= 10;
+        }
+        p += angle.decimals;
+    }
+    return p;
+}
+
+} // namespace NMEACoordinate
+
+#endif // NMEA_COORDINATE_H
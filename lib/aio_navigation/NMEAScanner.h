@@ -0,0 +1,104 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// NMEAScanner.h
+// Word-at-a-time helpers for GNSSProcessor::processNMEAStream().
+// Four bytes are tested per step with the classic "has zero byte" trick, and
+// the NMEA XOR checksum is folded from whole words, so the common case (the
+// body of a sentence) costs no per-character branch. Header-only with no
+// Arduino dependencies so tools/nmea_bench can build it on the host.
+
+#ifndef NMEA_SCANNER_H
+#define NMEA_SCANNER_H
+
+#include <stdint.h>
+#include <string.h>
+
+namespace NMEAScanner {
+
+static constexpr uint32_t ONES = 0x01010101UL;
+static constexpr uint32_t HIGHS = 0x80808080UL;
+
+// Unaligned load - a single LDR on Cortex-M7
+inline uint32_t loadWord(const char* p)
+{
+    uint32_t w;
+    memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+// Non-zero if any byte of w equals the byte replicated in pattern
+inline uint32_t matchByte(uint32_t w, uint32_t pattern)
+{
+    uint32_t x = w ^ pattern;
+    return (x - ONES) & ~x & HIGHS;
+}
+
+inline uint8_t foldXor(uint32_t acc)
+{
+    acc ^= acc >> 16;
+    acc ^= acc >> 8;
+    return (uint8_t)acc;
+}
+
+// Unicore binary frames start with this byte (UnicoreBinary::SYNC1)
+static constexpr uint8_t BINARY_SYNC = 0xAA;
+
+inline bool isStart(char c)
+{
+    return c == '$' || c == '#' || (uint8_t)c == BINARY_SYNC;
+}
+
+// Index of the first '$', '#' or binary sync byte in data[0..length), or length if none
+inline uint16_t findStart(const char* data, uint16_t length)
+{
+    uint16_t i = 0;
+    while (i + 4 <= length) {
+        uint32_t w = loadWord(data + i);
+        if (matchByte(w, '$' * ONES) | matchByte(w, '#' * ONES) | matchByte(w, BINARY_SYNC * ONES)) break;
+        i += 4;
+    }
+    while (i < length && !isStart(data[i])) i++;
+    return i;
+}
+
+// Index of the first '*', '\r' or '\n' in data[0..length), or length if none.
+// XOR of every byte before that index is folded into checksum.
+inline uint16_t scanBody(const char* data, uint16_t length, uint8_t& checksum)
+{
+    uint16_t i = 0;
+    uint32_t acc = 0;
+    while (i + 4 <= length) {
+        uint32_t w = loadWord(data + i);
+        if (matchByte(w, '*' * ONES) | matchByte(w, '\r' * ONES) | matchByte(w, '\n' * ONES)) break;
+        acc ^= w;
+        i += 4;
+    }
+    uint8_t x = foldXor(acc);
+    while (i < length) {
+        char c = data[i];
+        if (c == '*' || c == '\r' || c == '\n') break;
+        x ^= (uint8_t)c;
+        i++;
+    }
+    checksum ^= x;
+    return i;
+}
+
+// XOR of data[0..length), used when a run had to be truncated
+inline uint8_t xorBlock(const char* data, uint16_t length)
+{
+    uint16_t i = 0;
+    uint32_t acc = 0;
+    for (; i + 4 <= length; i += 4) acc ^= loadWord(data + i);
+    uint8_t x = foldXor(acc);
+    for (; i < length; i++) x ^= (uint8_t)data[i];
+    return x;
+}
+
+} // namespace NMEAScanner
+
+#endif // NMEA_SCANNER_H
@@ -0,0 +1,184 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// UBXNav.h
+// u-blox NAV-PVT / NAV-HPPOSLLH / NAV-EOE payload layouts for the GPS2 binary
+// path, decoded in place from UBX_Parser's frame buffer, plus the iTOW epoch
+// grouping GNSSProcessor uses to report one fix per navigation epoch.
+// Offsets are from the u-blox F9 HPG interface description; fields are
+// little-endian. Header-only with no Arduino dependencies so tools/ubx_bench
+// can build it on the host.
+
+#ifndef UBX_NAV_H
+#define UBX_NAV_H
+
+#include <stdint.h>
+#include <string.h>
+
+namespace UBXNav {
+
+static constexpr uint8_t CLASS_NAV = 0x01;
+static constexpr uint8_t ID_PVT = 0x07;
+static constexpr uint8_t ID_HPPOSLLH = 0x14;
+static constexpr uint8_t ID_RELPOSNED = 0x3C;
+static constexpr uint8_t ID_EOE = 0x61;
+
+static constexpr uint16_t PVT_LENGTH = 92;
+static constexpr uint16_t HPPOSLLH_LENGTH = 36;
+static constexpr uint16_t RELPOSNED_LENGTH = 64;
+static constexpr uint16_t EOE_LENGTH = 4;
+
+inline uint16_t readU16(const uint8_t* p) { uint16_t v; memcpy(&v, p, sizeof(v)); return v; }
+inline uint32_t readU32(const uint8_t* p) { uint32_t v; memcpy(&v, p, sizeof(v)); return v; }
+inline int32_t readI32(const uint8_t* p) { int32_t v; memcpy(&v, p, sizeof(v)); return v; }
+
+struct PVT {
+    uint32_t iTOW;     // ms, GPS time of week
+    uint8_t hour, min, sec;  // UTC
+    uint8_t fixType;   // 0 none, 1 DR, 2 2D, 3 3D, 4 GNSS+DR, 5 time only
+    uint8_t flags;     // bit 0 gnssFixOK, bit 1 diffSoln, bits 6-7 carrSoln
+    uint8_t numSV;
+    int32_t lon, lat;  // 1e-7 deg
+    int32_t hMSL;      // mm
+    uint32_t hAcc, vAcc;  // mm
+    int32_t velN, velE, velD;  // mm/s
+    int32_t gSpeed;    // mm/s
+    int32_t headMot;   // 1e-5 deg
+    uint16_t pDOP;     // 0.01
+    uint16_t flags3;   // bits 1-4 lastCorrectionAge
+};
+
+inline bool decodePVT(const uint8_t* p, uint16_t length, PVT& out)
+{
+    if (length < PVT_LENGTH) return false;
+    out.iTOW = readU32(p + 0);
+    out.hour = p[8];
+    out.min = p[9];
+    out.sec = p[10];
+    out.fixType = p[20];
+    out.flags = p[21];
+    out.numSV = p[23];
+    out.lon = readI32(p + 24);
+    out.lat = readI32(p + 28);
+    out.hMSL = readI32(p + 36);
+    out.hAcc = readU32(p + 40);
+    out.vAcc = readU32(p + 44);
+    out.velN = readI32(p + 48);
+    out.velE = readI32(p + 52);
+    out.velD = readI32(p + 56);
+    out.gSpeed = readI32(p + 60);
+    out.headMot = readI32(p + 64);
+    out.pDOP = readU16(p + 76);
+    out.flags3 = readU16(p + 78);
+    return true;
+}
+
+// GGA fix quality: 0 invalid, 1 GPS, 2 DGPS, 4 RTK fixed, 5 RTK float, 6 dead reckoning
+inline uint8_t fixQuality(const PVT& pvt)
+{
+    if (!(pvt.flags & 0x01) || pvt.fixType == 0 || pvt.fixType == 5) return 0;
+    if (pvt.fixType == 1) return 6;
+    switch (pvt.flags >> 6) {
+    case 2: return 4;
+    case 1: return 5;
+    default: return (pvt.flags & 0x02) ? 2 : 1;
+    }
+}
+
+// flags3 lastCorrectionAge is a range index - report the lower bound in seconds
+inline uint16_t correctionAgeSeconds(uint16_t flags3)
+{
+    static const uint8_t AGE[16] = {0, 0, 1, 2, 5, 10, 15, 20, 30, 45, 60, 90, 120, 120, 120, 120};
+    return AGE[(flags3 >> 1) & 0x0F];
+}
+
+struct HPPOSLLH {
+    uint32_t iTOW;
+    int64_t lonNano, latNano;  // 1e-9 deg, standard + high-precision part
+    int32_t hMSL01;            // 0.1 mm
+    uint32_t hAcc, vAcc;       // 0.1 mm
+};
+
+inline bool decodeHPPOSLLH(const uint8_t* p, uint16_t length, HPPOSLLH& out)
+{
+    if (length < HPPOSLLH_LENGTH) return false;
+    if (p[3] & 0x01) return false;  // invalidLlh
+    out.iTOW = readU32(p + 4);
+    out.lonNano = (int64_t)readI32(p + 8) * 100 + (int8_t)p[24];
+    out.latNano = (int64_t)readI32(p + 12) * 100 + (int8_t)p[25];
+    out.hMSL01 = readI32(p + 20) * 10 + (int8_t)p[27];
+    out.hAcc = readU32(p + 28);
+    out.vAcc = readU32(p + 32);
+    return true;
+}
+
+// Groups NAV messages by iTOW. The set of messages making up an epoch is
+// learned from the ones before, so an epoch is reported as soon as that set
+// is in (or on NAV-EOE if the receiver sends it) rather than one message late.
+// A larger set is taken at once; a smaller one only once two epochs in a row
+// agree, so one dropped frame doesn't make the next epoch report early.
+// An epoch that never completes - startup, a dropped frame without EOE - isn't
+// reported.
+class EpochGrouper {
+public:
+    enum : uint8_t {
+        MSG_PVT = 1 << 0,
+        MSG_HPPOSLLH = 1 << 1,
+        MSG_RELPOSNED = 1 << 2
+    };
+
+    // True if iTOW belongs to an epoch not seen yet
+    bool isNewEpoch(uint32_t iTOW) const { return seenMask == 0 || iTOW != currentITOW; }
+    bool has(uint32_t iTOW, uint8_t msg) const { return seenMask && iTOW == currentITOW && (seenMask & msg); }
+
+    // Returns the epoch's message mask when this completes it, else 0
+    uint8_t add(uint32_t iTOW, uint8_t msg)
+    {
+        if (isNewEpoch(iTOW)) {
+            learn();
+            currentITOW = iTOW;
+            seenMask = 0;
+            reported = false;
+        }
+        seenMask |= msg;
+        if (!reported && expectedMask && (seenMask & expectedMask) == expectedMask) {
+            reported = true;
+            return seenMask;
+        }
+        return 0;
+    }
+
+    // NAV-EOE: whatever arrived for iTOW is the whole epoch
+    uint8_t endOfEpoch(uint32_t iTOW)
+    {
+        if (seenMask == 0 || iTOW != currentITOW || reported) return 0;
+        reported = true;
+        return seenMask;
+    }
+
+    uint8_t getExpected() const { return expectedMask; }
+
+private:
+    uint32_t currentITOW = 0;
+    uint8_t seenMask = 0;
+    uint8_t previousMask = 0;
+    uint8_t expectedMask = 0;
+    bool reported = false;
+
+    // Called with the epoch just finished in seenMask
+    void learn()
+    {
+        if (seenMask == 0) return;
+        if ((seenMask & expectedMask) == expectedMask || seenMask == previousMask) {
+            expectedMask = seenMask;
+        }
+        previousMask = seenMask;
+    }
+};
+
+} // namespace UBXNav
+
+#endif // UBX_NAV_H
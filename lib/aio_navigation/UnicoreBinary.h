@@ -0,0 +1,97 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// UnicoreBinary.h
+// Frame layout of Unicore binary logs (BESTNAVB, INSPVAXB, HEADING2B) as sent
+// by UM981/UM982. A frame is AA 44 B5, the rest of a 24-byte header, the
+// message body and a little-endian CRC32 (calc_crc32.h) over everything
+// before it. Offsets are from the Unicore reference manual; all fields are
+// little-endian, so they are read with memcpy (unaligned-safe, a plain load
+// on Cortex-M7). Header-only with no Arduino dependencies.
+
+#ifndef UNICORE_BINARY_H
+#define UNICORE_BINARY_H
+
+#include <stdint.h>
+#include <string.h>
+
+namespace UnicoreBinary {
+
+static constexpr uint8_t SYNC1 = 0xAA;
+static constexpr uint8_t SYNC2 = 0x44;
+static constexpr uint8_t SYNC3 = 0xB5;
+
+static constexpr uint16_t HEADER_SIZE = 24;
+static constexpr uint16_t CRC_SIZE = 4;
+
+// Header offsets
+static constexpr uint8_t HDR_MSG_ID = 4;       // uint16
+static constexpr uint8_t HDR_MSG_LENGTH = 6;   // uint16, body only
+static constexpr uint8_t HDR_TIME_STATUS = 9;  // uint8
+static constexpr uint8_t HDR_WEEK = 10;        // uint16
+static constexpr uint8_t HDR_MS = 12;          // uint32, ms of week
+static constexpr uint8_t HDR_LEAP_SECONDS = 21; // uint8, GPS - UTC
+
+// Message IDs
+static constexpr uint16_t MSG_HEADING2 = 1331;
+static constexpr uint16_t MSG_INSPVAX = 1465;
+static constexpr uint16_t MSG_BESTNAV = 2118;
+
+// BESTNAV body - BESTPOS and BESTVEL in one log
+static constexpr uint16_t BESTNAV_LENGTH = 120;
+static constexpr uint8_t BESTNAV_SOL_STATUS = 0;   // uint32, 0 = SOL_COMPUTED
+static constexpr uint8_t BESTNAV_POS_TYPE = 4;     // uint32
+static constexpr uint8_t BESTNAV_LAT = 8;          // double, degrees
+static constexpr uint8_t BESTNAV_LON = 16;         // double, degrees
+static constexpr uint8_t BESTNAV_HEIGHT = 24;      // double, m above MSL
+static constexpr uint8_t BESTNAV_LAT_SIGMA = 40;   // float, m
+static constexpr uint8_t BESTNAV_LON_SIGMA = 44;   // float, m
+static constexpr uint8_t BESTNAV_HGT_SIGMA = 48;   // float, m
+static constexpr uint8_t BESTNAV_DIFF_AGE = 56;    // float, s
+static constexpr uint8_t BESTNAV_SVS_USED = 65;    // uint8
+static constexpr uint8_t BESTNAV_VEL_STATUS = 72;  // uint32
+static constexpr uint8_t BESTNAV_HOR_SPEED = 88;   // double, m/s
+static constexpr uint8_t BESTNAV_TRACK = 96;       // double, degrees true
+static constexpr uint8_t BESTNAV_VERT_SPEED = 104; // double, m/s
+
+// INSPVAX body
+static constexpr uint16_t INSPVAX_LENGTH = 126;
+static constexpr uint8_t INSPVAX_INS_STATUS = 0;   // uint32
+static constexpr uint8_t INSPVAX_POS_TYPE = 4;     // uint32
+static constexpr uint8_t INSPVAX_LAT = 8;          // double, degrees
+static constexpr uint8_t INSPVAX_LON = 16;         // double, degrees
+static constexpr uint8_t INSPVAX_HEIGHT = 24;      // double, m
+static constexpr uint8_t INSPVAX_NORTH_VEL = 36;   // double, m/s
+static constexpr uint8_t INSPVAX_EAST_VEL = 44;    // double, m/s
+static constexpr uint8_t INSPVAX_UP_VEL = 52;      // double, m/s
+static constexpr uint8_t INSPVAX_ROLL = 60;        // double, degrees
+static constexpr uint8_t INSPVAX_PITCH = 68;       // double, degrees
+static constexpr uint8_t INSPVAX_AZIMUTH = 76;     // double, degrees
+static constexpr uint8_t INSPVAX_LAT_SIGMA = 84;   // float x3: lat, lon, height (m)
+static constexpr uint8_t INSPVAX_VEL_SIGMA = 96;   // float x3: north, east, up (m/s)
+static constexpr uint8_t INSPVAX_EXT_STATUS = 120; // uint32
+static constexpr uint8_t INSPVAX_SINCE_UPDATE = 124; // uint16, s
+
+// HEADING2 body
+static constexpr uint16_t HEADING2_LENGTH = 48;
+static constexpr uint8_t HEADING2_SOL_STATUS = 0;  // uint32
+static constexpr uint8_t HEADING2_POS_TYPE = 4;    // uint32
+static constexpr uint8_t HEADING2_HEADING = 12;    // float, degrees
+static constexpr uint8_t HEADING2_PITCH = 16;      // float, degrees
+static constexpr uint8_t HEADING2_SVS_USED = 41;   // uint8
+
+// Largest body we parse; longer logs are skipped without buffering
+static constexpr uint16_t MAX_BODY = INSPVAX_LENGTH;
+static constexpr uint16_t MAX_FRAME = HEADER_SIZE + MAX_BODY + CRC_SIZE;
+
+inline uint16_t readU16(const uint8_t* p) { uint16_t v; memcpy(&v, p, sizeof(v)); return v; }
+inline uint32_t readU32(const uint8_t* p) { uint32_t v; memcpy(&v, p, sizeof(v)); return v; }
+inline float readFloat(const uint8_t* p) { float v; memcpy(&v, p, sizeof(v)); return v; }
+inline double readDouble(const uint8_t* p) { double v; memcpy(&v, p, sizeof(v)); return v; }
+
+} // namespace UnicoreBinary
+
+#endif // UNICORE_BINARY_H
@@ -9,6 +9,10 @@
 #include "HardwareManager.h"
 #include "SimpleScheduler/SimpleScheduler.h"
 #include "SerialManager.h"
+#include "GNSSProcessor.h"
+#include "ControlLane.h"
+#include "NAVProcessor.h"
+#include "LatencyTrace.h"
 
 // External function declarations
 extern void toggleLoopTiming();
@@ -189,6 +193,7 @@ void CommandHandler::handleCommand(char cmd) {
             {
                 extern SerialManager serialManager;
                 serialManager.printBufferUsage();
+                gnssProcessor.printIngestStats();
             }
             break;
 
@@ -217,6 +222,38 @@ void CommandHandler::handleCommand(char cmd) {
             #endif
             break;
 
+        case 'y':  // snapshot scheduler stats (print, then start a fresh window)
+        case 'Y':
+            #ifdef SCHEDULER_TIMING_STATS
+            {
+                extern SimpleScheduler scheduler;
+                scheduler.printStats();
+                scheduler.resetStats();
+                Serial.printf("\r\nScheduler stats window closed - counting from zero.\r\n");
+            }
+            #else
+            Serial.printf("\r\nScheduler timing stats not enabled.\r\n");
+            #endif
+            break;
+
+        case 'j':  // control lane Jitter stats (print, then start a fresh window)
+        case 'J':
+            ControlLane::getInstance()->printStats();
+            ControlLane::getInstance()->resetStats();
+            break;
+
+        case 'n':  // NAV status with fix-to-UDP latency (print, then start a fresh window)
+        case 'N':
+            NAVProcessor::getInstance()->printStatus();
+            NAVProcessor::getInstance()->resetLatencyStats();
+            break;
+
+        case 'e':  // End-to-end sensor-to-wire latency (print, then start a fresh window)
+        case 'E':
+            LatencyTrace::getInstance()->printStats();
+            LatencyTrace::getInstance()->reset();
+            break;
+
         default:
             Serial.printf("\r\nUnknown command: '%c'\r\n", cmd);
             break;
@@ -244,6 +281,10 @@ void CommandHandler::showMenu() {
     Serial.print("\r\nU - View serial buffer usage");
     Serial.print("\r\nZ - Print scheduler timing stats");
     Serial.print("\r\nX - Reset scheduler timing stats");
+    Serial.print("\r\nY - Snapshot scheduler timing stats (print and reset)");
+    Serial.print("\r\nJ - Print control lane jitter stats (and reset)");
+    Serial.print("\r\nN - Print NAV status and fix-to-UDP latency (and reset)");
+    Serial.print("\r\nE - Print sensor-to-wire latency trace (and reset)");
     Serial.print("\r\n? - Show this menu");
     Serial.print("\r\n=========================\r\n");
 }
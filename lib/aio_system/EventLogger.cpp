@@ -26,6 +26,9 @@ using namespace qindesign::network;
 // Static instance pointer
 EventLogger* EventLogger::instance = nullptr;
 
+// Startup mode logs everything until the configured levels take over
+uint8_t EventLogger::activeLevel = static_cast<uint8_t>(EventSeverity::DEBUG);
+
 // Use EEPROM layout from header
 
 EventLogger::EventLogger() {
@@ -76,7 +79,9 @@ void EventLogger::log(EventSeverity severity, EventSource source, const char* fo
     eventCounter++;
 
     // Add to circular buffer for web viewer
-    addToBuffer(severity, source, messageBuffer);
+    if (startupMode || static_cast<uint8_t>(severity) <= config.webLevel) {
+        addToBuffer(severity, source, messageBuffer);
+    }
 
     // Output to enabled channels
     if (config.enableSerial && shouldLog(severity, false)) {
@@ -203,38 +208,69 @@ void EventLogger::loadConfig() {
     uint8_t marker;
     EEPROM.get(EVENT_CONFIG_ADDR - 1, marker);
     
-    if (marker == 0xEE) {  // Valid config marker
+    if (marker == 0xEF) {  // Valid config marker
         EEPROM.get(EVENT_CONFIG_ADDR, config);
+    } else if (marker == 0xEE) {  // Config saved before webLevel existed
+        EEPROM.get(EVENT_CONFIG_ADDR, config);
+        config.webLevel = static_cast<uint8_t>(EventSeverity::INFO);
+        memset(config.reserved, 0, sizeof(config.reserved));
+        saveConfig();
     } else {
         // Use defaults and save
         saveConfig();
     }
+    updateActiveLevel();
 }
 
 void EventLogger::saveConfig() {
-    uint8_t marker = 0xEE;
+    uint8_t marker = 0xEF;
     EEPROM.put(EVENT_CONFIG_ADDR - 1, marker);
     EEPROM.put(EVENT_CONFIG_ADDR, config);
 }
 
+void EventLogger::updateActiveLevel() {
+    // The web log buffer always takes its own level, serial/UDP only when on
+    uint8_t level = config.webLevel;
+    if (config.enableSerial && config.serialLevel > level) {
+        level = config.serialLevel;
+    }
+    if (config.enableUDP && config.udpLevel > level) {
+        level = config.udpLevel;
+    }
+    if (startupMode) {
+        level = static_cast<uint8_t>(EventSeverity::DEBUG);
+    }
+    activeLevel = level;
+}
+
 void EventLogger::setSerialLevel(EventSeverity level) {
     config.serialLevel = static_cast<uint8_t>(level);
     saveConfig();
+    updateActiveLevel();
 }
 
 void EventLogger::setUDPLevel(EventSeverity level) {
     config.udpLevel = static_cast<uint8_t>(level);
     saveConfig();
+    updateActiveLevel();
+}
+
+void EventLogger::setWebLevel(EventSeverity level) {
+    config.webLevel = static_cast<uint8_t>(level);
+    saveConfig();
+    updateActiveLevel();
 }
 
 void EventLogger::enableSerial(bool enable) {
     config.enableSerial = enable;
     saveConfig();
+    updateActiveLevel();
 }
 
 void EventLogger::enableUDP(bool enable) {
     config.enableUDP = enable;
     saveConfig();
+    updateActiveLevel();
 }
 
 EventSeverity EventLogger::stringToSeverity(const char* str) {
@@ -272,6 +308,8 @@ void EventLogger::printConfig() {
                   config.enableUDP ? "ENABLED" : "DISABLED",
                   severityNames[config.udpLevel],
                   (config.syslogPort[0] << 8) | config.syslogPort[1]);
+    Serial.printf("Web Log Viewer: Level: %s\r\n",
+                  severityNames[config.webLevel]);
     Serial.printf("Rate Limiting: %s\r\n", 
                   config.disableRateLimit ? "DISABLED" : "ENABLED");
     // QNEthernet handles its own logging internally
@@ -328,6 +366,7 @@ void EventLogger::setStartupMode(bool startup) {
     if (!startup && startupMode) {
         // Exiting startup mode - now enforce configured levels
         startupMode = false;
+        updateActiveLevel();
         LOG_INFO(EventSource::SYSTEM, "System initialization complete - enforcing log level: %s", 
                  severityNames[config.serialLevel]);
     }
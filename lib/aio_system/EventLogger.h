@@ -47,7 +47,8 @@ struct EventConfig {
     bool enableUDP = false;
     uint8_t syslogPort[2] = {2, 2};  // Port 514 (0x0202)
     bool disableRateLimit = false;  // Flag to disable rate limiting
-    uint8_t reserved[9];  // Future expansion
+    uint8_t webLevel = static_cast<uint8_t>(EventSeverity::INFO);        // Web log buffer/viewer, INFO and above
+    uint8_t reserved[8] = {};  // Future expansion
 };
 
 // Log entry for circular buffer (web viewer)
@@ -112,6 +113,11 @@ private:
     // Rate limiting check
     bool checkRateLimit(EventSeverity severity);
     
+    // Most verbose severity any output currently takes - the LOG_* macros
+    // test it before evaluating their arguments
+    static uint8_t activeLevel;
+    void updateActiveLevel();
+    
     // QNEthernet doesn't need explicit log level management
     
     // Startup mode tracking
@@ -145,11 +151,19 @@ public:
     // Main logging function
     void log(EventSeverity severity, EventSource source, const char* format, ...);
     
+    // True when a message of this severity would reach an enabled serial or
+    // UDP output or the web log buffer (web level). Everything passes during
+    // startup mode.
+    static bool isLevelEnabled(EventSeverity severity) {
+        return static_cast<uint8_t>(severity) <= activeLevel;
+    }
+    
     // Configuration
     void loadConfig();
     void saveConfig();
     void setSerialLevel(EventSeverity level);
     void setUDPLevel(EventSeverity level);
+    void setWebLevel(EventSeverity level);
     void enableSerial(bool enable);
     void enableUDP(bool enable);
     
@@ -210,14 +224,51 @@ public:
     LogWebSocket* getLogWebSocket() const { return logWebSocket; }
 };
 
+// Build-time threshold: calls more verbose than this compile to nothing
+// (their arguments are still type-checked). -D LOG_COMPILE_LEVEL=6 drops
+// every LOG_DEBUG from the image.
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL 7
+#endif
+
+// Both gates run before the arguments are evaluated, so a disabled call on
+// a hot path costs one compare - no formatting, no rate-limit bucket
+#define LOG_ENABLED(severity) \
+    (static_cast<uint8_t>(severity) <= LOG_COMPILE_LEVEL && EventLogger::isLevelEnabled(severity))
+
+#define LOG_AT(severity, source, ...) \
+    do { \
+        if (LOG_ENABLED(severity)) { \
+            EventLogger::getInstance()->log(severity, source, __VA_ARGS__); \
+        } \
+    } while (0)
+
+// At most once per intervalMs from this call site - each expansion has its
+// own timestamp, replacing "static uint32_t lastLog" boilerplate
+#define LOG_EVERY(intervalMs, severity, source, ...) \
+    do { \
+        if (LOG_ENABLED(severity)) { \
+            static uint32_t logLastMs = 0; \
+            uint32_t logNowMs = millis(); \
+            if (logNowMs - logLastMs >= (uint32_t)(intervalMs)) { \
+                logLastMs = logNowMs; \
+                EventLogger::getInstance()->log(severity, source, __VA_ARGS__); \
+            } \
+        } \
+    } while (0)
+
 // Convenience macros for common logging patterns
-#define LOG_EMERGENCY(source, ...) EventLogger::getInstance()->log(EventSeverity::EMERGENCY, source, __VA_ARGS__)
-#define LOG_ALERT(source, ...) EventLogger::getInstance()->log(EventSeverity::ALERT, source, __VA_ARGS__)
-#define LOG_CRITICAL(source, ...) EventLogger::getInstance()->log(EventSeverity::CRITICAL, source, __VA_ARGS__)
-#define LOG_ERROR(source, ...) EventLogger::getInstance()->log(EventSeverity::ERROR, source, __VA_ARGS__)
-#define LOG_WARNING(source, ...) EventLogger::getInstance()->log(EventSeverity::WARNING, source, __VA_ARGS__)
-#define LOG_NOTICE(source, ...) EventLogger::getInstance()->log(EventSeverity::NOTICE, source, __VA_ARGS__)
-#define LOG_INFO(source, ...) EventLogger::getInstance()->log(EventSeverity::INFO, source, __VA_ARGS__)
-#define LOG_DEBUG(source, ...) EventLogger::getInstance()->log(EventSeverity::DEBUG, source, __VA_ARGS__)
+#define LOG_EMERGENCY(source, ...) LOG_AT(EventSeverity::EMERGENCY, source, __VA_ARGS__)
+#define LOG_ALERT(source, ...) LOG_AT(EventSeverity::ALERT, source, __VA_ARGS__)
+#define LOG_CRITICAL(source, ...) LOG_AT(EventSeverity::CRITICAL, source, __VA_ARGS__)
+#define LOG_ERROR(source, ...) LOG_AT(EventSeverity::ERROR, source, __VA_ARGS__)
+#define LOG_WARNING(source, ...) LOG_AT(EventSeverity::WARNING, source, __VA_ARGS__)
+#define LOG_NOTICE(source, ...) LOG_AT(EventSeverity::NOTICE, source, __VA_ARGS__)
+#define LOG_INFO(source, ...) LOG_AT(EventSeverity::INFO, source, __VA_ARGS__)
+#define LOG_DEBUG(source, ...) LOG_AT(EventSeverity::DEBUG, source, __VA_ARGS__)
+
+#define LOG_WARNING_EVERY(intervalMs, source, ...) LOG_EVERY(intervalMs, EventSeverity::WARNING, source, __VA_ARGS__)
+#define LOG_INFO_EVERY(intervalMs, source, ...) LOG_EVERY(intervalMs, EventSeverity::INFO, source, __VA_ARGS__)
+#define LOG_DEBUG_EVERY(intervalMs, source, ...) LOG_EVERY(intervalMs, EventSeverity::DEBUG, source, __VA_ARGS__)
 
 #endif // EVENTLOGGER_H_
\ No newline at end of file
@@ -0,0 +1,80 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+#include "LatencyTrace.h"
+
+static const char* const PATH_NAMES[LatencyTrace::PATH_COUNT] = {
+    "GNSS->PANDA", "IMU->PANDA", "PGN254->Motor", "CAN HB->Control"
+};
+
+LatencyTrace* LatencyTrace::instance = nullptr;
+
+LatencyTrace* LatencyTrace::getInstance() {
+    if (instance == nullptr) {
+        instance = new LatencyTrace();
+    }
+    return instance;
+}
+
+const char* LatencyTrace::getPathName(Path path) {
+    return (path < PATH_COUNT) ? PATH_NAMES[path] : "?";
+}
+
+void LatencyTrace::record(Path path, uint32_t stampCycles) {
+    if (stampCycles == 0 || path >= PATH_COUNT) {
+        return;
+    }
+
+    uint32_t us = (ARM_DWT_CYCCNT - stampCycles) / (F_CPU_ACTUAL / 1000000UL);
+
+    PathStats& s = stats[path];
+    s.count++;
+    s.totalUs += us;
+    if (us > s.maxUs) {
+        s.maxUs = us;
+    }
+
+    uint8_t bucket = (us < 2) ? 0 : 31 - __builtin_clz(us);
+    if (bucket >= HIST_BUCKETS) {
+        bucket = HIST_BUCKETS - 1;
+    }
+    s.hist[bucket]++;
+}
+
+uint32_t LatencyTrace::percentile(Path path, uint8_t pct) const {
+    const PathStats& s = stats[path];
+    if (s.count == 0) {
+        return 0;
+    }
+
+    // Rank of the sample we want (1-based, rounded up)
+    uint32_t rank = (uint32_t)(((uint64_t)s.count * pct + 99) / 100);
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < HIST_BUCKETS; i++) {
+        seen += s.hist[i];
+        if (seen >= rank) {
+            uint32_t upper = (i < HIST_BUCKETS - 1) ? ((2UL << i) - 1) : s.maxUs;
+            return (upper < s.maxUs) ? upper : s.maxUs;
+        }
+    }
+    return s.maxUs;
+}
+
+void LatencyTrace::printStats() const {
+    Serial.print("\r\n=== Sensor-to-Wire Latency (us) ===");
+    Serial.printf("\r\n%-16s %8s %8s %8s %8s %8s", "Path", "Count", "Avg", "p50", "p99", "Max");
+    for (uint8_t p = 0; p < PATH_COUNT; p++) {
+        const PathStats& s = stats[p];
+        Serial.printf("\r\n%-16s %8lu %8lu %8lu %8lu %8lu", PATH_NAMES[p], s.count,
+                      s.count ? (uint32_t)(s.totalUs / s.count) : 0,
+                      percentile((Path)p, 50), percentile((Path)p, 99), s.maxUs);
+    }
+    Serial.print("\r\n===================================\r\n");
+}
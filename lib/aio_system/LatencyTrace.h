@@ -0,0 +1,72 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+#ifndef LATENCY_TRACE_H
+#define LATENCY_TRACE_H
+
+#include <Arduino.h>
+
+/**
+ * LatencyTrace - Sensor-to-wire latency histograms
+ *
+ * Ingress code takes a cycle-counter stamp when the first byte of a message
+ * is read (stamp()), the stamp travels with the parsed data, and the output
+ * side calls record() once the data has gone out on the wire or to the motor.
+ *
+ * Stamps are raw ARM_DWT_CYCCNT values (wraps every ~7s at 600MHz, far longer
+ * than any path we trace). 0 means "no stamp", so record() ignores it.
+ * record() is loop-only - do not call it from an ISR.
+ */
+class LatencyTrace {
+public:
+    enum Path : uint8_t {
+        GNSS_TO_NAV = 0,     // First NMEA byte of the fix epoch -> PANDA/PAOGI queued
+        IMU_TO_NAV,          // First IMU packet byte -> PANDA/PAOGI carrying it queued
+        PGN254_TO_MOTOR,     // PGN 254 datagram arrival -> motor command applied
+        CAN_TO_CONTROL,      // Keya CAN heartbeat read -> autosteer control tick that sees it
+        PATH_COUNT
+    };
+
+    // Bucket b holds [2^b, 2^(b+1)) us, bucket 0 is <2us, the last is open ended
+    static constexpr uint8_t HIST_BUCKETS = 20;
+
+    struct PathStats {
+        uint32_t count;
+        uint32_t maxUs;
+        uint64_t totalUs;
+        uint32_t hist[HIST_BUCKETS];
+    };
+
+    static inline uint32_t stamp() {
+        uint32_t cycles = ARM_DWT_CYCCNT;
+        return cycles ? cycles : 1;
+    }
+
+    // Stamp for something that arrived ageMs milliseconds ago (e.g. a queued datagram)
+    static inline uint32_t stampAgo(uint32_t ageMs) {
+        uint32_t cycles = ARM_DWT_CYCCNT - ageMs * (F_CPU_ACTUAL / 1000UL);
+        return cycles ? cycles : 1;
+    }
+
+    static LatencyTrace* getInstance();
+
+    void record(Path path, uint32_t stampCycles);
+    void reset() { memset(stats, 0, sizeof(stats)); }
+
+    const PathStats& getStats(Path path) const { return stats[path]; }
+    uint32_t percentile(Path path, uint8_t pct) const;
+    static const char* getPathName(Path path);
+
+    void printStats() const;
+
+private:
+    LatencyTrace() { reset(); }
+    static LatencyTrace* instance;
+
+    PathStats stats[PATH_COUNT];
+};
+
+#endif // LATENCY_TRACE_H
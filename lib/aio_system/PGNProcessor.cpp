@@ -24,6 +24,7 @@ PGNProcessor *PGNProcessor::instance = nullptr;
 PGNProcessor::PGNProcessor()
 {
     instance = this;
+    memset(dispatch, NO_ENTRY, sizeof(dispatch));
 }
 
 PGNProcessor::~PGNProcessor()
@@ -46,106 +47,71 @@ void PGNProcessor::processPGN(const uint8_t* data, size_t len, const IPAddress&
     if (!QNetworkBase::isConnected())
         return;
 
-    if (remotePort == 9999 && len >= 5)
-    {
-        // Verify first 3 PGN header bytes
-        if (data[0] != 128 || data[1] != 129 || data[2] != 127)
-        {
-            return;
-        }
+    // Need at least header(3) + pgn(1) + length(1) + crc(1)
+    if (remotePort != 9999 || len < 6)
+        return;
 
-        // Validate CRC before processing
-        // CRC is sum of bytes from index 2 to len-2 (skip header[0,1] and CRC byte)
-        if (len >= 6) // Need at least header(3) + pgn(1) + length(1) + crc(1)
-        {
-            uint8_t pgn = data[3];
-            
-            // Special handling for AgIO PGNs (200, 201, 202) which use fixed CRC 0x47
-            if (pgn == 200 || pgn == 201 || pgn == 202) {
-                uint8_t receivedCRC = data[len - 1];
-                if (receivedCRC != 0x47) {
-                    LOG_WARNING(EventSource::NETWORK, "AgIO PGN %d invalid fixed CRC: expected 0x47, got %02X", 
-                               pgn, receivedCRC);
-                    return; // Drop packet with bad CRC
-                }
-                // AgIO packets validated - continue processing
-            } else {
-                // Normal CRC calculation for AgOpenGPS PGNs
-                uint16_t crcSum = 0;
-                for (size_t i = 2; i < len - 1; i++)
-                {
-                    crcSum += data[i];
-                }
-                uint8_t calculatedCRC = (uint8_t)(crcSum & 0xFF);
-                uint8_t receivedCRC = data[len - 1];
-                
-                if (calculatedCRC != receivedCRC)
-                {
-                    LOG_WARNING(EventSource::NETWORK, "PGN %d CRC mismatch: calc=%02X, recv=%02X", 
-                               pgn, calculatedCRC, receivedCRC);
-                    return; // Drop packet with bad CRC
-                }
-            }
-        }
+    // Verify first 3 PGN header bytes
+    if (data[0] != 128 || data[1] != 129 || data[2] != 127)
+        return;
 
-        uint8_t pgn = data[3];
-        
-        // Update last received time for ANY valid PGN
-        lastPGNReceivedTime = millis();
-        
-        // Debug: show registered callbacks for this PGN
-        if (pgn == 200) {
-            for (size_t i = 0; i < registrationCount; i++) {
-                if (registrations[i].pgn == 200) {
-                    LOG_DEBUG(EventSource::NETWORK, "Found callback: %s", registrations[i].name);
-                }
-            }
-        }
-        
-        // Check if this is a broadcast PGN (Hello or Scan Request)
-        bool isBroadcast = (pgn == 200 || pgn == 202);
-        
-        // For broadcast PGNs, call only broadcast callbacks
-        if (isBroadcast)
+    uint8_t pgn = data[3];
+    PGNEntry* entry = (dispatch[pgn] != NO_ENTRY) ? &entries[dispatch[pgn]] : nullptr;
+
+    // Validate CRC before processing
+    // AgIO PGNs (200, 201, 202) use a fixed CRC 0x47; the rest the sum of
+    // bytes from index 2 to len-2 (skip header[0,1] and CRC byte)
+    uint8_t receivedCRC = data[len - 1];
+    uint8_t expectedCRC = 0x47;
+    if (pgn != 200 && pgn != 201 && pgn != 202)
+    {
+        uint16_t crcSum = 0;
+        for (size_t i = 2; i < len - 1; i++)
         {
-            
-            const uint8_t* pgnData = &data[5];
-            size_t dataLen = len - 6; // Subtract header(3) + pgn(1) + len(1) + crc(1)
-            
-            for (size_t i = 0; i < broadcastCount; i++)
-            {
-                broadcastCallbacks[i](pgn, pgnData, dataLen);
-            }
+            crcSum += data[i];
         }
+        expectedCRC = (uint8_t)(crcSum & 0xFF);
+    }
+    if (receivedCRC != expectedCRC)
+    {
+        if (entry)
+            entry->stats.crcErrors++;
         else
-        {
-            // For non-broadcast PGNs, only call matching callbacks
-            for (size_t i = 0; i < registrationCount; i++)
-            {
-                if (registrations[i].pgn == pgn)
-                {
-                    // Found a registered handler - call it
-                    
-                    
-                    // Pass the data starting after the 5-byte header
-                    // PGN 254 data starts at position 5: speed(2), status(1), steerAngle(2), etc.
-                    const uint8_t* pgnData = &data[5];
-                    size_t dataLen = len - 6; // Subtract header(5) + crc(1)
-                    
-                    // Log when debug is enabled, but skip PGN 254 as it comes too frequently (10Hz)
-                    if (pgn != 254) {
-                        LOG_DEBUG(EventSource::NETWORK, "Calling %s for PGN %d", registrations[i].name, pgn);
-                    }
-                    registrations[i].callback(pgn, pgnData, dataLen);
-                    break; // Only one handler per non-broadcast PGN
-                }
-            }
-        }
-        
-        // PGNProcessor only routes - no built-in handlers
-        // Unhandled PGNs are simply dropped
+            unhandledCRCErrors++;
+        LOG_WARNING(EventSource::NETWORK, "PGN %d CRC mismatch: calc=%02X, recv=%02X",
+                   pgn, expectedCRC, receivedCRC);
+        return; // Drop packet with bad CRC
+    }
 
+    // Update last received time for ANY valid PGN
+    lastPGNReceivedTime = millis();
+
+    // PGNProcessor only routes - unhandled PGNs are counted and dropped
+    if (!entry)
+    {
+        unhandledCount++;
+        return;
     }
+    entry->stats.received++;
+
+    // Pass the data starting after the 5-byte header
+    // PGN 254 data starts at position 5: speed(2), status(1), steerAngle(2), etc.
+    const uint8_t* pgnData = &data[5];
+    size_t dataLen = len - 6; // Subtract header(5) + crc(1)
+
+    uint32_t start = micros();
+    for (uint8_t i = 0; i < entry->subscriberCount; i++)
+    {
+        // Log when debug is enabled, but skip PGN 254 as it comes too frequently (10Hz)
+        if (pgn != 254) {
+            LOG_DEBUG(EventSource::NETWORK, "Calling %s for PGN %d", entry->subscribers[i].name, pgn);
+        }
+        entry->subscribers[i].callback(pgn, pgnData, dataLen);
+    }
+    uint32_t elapsed = micros() - start;
+    entry->stats.handlerUsTotal += elapsed;
+    if (elapsed > entry->stats.handlerUsMax)
+        entry->stats.handlerUsMax = elapsed;
     // No need to delete buffer - QNEthernet handles memory management
 }
 
@@ -165,50 +131,57 @@ void PGNProcessor::printPgnAnnouncement(uint8_t pgn, const char *pgnName, size_t
 
 bool PGNProcessor::registerCallback(uint8_t pgn, PGNCallback callback, const char* name)
 {
-    // Check if we have room for more registrations
-    if (registrationCount >= MAX_REGISTRATIONS)
+    PGNEntry* entry = nullptr;
+    if (dispatch[pgn] != NO_ENTRY)
     {
-        LOG_ERROR(EventSource::NETWORK, "Registration failed - max callbacks reached (%d)", MAX_REGISTRATIONS);
-        return false;
+        entry = &entries[dispatch[pgn]];
     }
-    
-    // Check if this PGN is already registered
-    for (size_t i = 0; i < registrationCount; i++)
+    else
     {
-        if (registrations[i].pgn == pgn)
+        // Check if we have room for another PGN
+        if (entryCount >= MAX_PGNS)
         {
-            LOG_WARNING(EventSource::NETWORK, "PGN %d already registered to %s", pgn, registrations[i].name);
+            LOG_ERROR(EventSource::NETWORK, "Registration failed - max PGNs reached (%d)", MAX_PGNS);
             return false;
         }
+        entry = &entries[entryCount];
+        memset(entry, 0, sizeof(PGNEntry));
+        entry->pgn = pgn;
+        dispatch[pgn] = entryCount++;
     }
-    
-    // Add the new registration
-    registrations[registrationCount].pgn = pgn;
-    registrations[registrationCount].callback = callback;
-    registrations[registrationCount].name = name;
-    registrationCount++;
-    
+
+    for (uint8_t i = 0; i < entry->subscriberCount; i++)
+    {
+        if (entry->subscribers[i].callback == callback)
+        {
+            LOG_WARNING(EventSource::NETWORK, "PGN %d already registered to %s", pgn, entry->subscribers[i].name);
+            return false;
+        }
+    }
+    if (entry->subscriberCount >= MAX_SUBSCRIBERS)
+    {
+        LOG_ERROR(EventSource::NETWORK, "Registration failed - PGN %d has max subscribers (%d)", pgn, MAX_SUBSCRIBERS);
+        return false;
+    }
+
+    // Add the new subscriber
+    entry->subscribers[entry->subscriberCount].callback = callback;
+    entry->subscribers[entry->subscriberCount].name = name;
+    entry->subscriberCount++;
+
     LOG_INFO(EventSource::NETWORK, "Registered callback for PGN %d (%s)", pgn, name);
     return true;
 }
 
 bool PGNProcessor::unregisterCallback(uint8_t pgn)
 {
-    // Find the registration
-    for (size_t i = 0; i < registrationCount; i++)
+    // The entry stays so its counters survive
+    if (dispatch[pgn] != NO_ENTRY && entries[dispatch[pgn]].subscriberCount > 0)
     {
-        if (registrations[i].pgn == pgn)
-        {
-            // Found it - remove by shifting remaining entries
-            LOG_INFO(EventSource::NETWORK, "Unregistering callback for PGN %d (%s)", pgn, registrations[i].name);
-            
-            for (size_t j = i; j < registrationCount - 1; j++)
-            {
-                registrations[j] = registrations[j + 1];
-            }
-            registrationCount--;
-            return true;
-        }
+        PGNEntry& entry = entries[dispatch[pgn]];
+        LOG_INFO(EventSource::NETWORK, "Unregistering %d callback(s) for PGN %d", entry.subscriberCount, pgn);
+        entry.subscriberCount = 0;
+        return true;
     }
     
     LOG_WARNING(EventSource::SYSTEM, "PGN %d not found for unregistration", pgn);
@@ -217,27 +190,37 @@ bool PGNProcessor::unregisterCallback(uint8_t pgn)
 
 void PGNProcessor::listRegisteredCallbacks()
 {
-    LOG_INFO(EventSource::SYSTEM, "Registered callbacks (%d):", registrationCount);
-    for (size_t i = 0; i < registrationCount; i++)
+    LOG_INFO(EventSource::SYSTEM, "Registered PGNs (%d):", entryCount);
+    for (uint8_t i = 0; i < entryCount; i++)
     {
-        LOG_INFO(EventSource::SYSTEM, "  - PGN %d: %s", registrations[i].pgn, registrations[i].name);
+        for (uint8_t j = 0; j < entries[i].subscriberCount; j++)
+        {
+            LOG_INFO(EventSource::SYSTEM, "  - PGN %d: %s", entries[i].pgn, entries[i].subscribers[j].name);
+        }
     }
 }
 
 bool PGNProcessor::registerBroadcastCallback(PGNCallback callback, const char* name)
 {
-    // Check if we have room for more broadcast callbacks
-    if (broadcastCount >= MAX_BROADCAST_CALLBACKS)
+    // Hello (200) and Scan Request (202) go to every module that announces itself
+    bool registered = registerCallback(200, callback, name) && registerCallback(202, callback, name);
+    if (!registered)
     {
-        LOG_ERROR(EventSource::NETWORK, "Broadcast registration failed - max callbacks reached (%d)", MAX_BROADCAST_CALLBACKS);
+        LOG_ERROR(EventSource::NETWORK, "Broadcast registration failed for %s", name);
         return false;
     }
-    
-    // Add the new broadcast callback
-    broadcastCallbacks[broadcastCount] = callback;
-    broadcastNames[broadcastCount] = name;
-    broadcastCount++;
-    
-    LOG_INFO(EventSource::NETWORK, "Registered broadcast callback for %s (total: %d/%d)", name, broadcastCount, MAX_BROADCAST_CALLBACKS);
+
+    LOG_INFO(EventSource::NETWORK, "Registered broadcast callback for %s (total: %d/%d)",
+             name, entries[dispatch[200]].subscriberCount, MAX_SUBSCRIBERS);
     return true;
-}
\ No newline at end of file
+}
+
+void PGNProcessor::resetStats()
+{
+    for (uint8_t i = 0; i < entryCount; i++)
+    {
+        memset(&entries[i].stats, 0, sizeof(PGNStats));
+    }
+    unhandledCount = 0;
+    unhandledCRCErrors = 0;
+}
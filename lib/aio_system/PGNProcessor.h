@@ -19,33 +19,53 @@ using namespace qindesign::network;
 // Parameters: PGN number, data buffer, data length
 typedef void (*PGNCallback)(uint8_t pgn, const uint8_t* data, size_t len);
 
-// Structure to hold PGN registration info
-struct PGNRegistration {
-    uint8_t pgn;
+// A module subscribed to a PGN
+struct PGNSubscriber {
     PGNCallback callback;
     const char* name;  // For debugging
 };
 
+// Per-PGN traffic counters
+struct PGNStats {
+    uint32_t received;        // Datagrams with a good CRC
+    uint32_t crcErrors;
+    uint32_t handlerUsTotal;  // Time in all subscribers
+    uint32_t handlerUsMax;
+};
+
 class PGNProcessor
 {
 public:
     static PGNProcessor *instance;
+
+    static constexpr uint8_t MAX_SUBSCRIBERS = 4;  // Per PGN - GPS, IMU, Steer, Machine on 200/202
+    static constexpr uint8_t MAX_PGNS = 24;        // Distinct PGNs with subscribers
+
+    struct PGNEntry {
+        uint8_t pgn;
+        uint8_t subscriberCount;
+        PGNSubscriber subscribers[MAX_SUBSCRIBERS];
+        PGNStats stats;
+    };
     
 private:
-    // Array to store registered callbacks (max 20 registrations)
-    static constexpr size_t MAX_REGISTRATIONS = 20;
-    PGNRegistration registrations[MAX_REGISTRATIONS];
-    size_t registrationCount = 0;
-    
-    // Separate array for broadcast callbacks (PGN 200, 202)
-    static constexpr size_t MAX_BROADCAST_CALLBACKS = 4; // GPS, IMU, Steer, Machine
-    PGNCallback broadcastCallbacks[MAX_BROADCAST_CALLBACKS];
-    const char* broadcastNames[MAX_BROADCAST_CALLBACKS];
-    size_t broadcastCount = 0;
+    // Dispatch table indexed by PGN number, so a datagram finds its
+    // subscribers with one lookup instead of a scan
+    static constexpr uint8_t NO_ENTRY = 0xFF;
+    uint8_t dispatch[256];
+    PGNEntry entries[MAX_PGNS];
+    uint8_t entryCount = 0;
+
+    // Datagrams for PGNs nobody subscribes to, and bad CRCs among them
+    uint32_t unhandledCount = 0;
+    uint32_t unhandledCRCErrors = 0;
     
     // Track last time ANY PGN was received from AgIO
     uint32_t lastPGNReceivedTime = 0;
 
+    // LatencyTrace stamp of the datagram being dispatched (0 outside dispatch)
+    uint32_t rxTraceCycles = 0;
+
 public:
     PGNProcessor();
     ~PGNProcessor();
@@ -62,17 +82,28 @@ public:
     // Initialize the handler
     static void init();
     
-    // Callback registration methods
+    // Callback registration methods - several modules may subscribe to one PGN
     bool registerCallback(uint8_t pgn, PGNCallback callback, const char* name);
-    bool unregisterCallback(uint8_t pgn);
+    bool unregisterCallback(uint8_t pgn);  // Removes every subscriber of pgn
     void listRegisteredCallbacks();  // For debugging
     
-    // Broadcast callback registration (for PGN 200, 202)
+    // Broadcast callback registration (subscribes to PGN 200 and 202)
     bool registerBroadcastCallback(PGNCallback callback, const char* name);
     
+    // Traffic counters for the web status page
+    uint8_t getEntryCount() const { return entryCount; }
+    const PGNEntry& getEntry(uint8_t index) const { return entries[index]; }
+    uint32_t getUnhandledCount() const { return unhandledCount; }
+    uint32_t getUnhandledCRCErrors() const { return unhandledCRCErrors; }
+    void resetStats();
+    
     // Get last time any PGN was received
     uint32_t getLastPGNReceivedTime() const { return lastPGNReceivedTime; }
     
+    // Arrival stamp of the datagram currently being dispatched, for callbacks
+    void setRxTraceCycles(uint32_t cycles) { rxTraceCycles = cycles; }
+    uint32_t getRxTraceCycles() const { return rxTraceCycles; }
+    
     // Check if we're receiving PGNs from AgIO
     bool isReceivingFromAgIO() const { 
         return (millis() - lastPGNReceivedTime) < 5000; 
@@ -5,7 +5,7 @@
 // Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
 
 // QNEthernetUDPHandler.cpp
-// Implementation of UDP handling using QNEthernet's native EthernetUDP
+// Implementation of UDP handling on QNEthernet's lwIP stack
 
 #include "QNEthernetUDPHandler.h"
 #include <QNEthernet.h>
@@ -13,19 +13,84 @@
 #include "PGNProcessor.h"
 #include "RTCMProcessor.h"
 #include "EventLogger.h"
+#include "LatencyTrace.h"
 #include "DHCPLite.h"
 #include "ConfigManager.h"
 #include "ESP32Interface.h"
+#include <lwip/udp.h>
+#include <lwip/pbuf.h>
 
 using namespace qindesign::network;
 
+// Each held pbuf is one of lwIP's PBUF_POOL_SIZE (16) receive buffers, which
+// TCP and the other sockets share. The PGN and RTCM queues hold at most 4
+// each, 8 of the 16, leaving 8 for TCP, the web server and everything else.
+// Four covers an AgIO burst (254/239/229 together) or an RTCM epoch split
+// across datagrams; poll() drains both every loop.
+static constexpr uint8_t PBUF_QUEUE_SIZE = 4;
+
+struct QNEthernetUDPHandler::PbufQueue {
+    struct Entry {
+        struct pbuf* p;
+        uint32_t addr;   // lwIP byte order, as IPAddress takes it
+        uint16_t port;
+        uint32_t stamp;  // LatencyTrace stamp at arrival
+    };
+    
+    Socket socket;
+    struct udp_pcb* pcb;
+    Entry entries[PBUF_QUEUE_SIZE];
+    uint8_t head;
+    uint8_t count;
+    
+    // From the lwIP receive callback. Takes ownership of p. When full the
+    // oldest is freed, as EthernetUDP's queue overwrites it.
+    void push(struct pbuf* p, const ip_addr_t* addr, u16_t port) {
+        SocketStats& stats = socketStats[socket];
+        if (count == PBUF_QUEUE_SIZE) {
+            pbuf_free(entries[head].p);
+            head = (head + 1) % PBUF_QUEUE_SIZE;
+            count--;
+            stats.overflows++;
+        }
+        entries[(head + count) % PBUF_QUEUE_SIZE] = {p, ip_addr_get_ip4_u32(addr), port, LatencyTrace::stamp()};
+        count++;
+        if (count > stats.peakDepth) {
+            stats.peakDepth = count;
+        }
+    }
+    
+    // The caller owns entry.p afterwards and must pbuf_free() it
+    bool pop(Entry& entry) {
+        if (count == 0) {
+            return false;
+        }
+        entry = entries[head];
+        head = (head + 1) % PBUF_QUEUE_SIZE;
+        count--;
+        return true;
+    }
+};
+
 // Static member definitions
-EthernetUDP QNEthernetUDPHandler::udpPGN;
-EthernetUDP QNEthernetUDPHandler::udpRTCM;
+QNEthernetUDPHandler::PbufQueue QNEthernetUDPHandler::pgnQueue = {QNEthernetUDPHandler::SOCKET_PGN};
+QNEthernetUDPHandler::PbufQueue QNEthernetUDPHandler::rtcmQueue = {QNEthernetUDPHandler::SOCKET_RTCM};
 EthernetUDP QNEthernetUDPHandler::udpDHCP;
 EthernetUDP QNEthernetUDPHandler::udpSend;
 bool QNEthernetUDPHandler::dhcpServerEnabled = false;
-uint8_t QNEthernetUDPHandler::packetBuffer[512];
+uint8_t QNEthernetUDPHandler::packetBuffer[1472];
+uint32_t QNEthernetUDPHandler::rxStamp = 0;
+QNEthernetUDPHandler::TxSlot QNEthernetUDPHandler::txSlots[QNEthernetUDPHandler::TX_QUEUE_SLOTS];
+uint8_t QNEthernetUDPHandler::txCount = 0;
+bool QNEthernetUDPHandler::txReserved = false;
+bool QNEthernetUDPHandler::txPacking = false;
+QNEthernetUDPHandler::TxStats QNEthernetUDPHandler::txStats;
+IPAddress QNEthernetUDPHandler::txDestIP;
+uint16_t QNEthernetUDPHandler::txDestPort = 9999;
+bool QNEthernetUDPHandler::txLinkUp = false;
+uint16_t QNEthernetUDPHandler::pollBudgetUs = QNEthernetUDPHandler::DEFAULT_POLL_BUDGET_US;
+uint8_t QNEthernetUDPHandler::pollMaxPackets = QNEthernetUDPHandler::DEFAULT_POLL_MAX_PACKETS;
+QNEthernetUDPHandler::SocketStats QNEthernetUDPHandler::socketStats[QNEthernetUDPHandler::SOCKET_COUNT];
 
 // External ConfigManager
 extern ConfigManager configManager;
@@ -51,7 +116,7 @@ void QNEthernetUDPHandler::init() {
              Ethernet.linkSpeed(), Ethernet.linkIsFullDuplex() ? "Yes" : "No");
     
     // Set up PGN listener on port 8888 (AgIO sends PGNs to this port)
-    if (udpPGN.begin(8888)) {
+    if (bindQueue(pgnQueue, 8888)) {
         LOG_INFO(EventSource::NETWORK, "UDP listening on port 8888 for PGN from AgIO");
     } else {
         LOG_ERROR(EventSource::NETWORK, "Failed to start UDP on port 8888");
@@ -61,7 +126,7 @@ void QNEthernetUDPHandler::init() {
     delay(100);
     
     // Set up RTCM listener on port 2233
-    if (udpRTCM.begin(2233)) {
+    if (bindQueue(rtcmQueue, 2233)) {
         LOG_INFO(EventSource::NETWORK, "UDP listening on port 2233 for RTCM");
     } else {
         LOG_ERROR(EventSource::NETWORK, "Failed to start UDP on port 2233");
@@ -70,6 +135,8 @@ void QNEthernetUDPHandler::init() {
     // Add delay between UDP listeners
     delay(100);
     
+    refreshTxRoute();
+    
     // Initialize send socket (no specific port binding needed)
     if (udpSend.begin(0)) {  // 0 = let system choose port
         LOG_INFO(EventSource::NETWORK, "UDP send socket initialized");
@@ -86,47 +153,25 @@ void QNEthernetUDPHandler::init() {
 void QNEthernetUDPHandler::poll() {
     static uint32_t lastStatusCheck = 0;
     static bool lastLinkStatus = false;
-    static uint8_t pollCounter = 0;
 
-    // Skip every other poll to reduce overhead
-    pollCounter++;
-    if (pollCounter & 1) return;
-    
-    // Check for incoming PGN packets
-    int packetSize = udpPGN.parsePacket();
-    if (packetSize > 0 && packetSize <= sizeof(packetBuffer)) {
-        int bytesRead = udpPGN.read(packetBuffer, packetSize);
-        if (bytesRead > 0) {
-            // Process the packet
-            handlePGNPacket(packetBuffer, bytesRead, udpPGN.remoteIP(), udpPGN.remotePort());
-        }
-    }
+    txLinkUp = Ethernet.linkState();
     
-    // Check for incoming RTCM packets
-    packetSize = udpRTCM.parsePacket();
-    if (packetSize > 0 && packetSize <= sizeof(packetBuffer)) {
-        int bytesRead = udpRTCM.read(packetBuffer, packetSize);
-        if (bytesRead > 0) {
-            handleRTCMPacket(packetBuffer, bytesRead, udpRTCM.remoteIP(), udpRTCM.remotePort());
-        }
-    }
+    // PGNs first - they carry the steering commands
+    uint32_t startUs = micros();
+    drainQueue(pgnQueue, startUs, handlePGNPacket);
+    drainQueue(rtcmQueue, startUs, handleRTCMPacket);
     
     // Check for incoming DHCP packets if server is enabled
     if (dhcpServerEnabled) {
-        packetSize = udpDHCP.parsePacket();
-        if (packetSize > 0 && packetSize <= sizeof(packetBuffer)) {
-            int bytesRead = udpDHCP.read(packetBuffer, packetSize);
-            if (bytesRead > 0) {
-                handleDHCPPacket(packetBuffer, bytesRead, udpDHCP.remoteIP(), udpDHCP.remotePort());
-            }
-        }
+        drainSocket(udpDHCP, SOCKET_DHCP, startUs, handleDHCPPacket);
     }
     
     // Check link status every 5 seconds
     if (millis() - lastStatusCheck > 5000) {
         lastStatusCheck = millis();
         
-        bool currentLinkStatus = Ethernet.linkState();
+        refreshTxRoute();
+        bool currentLinkStatus = txLinkUp;
         
         // Log if link status changed
         if (currentLinkStatus != lastLinkStatus) {
@@ -158,10 +203,130 @@ void QNEthernetUDPHandler::poll() {
     }
 }
 
+bool QNEthernetUDPHandler::bindQueue(PbufQueue& queue, uint16_t port) {
+    if (queue.pcb != nullptr) {
+        return true;
+    }
+    queue.pcb = udp_new_ip_type(IPADDR_TYPE_ANY);
+    if (queue.pcb == nullptr) {
+        return false;
+    }
+    if (udp_bind(queue.pcb, IP_ANY_TYPE, port) != ERR_OK) {
+        udp_remove(queue.pcb);
+        queue.pcb = nullptr;
+        return false;
+    }
+    
+    // NO_SYS lwIP: this runs from Ethernet.loop() in yield(), never an ISR
+    udp_recv(queue.pcb, [](void* arg, struct udp_pcb*, struct pbuf* p, const ip_addr_t* addr, u16_t port) {
+        if (p != nullptr) {
+            static_cast<PbufQueue*>(arg)->push(p, addr, port);
+        }
+    }, &queue);
+    return true;
+}
+
+void QNEthernetUDPHandler::drainQueue(PbufQueue& queue, uint32_t startUs, PacketHandler handler) {
+    SocketStats& stats = socketStats[queue.socket];
+    PbufQueue::Entry entry;
+    uint8_t count = 0;
+    while (count < pollMaxPackets) {
+        if (count > 0 && micros() - startUs >= pollBudgetUs) {
+            break;
+        }
+        if (!queue.pop(entry)) {
+            return;
+        }
+        count++;
+        
+        // A datagram normally fits one pool pbuf and is handed over in place;
+        // only a reassembled IP fragment is chained and gets copied together.
+        uint16_t length = entry.p->tot_len;
+        uint8_t* copyTo = length <= sizeof(packetBuffer) ? packetBuffer : nullptr;
+        const uint8_t* data = length > 0
+            ? (const uint8_t*)pbuf_get_contiguous(entry.p, copyTo, sizeof(packetBuffer), length, 0)
+            : nullptr;
+        if (data == nullptr) {
+            stats.dropped++;
+        } else {
+            stats.datagrams++;
+            stats.bytes += length;
+            rxStamp = entry.stamp;
+            handler(data, length, IPAddress(entry.addr), entry.port);
+            rxStamp = 0;
+        }
+        pbuf_free(entry.p);
+    }
+    
+    if (queue.count > 0) {
+        stats.budgetHits++;
+    }
+}
+
+void QNEthernetUDPHandler::drainSocket(EthernetUDP& udp, Socket socket, uint32_t startUs, PacketHandler handler) {
+    SocketStats& stats = socketStats[socket];
+    uint8_t count = 0;
+    while (count < pollMaxPackets) {
+        if (count > 0 && micros() - startUs >= pollBudgetUs) {
+            stats.budgetHits++;
+            break;
+        }
+        int packetSize = udp.parsePacket();
+        if (packetSize < 0) {
+            break;  // Queue empty
+        }
+        count++;
+        
+        if (packetSize == 0 || packetSize > (int)sizeof(packetBuffer)) {
+            stats.dropped++;
+            continue;
+        }
+        int bytesRead = udp.read(packetBuffer, packetSize);
+        if (bytesRead <= 0) {
+            stats.dropped++;
+            continue;
+        }
+        stats.datagrams++;
+        stats.bytes += bytesRead;
+        handler(packetBuffer, bytesRead, udp.remoteIP(), udp.remotePort());
+    }
+    
+    if (count == pollMaxPackets) {
+        stats.budgetHits++;
+    }
+    if (count > stats.peakDepth) {
+        stats.peakDepth = count;
+    }
+}
+
+void QNEthernetUDPHandler::setPollBudget(uint16_t budgetUs, uint8_t maxPackets) {
+    pollBudgetUs = budgetUs;
+    pollMaxPackets = maxPackets > 0 ? maxPackets : 1;
+    LOG_INFO(EventSource::NETWORK, "UDP poll budget: %u us, %u datagrams per socket", pollBudgetUs, pollMaxPackets);
+}
+
+size_t QNEthernetUDPHandler::getReceiveQueueSize(Socket socket) {
+    switch (socket) {
+        case SOCKET_PGN:
+        case SOCKET_RTCM: return PBUF_QUEUE_SIZE;
+        case SOCKET_DHCP: return udpDHCP.receiveQueueSize();
+        default: return 0;
+    }
+}
+
+void QNEthernetUDPHandler::resetSocketStats() {
+    memset(socketStats, 0, sizeof(socketStats));
+}
+
 void QNEthernetUDPHandler::handlePGNPacket(const uint8_t* data, size_t len, 
                                            const IPAddress& remoteIP, uint16_t remotePort) {
     // Process PGN packet
     
+    // Trace from when lwIP handed the datagram over, not when it was polled
+    if (PGNProcessor::instance) {
+        PGNProcessor::instance->setRxTraceCycles(rxStamp);
+    }
+    
     // Forward to ESP32 if detected
     if (esp32Interface.isDetected()) {
         esp32Interface.sendToESP32(data, len);
@@ -170,6 +335,7 @@ void QNEthernetUDPHandler::handlePGNPacket(const uint8_t* data, size_t len,
     // Process the packet normally
     if (len > 0 && PGNProcessor::instance) {
         PGNProcessor::instance->processPGN(data, len, remoteIP, remotePort);
+        PGNProcessor::instance->setRxTraceCycles(0);
     }
 }
 
@@ -182,49 +348,139 @@ void QNEthernetUDPHandler::handleRTCMPacket(const uint8_t* data, size_t len,
 }
 
 void QNEthernetUDPHandler::sendUDPPacket(uint8_t* data, int length) {
-    // Check Ethernet link status
-    if (!Ethernet.linkState()) {
-        LOG_ERROR(EventSource::NETWORK, "Cannot send UDP - no Ethernet link");
+    queueUDPPacket(data, length, txDestPort);
+}
+
+void QNEthernetUDPHandler::queueUDPPacket(const uint8_t* data, size_t length, uint16_t port) {
+    if (length == 0 || length > TX_SLOT_SIZE || txReserved) {
+        txStats.failed++;
         return;
     }
     
-    // Use the broadcast address from ConfigManager
-    uint8_t destIP[4];
-    configManager.getDestIP(destIP);
-    IPAddress broadcastIP(destIP[0], destIP[1], destIP[2], destIP[3]);
+    // NMEA following NMEA to the same port can share its datagram
+    bool text = data[0] == '$' || data[0] == '#';
+    if (txPacking && text && txCount > 0) {
+        TxSlot& last = txSlots[txCount - 1];
+        if (last.port == port && (last.data[0] == '$' || last.data[0] == '#') &&
+            last.length + length <= TX_SLOT_SIZE) {
+            memcpy(last.data + last.length, data, length);
+            last.length += length;
+            txStats.queued++;
+            txStats.packed++;
+            return;
+        }
+    }
     
-    // Send packet
-    udpSend.beginPacket(broadcastIP, configManager.getDestPort());
-    udpSend.write(data, length);
-    if (!udpSend.endPacket()) {
-        LOG_ERROR(EventSource::NETWORK, "Failed to send UDP packet");
+    if (txCount == TX_QUEUE_SLOTS) {
+        txStats.earlyFlushes++;
+        flushTx();
+    }
+    TxSlot& slot = txSlots[txCount++];
+    slot.queuedUs = micros();
+    slot.port = port;
+    slot.length = length;
+    memcpy(slot.data, data, length);
+    txStats.queued++;
+    if (txCount > txStats.peakDepth) {
+        txStats.peakDepth = txCount;
     }
 }
 
-// Global function to replace sendUDPbytes
-void sendUDPbytes(uint8_t* data, int length) {
-    QNEthernetUDPHandler::sendUDPPacket(data, length);
+uint8_t* QNEthernetUDPHandler::beginPGN(uint8_t source, uint8_t pgn, uint8_t dataLength) {
+    if (txCount == TX_QUEUE_SLOTS) {
+        txStats.earlyFlushes++;
+        flushTx();
+    }
+    TxSlot& slot = txSlots[txCount];
+    slot.port = txDestPort;
+    slot.length = 5 + dataLength + 1;
+    slot.data[0] = 0x80;
+    slot.data[1] = 0x81;
+    slot.data[2] = source;
+    slot.data[3] = pgn;
+    slot.data[4] = dataLength;
+    txReserved = true;
+    return slot.data + 5;
 }
 
-// Send packet on port 9999 (for ESP32 bridge)
-void QNEthernetUDPHandler::sendUDP9999Packet(uint8_t* data, int length) {
-    // Check Ethernet link status
-    if (!Ethernet.linkState()) {
-        LOG_ERROR(EventSource::NETWORK, "Cannot send UDP9999 - no Ethernet link");
+void QNEthernetUDPHandler::commitPGN() {
+    if (!txReserved) {
+        return;
+    }
+    TxSlot& slot = txSlots[txCount++];
+    uint8_t crc = 0;
+    for (uint16_t i = 2; i < slot.length - 1; i++) {
+        crc += slot.data[i];
+    }
+    slot.data[slot.length - 1] = crc;
+    slot.queuedUs = micros();
+    txReserved = false;
+    txStats.queued++;
+    if (txCount > txStats.peakDepth) {
+        txStats.peakDepth = txCount;
+    }
+}
+
+void QNEthernetUDPHandler::flushTx() {
+    if (txCount == 0) {
         return;
     }
+    txStats.flushes++;
     
-    // Use the broadcast address from ConfigManager
-    uint8_t destIP[4];
-    configManager.getDestIP(destIP);
-    IPAddress broadcastIP(destIP[0], destIP[1], destIP[2], destIP[3]);
+    uint32_t now = micros();
+    uint8_t failed = 0;
+    for (uint8_t i = 0; i < txCount; i++) {
+        TxSlot& slot = txSlots[i];
+        uint32_t waited = now - slot.queuedUs;
+        txStats.queueUsTotal += waited;
+        if (waited > txStats.queueUsMax) {
+            txStats.queueUsMax = waited;
+        }
+        
+        if (txLinkUp && udpSend.beginPacket(txDestIP, slot.port) &&
+            udpSend.write(slot.data, slot.length) == slot.length && udpSend.endPacket()) {
+            txStats.sent++;
+        } else {
+            failed++;
+        }
+    }
     
-    // Send packet on port 9999
-    udpSend.beginPacket(broadcastIP, 9999);
-    udpSend.write(data, length);
-    if (!udpSend.endPacket()) {
-        LOG_ERROR(EventSource::NETWORK, "Failed to send UDP9999 packet");
+    // A reserved slot beyond txCount moves to the front with its contents
+    if (txReserved) {
+        memcpy(&txSlots[0], &txSlots[txCount], sizeof(TxSlot));
     }
+    txCount = 0;
+    
+    if (failed > 0) {
+        txStats.failed += failed;
+        static uint32_t lastFailLog = 0;
+        if (millis() - lastFailLog > 5000) {
+            lastFailLog = millis();
+            LOG_ERROR(EventSource::NETWORK, txLinkUp ? "Failed to send %u UDP packets" : "Cannot send %u UDP packets - no Ethernet link", failed);
+        }
+    }
+}
+
+void QNEthernetUDPHandler::refreshTxRoute() {
+    txLinkUp = Ethernet.linkState();
+    uint8_t destIP[4];
+    configManager.getDestIP(destIP);
+    txDestIP = IPAddress(destIP[0], destIP[1], destIP[2], destIP[3]);
+    txDestPort = configManager.getDestPort();
+}
+
+void QNEthernetUDPHandler::resetTxStats() {
+    memset(&txStats, 0, sizeof(txStats));
+}
+
+// Global function to replace sendUDPbytes
+void sendUDPbytes(uint8_t* data, int length) {
+    QNEthernetUDPHandler::sendUDPPacket(data, length);
+}
+
+// Send packet on port 9999 (for ESP32 bridge)
+void QNEthernetUDPHandler::sendUDP9999Packet(uint8_t* data, int length) {
+    queueUDPPacket(data, length, 9999);
 }
 
 void QNEthernetUDPHandler::enableDHCPServer(bool enable) {
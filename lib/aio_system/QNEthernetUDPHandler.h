@@ -5,8 +5,16 @@
 // Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
 
 // QNEthernetUDPHandler.h
-// UDP handler using QNEthernet's native EthernetUDP
+// UDP handler on QNEthernet's lwIP stack
 // Replaces AsyncUDPHandler with native QNEthernet implementation
+//
+// PGN and RTCM arrive through raw lwIP receive callbacks that only queue a
+// reference to the pbuf; poll() hands the payload to PGNProcessor and
+// RTCMProcessor in place and then frees it. Nothing is copied on the way in.
+//
+// Outbound datagrams are queued in preallocated slots and flushTx() sends
+// them once per loop pass to the cached destination. PGNs can be built in
+// place with beginPGN()/commitPGN().
 
 #ifndef QNETHERNETUDPHANDLER_H
 #define QNETHERNETUDPHANDLER_H
@@ -15,27 +23,128 @@
 #include <QNEthernet.h>
 #include <QNEthernetUDP.h>
 
+struct udp_pcb;
+struct pbuf;
+
 class QNEthernetUDPHandler {
 public:
+    enum Socket : uint8_t {
+        SOCKET_PGN,
+        SOCKET_RTCM,
+        SOCKET_DHCP,
+        SOCKET_COUNT
+    };
+
+    // Receive counters per listening socket
+    struct SocketStats {
+        uint32_t datagrams;
+        uint32_t bytes;
+        uint32_t dropped;     // Empty, or fragmented and larger than packetBuffer
+        uint32_t overflows;   // Oldest datagram discarded for a new one on a full queue (PGN, RTCM)
+        uint32_t budgetHits;  // Polls that stopped on the budget with datagrams possibly left
+        uint16_t peakDepth;   // Most datagrams waiting at once (DHCP: drained in one poll)
+    };
+
+    // Transmit counters
+    struct TxStats {
+        uint32_t queued;
+        uint32_t sent;         // Datagrams
+        uint32_t failed;       // No link at flush, or the stack refused the datagram
+        uint32_t packed;       // Sentences that shared a datagram with the one before
+        uint32_t earlyFlushes; // Queue full before the end of the loop pass
+        uint32_t flushes;
+        uint32_t queueUsTotal; // Time from queueing to send, per datagram
+        uint32_t queueUsMax;
+        uint8_t peakDepth;
+    };
+
+    static constexpr uint8_t TX_QUEUE_SLOTS = 12;
+    static constexpr uint16_t TX_SLOT_SIZE = 320;  // GNSS passthrough sentence plus CRLF
+
+    static constexpr uint16_t DEFAULT_POLL_BUDGET_US = 500;
+    static constexpr uint8_t DEFAULT_POLL_MAX_PACKETS = 16;  // Per socket per poll
+
     static void init();
-    static void sendUDPPacket(uint8_t* data, int length);
+    static void sendUDPPacket(uint8_t* data, int length);  // Queued to the AgIO port
     static void poll();  // Check for incoming packets and network status
     
+    // Reserves a queue slot holding the PGN header and returns where its
+    // dataLength bytes go; commitPGN() adds the checksum and queues it.
+    // Nothing else may be queued in between.
+    static uint8_t* beginPGN(uint8_t source, uint8_t pgn, uint8_t dataLength);
+    static void commitPGN();
+    
+    // Sends everything queued - called once per loop pass
+    static void flushTx();
+    
+    // Packing puts consecutive NMEA sentences in one datagram; AgIO splits
+    // text on line ends. Binary PGNs always go one per datagram, as AgIO
+    // only reads the first PGN of a datagram.
+    static void setTxPacking(bool enable) { txPacking = enable; }
+    static bool getTxPacking() { return txPacking; }
+    static const TxStats& getTxStats() { return txStats; }
+    static void resetTxStats();
+
+    // Each poll drains every socket until it is empty, maxPackets have been
+    // read from it, or budgetUs has passed since the poll started. Every
+    // socket gets at least one datagram per poll.
+    static void setPollBudget(uint16_t budgetUs, uint8_t maxPackets);
+    static uint16_t getPollBudgetUs() { return pollBudgetUs; }
+    static uint8_t getPollMaxPackets() { return pollMaxPackets; }
+    static const SocketStats& getSocketStats(Socket socket) { return socketStats[socket]; }
+    static size_t getReceiveQueueSize(Socket socket);
+    static void resetSocketStats();
+    
     // DHCP Server control
     static void enableDHCPServer(bool enable);
     static bool isDHCPServerEnabled();
     
     // ESP32 bridge support
-    static void sendUDP9999Packet(uint8_t* data, int length);
+    static void sendUDP9999Packet(uint8_t* data, int length);  // Queued to port 9999
     
 private:
-    static qindesign::network::EthernetUDP udpPGN;   // For PGN traffic on port 8888
-    static qindesign::network::EthernetUDP udpRTCM;  // For RTCM traffic on port 2233
-    static qindesign::network::EthernetUDP udpDHCP;  // For DHCP server on port 67
+    struct TxSlot {
+        uint32_t queuedUs;
+        uint16_t port;
+        uint16_t length;
+        uint8_t data[TX_SLOT_SIZE];
+    };
+    
+    static TxSlot txSlots[TX_QUEUE_SLOTS];
+    static uint8_t txCount;
+    static bool txReserved;  // Slot txCount is between beginPGN() and commitPGN()
+    static bool txPacking;
+    static TxStats txStats;
+    
+    // Resolved once rather than per send; refreshed by poll()
+    static IPAddress txDestIP;
+    static uint16_t txDestPort;
+    static bool txLinkUp;
+    
+    static void refreshTxRoute();
+    static void queueUDPPacket(const uint8_t* data, size_t length, uint16_t port);
+
+    struct PbufQueue;  // Received pbufs waiting for poll(), defined in the .cpp
+    
+    static PbufQueue pgnQueue;   // For PGN traffic on port 8888
+    static PbufQueue rtcmQueue;  // For RTCM traffic on port 2233
+    static qindesign::network::EthernetUDP udpDHCP;  // For DHCP server on port 67 (replies are built in the buffer)
     static qindesign::network::EthernetUDP udpSend;  // For sending packets
     
     static bool dhcpServerEnabled;
-    static uint8_t packetBuffer[512];  // Buffer for receiving packets
+    static uint8_t packetBuffer[1472];  // DHCP, and the rare fragmented PGN/RTCM datagram
+    static uint32_t rxStamp;            // LatencyTrace stamp of the datagram being handled
+    
+    static uint16_t pollBudgetUs;
+    static uint8_t pollMaxPackets;
+    static SocketStats socketStats[SOCKET_COUNT];
+    
+    typedef void (*PacketHandler)(const uint8_t* data, size_t len,
+                                  const IPAddress& remoteIP, uint16_t remotePort);
+    static bool bindQueue(PbufQueue& queue, uint16_t port);
+    static void drainQueue(PbufQueue& queue, uint32_t startUs, PacketHandler handler);
+    static void drainSocket(qindesign::network::EthernetUDP& udp, Socket socket,
+                            uint32_t startUs, PacketHandler handler);
     
     // Packet handlers
     static void handlePGNPacket(const uint8_t* data, size_t len, 
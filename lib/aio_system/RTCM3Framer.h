@@ -0,0 +1,174 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// RTCM3Framer.h
+// Streaming RTCM 3 deframer for RTCMProcessor. A frame is the 0xD3 preamble,
+// 6 reserved bits and a 10-bit payload length, the payload (starting with
+// the 12-bit message number) and a CRC-24Q over everything before it.
+// Input may be split anywhere - across datagrams or serial reads - and only
+// frames whose CRC checks are handed on. After a bad length or CRC the
+// search restarts at the byte after the false preamble, so a real frame
+// inside the rejected bytes is still found. Header-only with no Arduino
+// dependencies.
+
+#ifndef RTCM3_FRAMER_H
+#define RTCM3_FRAMER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+namespace RTCM3 {
+
+static constexpr uint8_t PREAMBLE = 0xD3;
+static constexpr uint16_t HEADER_SIZE = 3;
+static constexpr uint16_t CRC_SIZE = 3;
+static constexpr uint16_t MAX_PAYLOAD = 1023;
+static constexpr uint16_t MAX_FRAME = HEADER_SIZE + MAX_PAYLOAD + CRC_SIZE;
+
+// CRC-24Q (polynomial 0x1864CFB), one table lookup per byte
+struct CRC24QTable {
+    uint32_t value[256];
+    constexpr CRC24QTable() : value() {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t crc = i << 16;
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                crc <<= 1;
+                if (crc & 0x1000000) crc ^= 0x1864CFB;
+            }
+            value[i] = crc & 0xFFFFFF;
+        }
+    }
+};
+static constexpr CRC24QTable CRC24Q_TABLE{};
+
+inline uint32_t crc24q(const uint8_t* data, size_t length)
+{
+    uint32_t crc = 0;
+    for (size_t i = 0; i < length; i++) {
+        crc = ((crc << 8) & 0xFFFFFF) ^ CRC24Q_TABLE.value[(crc >> 16) ^ data[i]];
+    }
+    return crc;
+}
+
+inline uint16_t payloadLength(const uint8_t* frame) { return ((frame[1] & 0x03) << 8) | frame[2]; }
+
+// 12-bit message number, 0 if the payload is too short to hold one
+inline uint16_t messageType(const uint8_t* frame, uint16_t frameLength)
+{
+    if (frameLength < HEADER_SIZE + 2 + CRC_SIZE) return 0;
+    return (frame[3] << 4) | (frame[4] >> 4);
+}
+
+// Observation messages say whether more of the same epoch follow - the MSM
+// multiple message bit, or the synchronous GNSS flag of 1001-1004/1009-1012.
+// True for the last observation message of an epoch.
+inline bool endsEpoch(const uint8_t* frame, uint16_t frameLength)
+{
+    uint16_t type = messageType(frame, frameLength);
+    uint16_t flagBit;  // Bit offset in the payload
+    if (type >= 1071 && type <= 1137 && type % 10 >= 1 && type % 10 <= 7) {
+        flagBit = 54;  // MSM1-7: type, station, 30-bit epoch time
+    } else if (type >= 1001 && type <= 1004) {
+        flagBit = 54;  // GPS RTK: type, station, 30-bit TOW
+    } else if (type >= 1009 && type <= 1012) {
+        flagBit = 51;  // GLONASS RTK: type, station, 27-bit epoch time
+    } else {
+        return false;
+    }
+    if (frameLength < HEADER_SIZE + flagBit / 8 + 1 + CRC_SIZE) return false;
+    return !(frame[HEADER_SIZE + flagBit / 8] & (0x80 >> (flagBit % 8)));
+}
+
+class Framer {
+public:
+    uint32_t validFrames = 0;
+    uint32_t badCRC = 0;
+    uint32_t badLength = 0;     // Preamble followed by non-zero reserved bits
+    uint32_t skippedBytes = 0;  // Bytes outside any valid frame
+
+    // Calls onFrame(frame, length) for every complete frame whose CRC checks
+    template <typename OnFrame>
+    void feed(const uint8_t* data, size_t length, OnFrame&& onFrame)
+    {
+        for (;;) {
+            if (have == 0) {
+                // Hunt for a preamble without buffering what comes before it
+                const uint8_t* start = (const uint8_t*)memchr(data, PREAMBLE, length);
+                if (!start) {
+                    skippedBytes += length;
+                    return;
+                }
+                skippedBytes += start - data;
+                length -= start - data;
+                data = start;
+                need = HEADER_SIZE;
+            }
+
+            if (have < need) {
+                uint16_t want = need - have;
+                uint16_t take = length < want ? (uint16_t)length : want;
+                memcpy(buffer + have, data, take);
+                have += take;
+                data += take;
+                length -= take;
+                if (have < need) return;
+            }
+
+            if (need == HEADER_SIZE) {
+                if (buffer[1] & 0xFC) {
+                    badLength++;
+                    drop(1);
+                } else {
+                    need = HEADER_SIZE + payloadLength(buffer) + CRC_SIZE;
+                }
+                continue;
+            }
+
+            uint16_t crcAt = need - CRC_SIZE;
+            uint32_t received = ((uint32_t)buffer[crcAt] << 16) | ((uint32_t)buffer[crcAt + 1] << 8) | buffer[crcAt + 2];
+            if (crc24q(buffer, crcAt) == received) {
+                validFrames++;
+                onFrame((const uint8_t*)buffer, need);
+                skippedBytes -= need;  // drop() counts them, but they were used
+                drop(need);
+            } else {
+                badCRC++;
+                drop(1);
+            }
+        }
+    }
+
+    // Drops a partial frame (e.g. after input was lost), counting it as skipped
+    void reset()
+    {
+        skippedBytes += have;
+        have = 0;
+        need = HEADER_SIZE;
+    }
+    uint16_t pending() const { return have; }
+
+private:
+    uint8_t buffer[MAX_FRAME];
+    uint16_t have = 0;
+    uint16_t need = HEADER_SIZE;
+
+    // Discards count bytes from the front, then anything up to the next
+    // buffered preamble. Bytes after a false preamble may hold a real frame.
+    void drop(uint16_t count)
+    {
+        const uint8_t* next = have > count ? (const uint8_t*)memchr(buffer + count, PREAMBLE, have - count) : nullptr;
+        uint16_t keep = next ? have - (uint16_t)(next - buffer) : 0;
+        skippedBytes += have - keep;
+        memmove(buffer, buffer + (have - keep), keep);
+        have = keep;
+        need = HEADER_SIZE;
+    }
+};
+
+} // namespace RTCM3
+
+#endif // RTCM3_FRAMER_H
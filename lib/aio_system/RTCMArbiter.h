@@ -0,0 +1,180 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+
+// RTCMArbiter.h
+// Chooses which RTCM source feeds GPS1 when network and radio both deliver.
+// Each source's frames are tracked per epoch: an epoch ends with the last
+// observation message (RTCM3::endsEpoch), so the next frame starts one.
+// Only the primary's frames are forwarded. Another source takes over when
+// the primary misses its next epoch, or keeps delivering incomplete epochs
+// while the other is clean - and only where the new source's epoch starts,
+// so GPS1 never gets an epoch made of two sources' messages. A source that
+// sends no observation messages has no epochs to align to; it takes over
+// once it has been waiting a quiet timeout. Log-free and header-only with no
+// Arduino dependencies so host tools can use it.
+
+#ifndef RTCM_ARBITER_H
+#define RTCM_ARBITER_H
+
+#include <stdint.h>
+
+class RTCMArbiter {
+public:
+    static constexpr uint8_t SOURCE_COUNT = 2;  // RTCMSource values
+    static constexpr uint32_t DEFAULT_TIMEOUT_MS = 1500;  // Before the epoch spacing is known
+    static constexpr uint32_t MAX_TIMEOUT_MS = 5000;
+
+    struct Source {
+        uint32_t lastFrameMillis;     // 0 = nothing yet
+        uint32_t lastEpochMillis;     // Last epoch-ending observation frame, 0 = none yet
+        uint32_t epochIntervalMs;     // Smoothed epoch spacing, 0 until seen
+        uint32_t errorsAtEpochStart;  // Source errors when the epoch began
+        uint8_t epochHistory;         // Last 8 epochs, bit set = arrived clean
+        uint8_t epochCount;           // Epochs seen, stops at 8
+        bool atEpochStart;            // An epoch just ended; the next frame begins one
+    };
+
+    RTCMArbiter()
+    {
+        for (Source& s : sources) {
+            s = Source{};
+        }
+    }
+
+    // Epoch due at lastEpochMillis + interval; the margin absorbs arrival
+    // jitter. Also how long a source may go silent and still count as live.
+    static uint32_t quietTimeout(const Source& s)
+    {
+        if (s.epochIntervalMs == 0) return DEFAULT_TIMEOUT_MS;
+        uint32_t margin = s.epochIntervalMs / 8 > 100 ? s.epochIntervalMs / 8 : 100;
+        uint32_t timeout = s.epochIntervalMs + margin;
+        return timeout < MAX_TIMEOUT_MS ? timeout : MAX_TIMEOUT_MS;
+    }
+
+    // Every valid frame from source index. errors counts the source's bad
+    // and cut frames so far. Returns true when the frame goes to GPS1.
+    bool frame(uint8_t index, bool endsEpoch, uint32_t errors, uint32_t now)
+    {
+        Source& s = sources[index];
+        s.lastFrameMillis = now;
+
+        poll(now);
+        if (pendingPrimary == index &&
+            (s.atEpochStart || (s.lastEpochMillis == 0 && now - pendingSince >= quietTimeout(s)))) {
+            switchTo(index, pendingReason, now);
+        } else if (primary < 0) {
+            primary = index;
+        }
+
+        bool forward = (primary == index);
+        s.atEpochStart = false;
+        if (endsEpoch) {
+            noteEpochEnd(s, errors, now);
+        }
+        return forward;
+    }
+
+    // Re-evaluates the primary; called per frame and from the main loop
+    void poll(uint32_t now)
+    {
+        if (primary < 0) return;
+
+        const Source& current = sources[primary];
+        bool primaryQuiet = current.lastEpochMillis != 0 && current.epochIntervalMs != 0
+                                ? now - current.lastEpochMillis > quietTimeout(current)
+                                : now - current.lastFrameMillis > quietTimeout(current);
+        uint8_t incomplete = current.epochCount - __builtin_popcount(history(current));
+
+        int8_t candidate = -1;
+        const char* reason = nullptr;
+        for (uint8_t i = 0; i < SOURCE_COUNT; i++) {
+            const Source& s = sources[i];
+            if (i == primary || s.lastFrameMillis == 0 || now - s.lastFrameMillis > quietTimeout(s)) continue;
+
+            if (primaryQuiet) {
+                candidate = i;
+                reason = "primary quiet";
+                break;
+            }
+            // Complete epochs win over a source dropping parts of them
+            if (incomplete >= 3 && s.epochCount == 8 && s.epochHistory == 0xFF) {
+                candidate = i;
+                reason = "primary epochs incomplete";
+                break;
+            }
+        }
+
+        if (candidate >= 0 && candidate != pendingPrimary) {
+            pendingPrimary = candidate;
+            pendingReason = reason;
+            pendingSince = now;
+        } else if (candidate < 0) {
+            pendingPrimary = -1;  // Primary recovered before the handover
+        }
+    }
+
+    // Clean-epoch history restarts with the caller's error counters
+    void resetHealth()
+    {
+        for (Source& s : sources) {
+            s.errorsAtEpochStart = 0;
+            s.epochHistory = 0;
+            s.epochCount = 0;
+        }
+    }
+
+    // Last 8 epochs, only as many bits as were seen
+    static uint8_t history(const Source& s)
+    {
+        return s.epochCount >= 8 ? s.epochHistory : s.epochHistory & ((1 << s.epochCount) - 1);
+    }
+
+    const Source& getSource(uint8_t index) const { return sources[index]; }
+    int8_t getPrimary() const { return primary; }  // -1 before any frame
+    int8_t getPendingPrimary() const { return pendingPrimary; }
+    uint32_t getSwitchCount() const { return switchCount; }
+    uint32_t getLastSwitchMillis() const { return lastSwitchMillis; }
+    const char* getLastSwitchReason() const { return lastSwitchReason; }
+
+private:
+    Source sources[SOURCE_COUNT];
+    int8_t primary = -1;
+    int8_t pendingPrimary = -1;   // Takes over at its next epoch start
+    const char* pendingReason = nullptr;
+    uint32_t pendingSince = 0;
+    uint32_t switchCount = 0;
+    uint32_t lastSwitchMillis = 0;
+    const char* lastSwitchReason = "";
+
+    void noteEpochEnd(Source& s, uint32_t errors, uint32_t now)
+    {
+        // Clean = no bad or cut frames since the last epoch ended. The first
+        // epoch may have been joined part way, so it never counts as clean.
+        bool clean = s.lastEpochMillis != 0 && errors == s.errorsAtEpochStart;
+        s.epochHistory = (s.epochHistory << 1) | (clean ? 1 : 0);
+        if (s.epochCount < 8) s.epochCount++;
+
+        if (s.lastEpochMillis != 0) {
+            uint32_t interval = now - s.lastEpochMillis;
+            s.epochIntervalMs = s.epochIntervalMs ? (s.epochIntervalMs * 3 + interval) / 4 : interval;
+        }
+        s.lastEpochMillis = now;
+        s.errorsAtEpochStart = errors;
+        s.atEpochStart = true;
+    }
+
+    void switchTo(uint8_t index, const char* reason, uint32_t now)
+    {
+        primary = index;
+        pendingPrimary = -1;
+        switchCount++;
+        lastSwitchMillis = now;
+        lastSwitchReason = reason;
+    }
+};
+
+#endif // RTCM_ARBITER_H
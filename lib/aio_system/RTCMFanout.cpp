@@ -0,0 +1,194 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+#include "RTCMFanout.h"
+#include "QNetworkBase.h"
+#include "SerialManager.h"
+#include "ConfigManager.h"
+#include <QNEthernetUDP.h>
+
+using namespace qindesign::network;
+
+extern ConfigManager configManager;
+
+static EthernetUDP udpFanout;
+
+RTCMFanout::RTCMFanout()
+{
+    static const char *const names[OUTPUT_COUNT] = {"GPS2", "RS232", "UDP"};
+    memset(outputs, 0, sizeof(outputs));
+    for (uint8_t i = 0; i < OUTPUT_COUNT; i++)
+    {
+        outputs[i].name = names[i];
+        outputs[i].policy = DropPolicy::DROP_OLDEST;
+    }
+    oldestSeq = 0;
+    nextSeq = 0;
+    writePos = 0;
+    udpPort = DEFAULT_UDP_PORT;
+}
+
+void RTCMFanout::configure(uint8_t outputMask, const IPAddress &ip, uint16_t port)
+{
+    for (uint8_t i = 0; i < OUTPUT_COUNT; i++)
+    {
+        Output &output = outputs[i];
+        output.enabled = outputMask & (1 << i);
+        if (!output.enabled)
+        {
+            output.count = 0;
+        }
+    }
+
+    udpIP = ip;
+    if (udpIP == IPAddress(0, 0, 0, 0))
+    {
+        uint8_t destIP[4];
+        configManager.getDestIP(destIP);
+        udpIP = IPAddress(destIP[0], destIP[1], destIP[2], destIP[3]);
+    }
+    udpPort = port ? port : DEFAULT_UDP_PORT;
+}
+
+void RTCMFanout::publish(const uint8_t *frame, uint16_t length)
+{
+    bool anyEnabled = false;
+    for (const Output &output : outputs)
+    {
+        anyEnabled |= output.enabled;
+    }
+    if (!anyEnabled || length > STORE_SIZE)
+        return;
+
+    // Frames stay contiguous so each goes out in one write. Frames left past
+    // writePos are from the previous lap - the oldest - and go before wrapping.
+    if (writePos + length > STORE_SIZE)
+    {
+        while (oldestSeq != nextSeq && frames[oldestSeq % MAX_FRAMES].offset >= writePos)
+        {
+            oldestSeq++;
+        }
+        writePos = 0;
+    }
+
+    // The store is a ring in arrival order, so the frames the new one
+    // overwrites are always the oldest. Outputs still holding them drop them.
+    while (oldestSeq != nextSeq)
+    {
+        const StoredFrame &old = frames[oldestSeq % MAX_FRAMES];
+        bool overlaps = old.offset < writePos + length && writePos < old.offset + old.length;
+        if (!overlaps && nextSeq - oldestSeq < MAX_FRAMES)
+            break;
+        oldestSeq++;
+    }
+
+    memcpy(store + writePos, frame, length);
+    frames[nextSeq % MAX_FRAMES] = {writePos, length};
+    writePos += length;
+    uint32_t seq = nextSeq++;
+
+    for (Output &output : outputs)
+    {
+        if (!output.enabled)
+            continue;
+
+        if (output.count == QUEUE_DEPTH)
+        {
+            output.dropped++;
+            if (output.policy == DropPolicy::DROP_NEWEST)
+                continue;
+            output.head = (output.head + 1) % QUEUE_DEPTH;
+            output.count--;
+        }
+        output.queue[(output.head + output.count) % QUEUE_DEPTH] = seq;
+        output.count++;
+        if (output.count > output.peakQueued)
+            output.peakQueued = output.count;
+    }
+
+    drain();
+}
+
+void RTCMFanout::drain()
+{
+    for (uint8_t i = 0; i < OUTPUT_COUNT; i++)
+    {
+        Output &output = outputs[i];
+        while (output.count > 0)
+        {
+            uint32_t seq = output.queue[output.head];
+            if (isStored(seq))
+            {
+                const StoredFrame &stored = frames[seq % MAX_FRAMES];
+                SendResult result = send(i, store + stored.offset, stored.length);
+                if (result == WAIT)
+                    break;
+                if (result == SENT)
+                {
+                    output.frames++;
+                    output.bytes += stored.length;
+                }
+                else
+                {
+                    output.dropped++;
+                }
+            }
+            else
+            {
+                output.dropped++;  // Overwritten while this output fell behind
+            }
+            output.head = (output.head + 1) % QUEUE_DEPTH;
+            output.count--;
+        }
+    }
+}
+
+RTCMFanout::SendResult RTCMFanout::send(uint8_t id, const uint8_t *frame, uint16_t length)
+{
+    switch (id)
+    {
+    case OUTPUT_GPS2:
+    case OUTPUT_RS232:
+    {
+        // Whole frames only, so a rover never gets a partial frame and
+        // write() never waits on the UART. The TX buffers hold a maximum frame.
+        HardwareSerial &port = (id == OUTPUT_GPS2) ? SerialGPS2 : SerialRS232;
+        if (port.availableForWrite() < length)
+            return WAIT;
+        port.write(frame, length);
+        return SENT;
+    }
+    case OUTPUT_UDP:
+        if (!QNetworkBase::isConnected())
+            return FAILED;
+        udpFanout.beginPacket(udpIP, udpPort);
+        udpFanout.write(frame, length);
+        return udpFanout.endPacket() ? SENT : FAILED;
+    default:
+        return FAILED;
+    }
+}
+
+bool RTCMFanout::hasPending() const
+{
+    for (const Output &output : outputs)
+    {
+        if (output.count > 0)
+            return true;
+    }
+    return false;
+}
+
+void RTCMFanout::resetStats()
+{
+    for (Output &output : outputs)
+    {
+        output.frames = 0;
+        output.bytes = 0;
+        output.dropped = 0;
+        output.peakQueued = output.count;
+    }
+}
@@ -0,0 +1,91 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// RTCMFanout.h
+// Re-publishes the frames RTCMProcessor sends to GPS1 to further rovers:
+// SerialGPS2, SerialRS232 and UDP. Each frame is copied once into a shared
+// store; every output keeps its own queue of references into it and its own
+// drop policy. An output only takes a frame it can send whole without
+// waiting, so a slow one falls behind and drops frames - it never holds up
+// GPS1 or the other outputs.
+
+#ifndef RTCM_FANOUT_H
+#define RTCM_FANOUT_H
+
+#include "Arduino.h"
+#include <QNEthernet.h>
+
+class RTCMFanout
+{
+public:
+    enum OutputId : uint8_t {
+        OUTPUT_GPS2,
+        OUTPUT_RS232,
+        OUTPUT_UDP,
+        OUTPUT_COUNT
+    };
+
+    enum class DropPolicy : uint8_t {
+        DROP_OLDEST,  // Queue full: discard the oldest queued frame - fresh corrections win
+        DROP_NEWEST   // Queue full: discard the new frame - what is queued goes out intact
+    };
+
+    static constexpr uint16_t STORE_SIZE = 8192;  // Several epochs of MSM7 from 4 systems
+    static constexpr uint8_t MAX_FRAMES = 64;     // Power of 2
+    static constexpr uint8_t QUEUE_DEPTH = 16;    // Frame references per output
+    static constexpr uint16_t DEFAULT_UDP_PORT = 2234;  // Not 2233, which RTCMProcessor listens on
+
+    struct Output {
+        const char *name;
+        bool enabled;
+        DropPolicy policy;
+        uint32_t queue[QUEUE_DEPTH];  // Frame sequence numbers
+        uint8_t head;
+        uint8_t count;
+        uint8_t peakQueued;
+        uint32_t frames;   // Sent
+        uint32_t bytes;
+        uint32_t dropped;  // Queue full, overwritten in the store, or the send failed
+    };
+
+    RTCMFanout();
+
+    // outputMask bit n enables OutputId n. udpIP 0.0.0.0 = the module's broadcast address.
+    void configure(uint8_t outputMask, const IPAddress &udpIP, uint16_t udpPort);
+    void setPolicy(uint8_t id, DropPolicy policy) { outputs[id].policy = policy; }
+
+    void publish(const uint8_t *frame, uint16_t length);
+    void drain();
+    bool hasPending() const;
+
+    const Output &getOutput(uint8_t id) const { return outputs[id]; }
+    const IPAddress &getUDPIP() const { return udpIP; }
+    uint16_t getUDPPort() const { return udpPort; }
+    void resetStats();
+
+private:
+    enum SendResult : uint8_t { SENT, WAIT, FAILED };
+
+    struct StoredFrame {
+        uint16_t offset;
+        uint16_t length;
+    };
+
+    uint8_t store[STORE_SIZE];
+    StoredFrame frames[MAX_FRAMES];  // Indexed by sequence % MAX_FRAMES
+    uint32_t oldestSeq;
+    uint32_t nextSeq;
+    uint16_t writePos;
+
+    Output outputs[OUTPUT_COUNT];
+    IPAddress udpIP;
+    uint16_t udpPort;
+
+    bool isStored(uint32_t seq) const { return seq - oldestSeq < nextSeq - oldestSeq; }
+    SendResult send(uint8_t id, const uint8_t *frame, uint16_t length);
+};
+
+#endif // RTCM_FANOUT_H
@@ -9,12 +9,15 @@
 #include "LEDManagerFSM.h"
 #include "SerialManager.h"
 #include "EventLogger.h"
+#include "ConfigManager.h"
 
 // SerialGPS1 is defined in SerialManager.h
 
 // External LED manager
 extern LEDManagerFSM ledManagerFSM;
 
+extern ConfigManager configManager;
+
 // External UDP instances from QNetworkBase
 extern EthernetUDP udpRTCM;
 
@@ -27,6 +30,13 @@ RTCMProcessor *RTCMProcessor::instance = nullptr;
 RTCMProcessor::RTCMProcessor()
 {
     instance = this;
+    resetStats();
+    applyOutputConfig();
+    lastLogMillis = 0;
+    radioBytesToGap = 0;
+    lastRadioMillis = 0;
+    lastRadioLogMillis = 0;
+    radioActive = false;
 }
 
 RTCMProcessor::~RTCMProcessor()
@@ -50,89 +60,270 @@ void RTCMProcessor::processRTCM(const uint8_t *data, size_t len, const IPAddress
     if (!QNetworkBase::isConnected())
         return;
 
-    // We receive RTCM on port 2233, regardless of source port
-    // Just check that we have valid RTCM data (min 5 bytes)
-    if (len >= 5)
-    {
-        // Write directly to serial port
-        SerialGPS1.write(data, len);
+    // We receive RTCM on port 2233, regardless of source port.
+    // Frames may span datagrams; partial or corrupt ones never reach GPS1.
+    SourceState &network = sources[(uint8_t)RTCMSource::NETWORK];
+    datagramCount++;
+    bool forwarded = false;
+    network.framer.feed(data, len, [this, &forwarded](const uint8_t *frame, uint16_t length) {
+        forwarded |= handleFrame(RTCMSource::NETWORK, frame, length);
+    });
 
+    if (forwarded)
+    {
         // Pulse GPS LED blue for RTCM packet
         ledManagerFSM.pulseRTCM();
+    }
+
+    // Log RTCM activity periodically
+    if (millis() - lastLogMillis > 60000)
+    {
+        lastLogMillis = millis();
+        LOG_INFO(EventSource::NETWORK, "RTCM: %lu frames, %lu bad CRC, %lu bytes skipped from %d.%d.%d.%d:%d",
+                 network.framer.validFrames, network.framer.badCRC, network.framer.skippedBytes,
+                 remoteIP[0], remoteIP[1], remoteIP[2], remoteIP[3], remotePort);
+    }
+    // No need to delete buffer - QNEthernet handles memory management
+}
+
+const char *RTCMProcessor::getSourceName(RTCMSource source)
+{
+    return source == RTCMSource::NETWORK ? "Network" : "Radio";
+}
+
+bool RTCMProcessor::handleFrame(RTCMSource source, const uint8_t *frame, uint16_t length)
+{
+    uint8_t index = (uint8_t)source;
+    SourceState &state = sources[index];
+    int8_t previous = arbiter.getPrimary();
+
+    // The arbiter hands over only where an epoch starts, so GPS1 never sees
+    // one epoch made of two sources' messages
+    uint32_t errors = state.framer.badCRC + state.framer.badLength + state.framesCut;
+    bool forwarded = arbiter.frame(index, RTCM3::endsEpoch(frame, length), errors, millis());
+
+    if (previous < 0 && arbiter.getPrimary() >= 0)
+    {
+        LOG_INFO(EventSource::NETWORK, "RTCM: using %s corrections", getSourceName(source));
+    }
+    else if (arbiter.getPrimary() != previous)
+    {
+        LOG_WARNING(EventSource::NETWORK, "RTCM: switched from %s to %s (%s)",
+                    getSourceName((RTCMSource)previous), getSourceName(source), arbiter.getLastSwitchReason());
+    }
 
-        // Log RTCM activity periodically
-        static uint32_t lastRTCMLog = 0;
-        static uint32_t rtcmPacketCount = 0;
-        rtcmPacketCount++;
+    if (forwarded)
+    {
+        forwardFrame(frame, length);
+    }
+    else
+    {
+        state.standbyFrames++;
+    }
+    return forwarded;
+}
+
+void RTCMProcessor::applyOutputConfig()
+{
+    uint8_t ip[4];
+    configManager.getRTCMUdpIP(ip);
+    fanout.configure(configManager.getRTCMOutputMask(), IPAddress(ip[0], ip[1], ip[2], ip[3]),
+                     configManager.getRTCMUdpPort());
+}
+
+void RTCMProcessor::forwardFrame(const uint8_t *frame, uint16_t length)
+{
+    // The GPS1 TX buffer holds a whole frame, so this doesn't wait on the UART
+    SerialGPS1.write(frame, length);
+    fanout.publish(frame, length);
+    recordFrame(frame, length);
+}
+
+void RTCMProcessor::recordFrame(const uint8_t *frame, uint16_t length)
+{
+    uint16_t type = RTCM3::messageType(frame, length);
+    uint32_t now = millis();
+    totalBytes += length;
+    lastFrameMillis = now;
 
-        if (millis() - lastRTCMLog > 60000)
+    uint8_t i = 0;
+    while (i < messageTypeCount && messageStats[i].type != type)
+    {
+        i++;
+    }
+    if (i == messageTypeCount)
+    {
+        if (messageTypeCount == MAX_MESSAGE_TYPES)
         {
-            lastRTCMLog = millis();
-            LOG_INFO(EventSource::NETWORK, "RTCM: %lu packets from %d.%d.%d.%d:%d",
-                     rtcmPacketCount, remoteIP[0], remoteIP[1], remoteIP[2], remoteIP[3], remotePort);
-            rtcmPacketCount = 0;
+            return;  // Table full - still counted in the totals
         }
+        memset(&messageStats[i], 0, sizeof(MessageStats));
+        messageStats[i].type = type;
+        messageTypeCount++;
     }
-    // No need to delete buffer - QNEthernet handles memory management
+
+    messageStats[i].count++;
+    messageStats[i].bytes += length;
+    messageStats[i].lastMillis = now;
+}
+
+void RTCMProcessor::updateRates()
+{
+    uint32_t elapsed = millis() - lastRateMillis;
+    if (elapsed < 1000)
+        return;
+
+    for (uint8_t i = 0; i < messageTypeCount; i++)
+    {
+        MessageStats &stats = messageStats[i];
+        stats.bytesPerSec = (stats.bytes - stats.bytesAtSample) * 1000UL / elapsed;
+        stats.bytesAtSample = stats.bytes;
+    }
+    totalBytesPerSec = (totalBytes - totalBytesAtSample) * 1000UL / elapsed;
+    totalBytesAtSample = totalBytes;
+    lastRateMillis = millis();
+}
+
+void RTCMProcessor::resetStats()
+{
+    for (SourceState &state : sources)
+    {
+        state.framer.validFrames = 0;
+        state.framer.badCRC = 0;
+        state.framer.badLength = 0;
+        state.framer.skippedBytes = 0;
+        state.standbyFrames = 0;
+        state.framesCut = 0;
+    }
+    arbiter.resetHealth();
+    fanout.resetStats();
+    radioOverruns = 0;
+    radioSaturations = 0;
+    radioBytes = 0;
+    messageTypeCount = 0;
+    datagramCount = 0;
+    totalBytes = 0;
+    totalBytesAtSample = 0;
+    totalBytesPerSec = 0;
+    lastRateMillis = millis();
+    lastFrameMillis = 0;
+}
+
+bool RTCMProcessor::checkRadioLoss()
+{
+    // SerialRadio is Serial3 = LPUART2. OR is set when the 4-byte hardware FIFO
+    // overflowed before the RX interrupt ran. Clear it (write 1) without
+    // touching the other write-1-to-clear flags the core's ISR relies on.
+    const uint32_t otherW1C = LPUART_STAT_LBKDIF | LPUART_STAT_RXEDGIF | LPUART_STAT_IDLE |
+                              LPUART_STAT_NF | LPUART_STAT_FE | LPUART_STAT_PF |
+                              LPUART_STAT_MA1F | LPUART_STAT_MA2F;
+    bool lost = false;
+    uint32_t stat = LPUART2_STAT;
+    if (stat & LPUART_STAT_OR)
+    {
+        LPUART2_STAT = stat & ~otherW1C;
+        radioOverruns++;
+        lost = true;
+    }
+
+    // A full RX buffer (core 64 + ours) means the ISR has been dropping bytes
+    if (SerialRadio.available() >= 64 + SerialManager::RADIO_BUFFER_SIZE - 1)
+    {
+        radioSaturations++;
+        lost = true;
+    }
+    return lost;
 }
 
 void RTCMProcessor::processRadioRTCM()
 {
-    // Static variables for diagnostic tracking
-    static uint32_t radioByteCount = 0;
-    static uint32_t forwardedByteCount = 0;
-    static uint32_t lastRadioLog = 0;
-    static uint32_t lastDataTime = 0;
-    static bool radioDataActive = false;
-    // Simple direct forwarding - exactly like the working test code
-    if (SerialRadio.available())
-    {
-        // Track activity
-        if (!radioDataActive)
+    int avail = SerialRadio.available();
+    if (avail == 0 && !radioActive)
+    {
+        return;
+    }
+
+    SourceState &radio = sources[(uint8_t)RTCMSource::RADIO];
+
+    // The loss happened after everything now buffered - mark where it is
+    if (radioBytesToGap == 0 && checkRadioLoss())
+    {
+        radioBytesToGap = avail;
+        if (radioBytesToGap == 0 && radio.framer.pending())
         {
-            radioDataActive = true;
-            LOG_INFO(EventSource::NETWORK, "Radio RTCM data stream started");
+            radio.framesCut++;
+            radio.framer.reset();
         }
+    }
+
+    uint8_t block[RADIO_BLOCK_SIZE];
+    int budget = RADIO_DRAIN_BUDGET;
+    bool forwarded = false;
+    while (avail > 0 && budget > 0)
+    {
+        int n = avail < RADIO_BLOCK_SIZE ? avail : RADIO_BLOCK_SIZE;
+        if (n > budget) n = budget;
+        if (radioBytesToGap && (uint32_t)n > radioBytesToGap) n = radioBytesToGap;
 
-        lastDataTime = millis();
+        for (int i = 0; i < n; i++)
+        {
+            block[i] = SerialRadio.read();
+        }
+        radio.framer.feed(block, n, [this, &forwarded](const uint8_t *frame, uint16_t length) {
+            forwarded |= handleFrame(RTCMSource::RADIO, frame, length);
+        });
+        radioBytes += n;
+        budget -= n;
 
-        // Forward one byte per call - exactly like tester's working code
-        SerialGPS1.write(SerialRadio.read());
-        radioByteCount++;
-        forwardedByteCount++;
+        if (radioBytesToGap)
+        {
+            radioBytesToGap -= n;
+            if (radioBytesToGap == 0 && radio.framer.pending())
+            {
+                // The rest of this frame never arrived
+                radio.framesCut++;
+                radio.framer.reset();
+            }
+        }
+        avail = SerialRadio.available();
+    }
 
-        // Pulse LED periodically to show radio RTCM activity
-        static uint32_t lastPulse = 0;
-        if (millis() - lastPulse > 1000) // Pulse every second when receiving
+    if (budget < RADIO_DRAIN_BUDGET)
+    {
+        if (!radioActive)
         {
-            ledManagerFSM.pulseRTCM();
-            lastPulse = millis();
+            radioActive = true;
+            LOG_INFO(EventSource::NETWORK, "Radio RTCM data stream started");
         }
+        lastRadioMillis = millis();
+    }
+
+    // Pulse LED periodically to show radio RTCM activity
+    static uint32_t lastPulse = 0;
+    if (forwarded && millis() - lastPulse > 1000) // Pulse every second when receiving
+    {
+        ledManagerFSM.pulseRTCM();
+        lastPulse = millis();
     }
 
     // Log radio RTCM statistics periodically
-    if (radioByteCount > 0 && millis() - lastRadioLog > 5000)
+    if (radioActive && millis() - lastRadioLogMillis > 5000)
     {
-        lastRadioLog = millis();
-        LOG_INFO(EventSource::NETWORK, "Radio RTCM: %lu bytes received, %lu forwarded to GPS1",
-                 radioByteCount, forwardedByteCount);
+        lastRadioLogMillis = millis();
+        LOG_INFO(EventSource::NETWORK, "Radio RTCM: %lu bytes, %lu frames, %lu bad CRC, %lu skipped",
+                 radioBytes, radio.framer.validFrames, radio.framer.badCRC, radio.framer.skippedBytes);
 
-        // Check for data loss
-        if (forwardedByteCount < radioByteCount)
+        if (radioOverruns || radioSaturations)
         {
-            LOG_WARNING(EventSource::NETWORK, "Radio RTCM data loss: %lu bytes dropped",
-                        radioByteCount - forwardedByteCount);
+            LOG_WARNING(EventSource::NETWORK, "Radio RTCM data loss: %lu UART overruns, %lu RX buffer full, %lu frames cut",
+                        radioOverruns, radioSaturations, radio.framesCut);
         }
-
-        // Reset counters
-        radioByteCount = 0;
-        forwardedByteCount = 0;
     }
 
     // Detect when radio data stream stops
-    if (radioDataActive && millis() - lastDataTime > 10000)
+    if (radioActive && millis() - lastRadioMillis > 10000)
     {
-        radioDataActive = false;
+        radioActive = false;
         LOG_INFO(EventSource::NETWORK, "Radio RTCM data stream stopped");
     }
 }
@@ -143,4 +334,7 @@ void RTCMProcessor::process()
     // Network RTCM is handled via UDP callback
     // Process radio RTCM here
     processRadioRTCM();
+    arbiter.poll(millis());
+    fanout.drain();
+    updateRates();
 }
\ No newline at end of file
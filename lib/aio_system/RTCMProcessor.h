@@ -11,6 +11,9 @@
 #include "QNetworkBase.h"
 #include <QNEthernet.h>
 #include <QNEthernetUDP.h>
+#include "RTCM3Framer.h"
+#include "RTCMArbiter.h"
+#include "RTCMFanout.h"
 
 // QNEthernet namespace
 using namespace qindesign::network;
@@ -50,6 +53,83 @@ public:
 
     // Initialize the handler
     static void init();
+
+    // Per-message-type statistics (1005, 1074, 1084, ...)
+    struct MessageStats {
+        uint16_t type;
+        uint32_t count;
+        uint32_t bytes;
+        uint32_t lastMillis;      // Arrival of the latest frame - correction age
+        uint32_t bytesAtSample;   // bytes at the last rate sample
+        uint32_t bytesPerSec;
+    };
+    static constexpr uint8_t MAX_MESSAGE_TYPES = 24;
+
+    // Each source is deframed on its own; RTCMArbiter tracks its epochs and
+    // picks the primary, the only source whose frames reach GPS1
+    struct SourceState {
+        RTCM3::Framer framer;
+        uint32_t standbyFrames;       // Valid frames not forwarded (not primary)
+        uint32_t framesCut;           // Partial frames dropped at an input loss
+    };
+    static constexpr uint8_t SOURCE_COUNT = RTCMArbiter::SOURCE_COUNT;
+
+    uint8_t getMessageTypeCount() const { return messageTypeCount; }
+    const MessageStats& getMessageStats(uint8_t index) const { return messageStats[index]; }
+    const SourceState& getSource(RTCMSource source) const { return sources[(uint8_t)source]; }
+    const RTCMArbiter::Source& getSourceEpochs(RTCMSource source) const { return arbiter.getSource((uint8_t)source); }
+    static const char* getSourceName(RTCMSource source);
+    int8_t getPrimary() const { return arbiter.getPrimary(); }  // RTCMSource, -1 before any frame
+    uint32_t getSwitchCount() const { return arbiter.getSwitchCount(); }
+    uint32_t getLastSwitchMillis() const { return arbiter.getLastSwitchMillis(); }
+    const char* getLastSwitchReason() const { return arbiter.getLastSwitchReason(); }
+    uint32_t getRadioOverruns() const { return radioOverruns; }
+    uint32_t getRadioSaturations() const { return radioSaturations; }
+    uint32_t getDatagramCount() const { return datagramCount; }
+    uint32_t getBytesPerSec() const { return totalBytesPerSec; }
+    uint32_t getLastFrameMillis() const { return lastFrameMillis; }
+    void resetStats();
+
+    // Frames sent to GPS1 are also re-published to the outputs enabled in ConfigManager
+    void applyOutputConfig();
+    const RTCMFanout& getFanout() const { return fanout; }
+    bool hasPendingOutput() const { return fanout.hasPending(); }
+
+private:
+    // UDP datagrams and radio bytes are deframed per source; only whole
+    // frames with a good CRC are considered
+    SourceState sources[SOURCE_COUNT];
+    RTCMArbiter arbiter;
+    RTCMFanout fanout;
+
+    // Radio bytes are read from SerialRadio's RX buffer in blocks. A UART
+    // overrun or a full RX buffer means bytes were lost after what is
+    // buffered; the frame they cut is dropped at that point.
+    static constexpr uint16_t RADIO_BLOCK_SIZE = 128;
+    static constexpr uint16_t RADIO_DRAIN_BUDGET = 1024;  // Bytes per call
+    uint32_t radioOverruns;     // LPUART overrun flag seen (hardware FIFO)
+    uint32_t radioSaturations;  // RX buffer full on entry (software ring)
+    uint32_t radioBytesToGap;   // Buffered bytes before the loss, 0 if none
+    uint32_t radioBytes;
+    uint32_t lastRadioMillis;
+    uint32_t lastRadioLogMillis;
+    bool radioActive;
+
+    MessageStats messageStats[MAX_MESSAGE_TYPES];
+    uint8_t messageTypeCount;
+    uint32_t datagramCount;
+    uint32_t totalBytes;
+    uint32_t totalBytesAtSample;
+    uint32_t totalBytesPerSec;
+    uint32_t lastRateMillis;
+    uint32_t lastFrameMillis;
+    uint32_t lastLogMillis;
+
+    bool handleFrame(RTCMSource source, const uint8_t* frame, uint16_t length);
+    void recordFrame(const uint8_t* frame, uint16_t length);
+    void forwardFrame(const uint8_t* frame, uint16_t length);
+    bool checkRadioLoss();
+    void updateRates();
 };
 
 #endif // RTCMProcessor_H_
\ No newline at end of file
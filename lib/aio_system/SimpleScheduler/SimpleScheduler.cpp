@@ -12,7 +12,9 @@
 // Optional global instance
 SimpleScheduler scheduler;
 
-SimpleScheduler::SimpleScheduler() : loopCount(0) {
+SimpleScheduler::SimpleScheduler()
+    : timedTaskCount(0), timedEpoch(0), tickBudgetUs(DEFAULT_TICK_BUDGET_US), nextTimedRelease(0),
+      eventTaskCount(0), pendingEvents(0), idleSleep(false), idleCount(0), idleTimeUs(0), loopCount(0) {
     initializeGroups();
 }
 
@@ -48,33 +50,222 @@ bool SimpleScheduler::addTask(uint8_t groupIndex, TaskFunction function, const c
     task.enabled = true;
 
 #ifdef SCHEDULER_TIMING_STATS
-    task.stats = {0, 0, 0, 0};
+    task.stats = {};
 #endif
 
     group.taskCount++;
     return true;
 }
 
+bool SimpleScheduler::addTimedTask(TaskFunction function, const char* name,
+                                   uint32_t periodUs, uint32_t phaseUs,
+                                   uint8_t priority, uint32_t budgetUs) {
+    if (function == nullptr || periodUs == 0 || timedTaskCount >= MAX_TIMED_TASKS) {
+        return false;
+    }
+
+    // Phases are relative to the first timed task so the layout is deterministic
+    if (timedTaskCount == 0) {
+        timedEpoch = micros();
+    }
+
+    // Insertion sort by priority; equal priorities keep registration order
+    uint8_t pos = timedTaskCount;
+    while (pos > 0 && timedTasks[pos - 1].priority > priority) {
+        timedTasks[pos] = timedTasks[pos - 1];
+        pos--;
+    }
+
+    TimedTask& task = timedTasks[pos];
+    task.function = function;
+    task.name = name;
+    task.period = periodUs;
+    task.budget = budgetUs;
+    task.nextRun = timedEpoch + (phaseUs % periodUs);
+    task.priority = priority;
+    task.enabled = true;
+
+#ifdef SCHEDULER_TIMING_STATS
+    task.stats = {};
+#endif
+
+    timedTaskCount++;
+    return true;
+}
+
+int8_t SimpleScheduler::addEventTask(TaskFunction function, const char* name,
+                                     ReadyCheck ready, uint32_t maxIdleMs) {
+    if (function == nullptr || eventTaskCount >= MAX_EVENT_TASKS) {
+        return -1;
+    }
+
+    EventTask& task = eventTasks[eventTaskCount];
+    task.function = function;
+    task.name = name;
+    task.ready = ready;
+    task.maxIdle = maxIdleMs;
+    task.lastRun = millis();
+    task.enabled = true;
+
+#ifdef SCHEDULER_TIMING_STATS
+    task.stats = {};
+#endif
+
+    return eventTaskCount++;
+}
+
+bool SimpleScheduler::runEventTasks() {
+    // Take all pending notifications at once; anything notified while the
+    // tasks run stays pending for the next pass
+    uint32_t events = __atomic_exchange_n(&pendingEvents, 0, __ATOMIC_RELAXED);
+    uint32_t now = millis();
+    bool ranAny = false;
+
+#ifdef SCHEDULER_TIMING_STATS
+    // Notification time isn't known; lateness is the queueing delay in the pass
+    uint32_t passStart = micros();
+#endif
+
+    for (uint8_t i = 0; i < eventTaskCount; i++) {
+        EventTask& task = eventTasks[i];
+        if (!task.enabled) {
+            continue;
+        }
+
+        bool due = (events & (1UL << i)) ||
+                   (task.maxIdle > 0 && (now - task.lastRun) >= task.maxIdle) ||
+                   (task.ready && task.ready());
+        if (!due) {
+            continue;
+        }
+
+        task.lastRun = now;
+#ifdef SCHEDULER_TIMING_STATS
+        uint32_t startTime = micros();
+        task.function();
+        recordRun(task.stats, micros() - startTime, startTime - passStart);
+#else
+        task.function();
+#endif
+        ranAny = true;
+    }
+    return ranAny;
+}
+
+void SimpleScheduler::idle() {
+    // SysTick only wakes us once per ms, so don't sleep into a timed release
+    if (timedTaskCount > 0 && (int32_t)(nextTimedRelease - micros()) < 1000) {
+        return;
+    }
+
+    uint32_t start = micros();
+    __disable_irq();
+    // Re-check with interrupts masked so a notify() can't slip in before the WFI.
+    // A pending interrupt still ends WFI while masked; it is taken on re-enable.
+    if (pendingEvents == 0) {
+#ifdef SCHEDULER_HOST_SIM
+        schedulerSimWaitForInterrupt();  // Advances the virtual clock
+#else
+        asm volatile("wfi");
+#endif
+    }
+    __enable_irq();
+    idleTimeUs += micros() - start;
+    idleCount++;
+}
+
+bool SimpleScheduler::runTimedTasks() {
+    uint32_t tickStart = micros();
+    bool ranThisTick = false;
+
+    for (uint8_t i = 0; i < timedTaskCount; i++) {
+        TimedTask& task = timedTasks[i];
+        if (!task.enabled) {
+            continue;
+        }
+
+        uint32_t start = micros();
+        if ((int32_t)(start - task.nextRun) < 0) {
+            continue;  // Not released yet
+        }
+
+        // Overrun handling: once something has run this tick, push lower priority
+        // work to the next pass if it would not fit in what's left of the budget
+        if (ranThisTick && task.priority != PRIORITY_CONTROL &&
+            (start - tickStart) + task.budget > tickBudgetUs) {
+#ifdef SCHEDULER_TIMING_STATS
+            task.stats.deferrals++;
+#endif
+            continue;
+        }
+
+        uint32_t lateness = start - task.nextRun;
+
+        // Advance by whole periods so the phase is kept even after a long stall
+        task.nextRun += task.period;
+        if (lateness >= task.period) {
+            task.nextRun += (lateness / task.period) * task.period;
+        }
+
+#ifdef SCHEDULER_TIMING_STATS
+        task.function();
+        uint32_t elapsed = micros() - start;
+        recordRun(task.stats, elapsed, lateness);
+        if (task.budget > 0 && elapsed > task.budget) {
+            task.stats.budgetOverruns++;
+        }
+#else
+        task.function();
+#endif
+        ranThisTick = true;
+    }
+
+    // Earliest upcoming release, so idle() knows how long it may sleep
+    bool haveNext = false;
+    for (uint8_t i = 0; i < timedTaskCount; i++) {
+        const TimedTask& task = timedTasks[i];
+        if (task.enabled && (!haveNext || (int32_t)(task.nextRun - nextTimedRelease) < 0)) {
+            nextTimedRelease = task.nextRun;
+            haveNext = true;
+        }
+    }
+    if (!haveNext) {
+        nextTimedRelease = micros() + 1000000;  // Nothing scheduled
+    }
+
+    return ranThisTick;
+}
+
 void SimpleScheduler::run() {
     uint32_t now = millis();
     loopCount++;
 
+    // Deadline-driven tasks first so the control task starts as close to its
+    // release time as possible
+    bool didWork = false;
+    if (timedTaskCount > 0) {
+        didWork = runTimedTasks();
+    }
+
+    // Event-driven tasks only run when they have something to do
+    if (eventTaskCount > 0 && runEventTasks()) {
+        didWork = true;
+    }
+
     // Always run EVERY_LOOP tasks first (no timing check needed)
     FrequencyGroup& everyLoop = groups[EVERY_LOOP];
     if (everyLoop.enabled) {
+#ifdef SCHEDULER_TIMING_STATS
+        // EVERY_LOOP tasks are due when the pass starts; lateness is the queueing delay
+        uint32_t passStart = micros();
+#endif
         for (uint8_t i = 0; i < everyLoop.taskCount; i++) {
             Task& task = everyLoop.tasks[i];
             if (task.enabled && task.function) {
 #ifdef SCHEDULER_TIMING_STATS
                 uint32_t startTime = micros();
                 task.function();
-                uint32_t elapsed = micros() - startTime;
-                task.stats.runCount++;
-                task.stats.totalTime += elapsed;
-                task.stats.lastRunTime = elapsed;
-                if (elapsed > task.stats.maxTime) {
-                    task.stats.maxTime = elapsed;
-                }
+                recordRun(task.stats, micros() - startTime, startTime - passStart);
 #else
                 task.function();
 #endif
@@ -87,6 +278,11 @@ void SimpleScheduler::run() {
         FrequencyGroup& group = groups[g];
 
         if (group.taskCount > 0 && group.isDue(now)) {
+#ifdef SCHEDULER_TIMING_STATS
+            // Group release lateness (ms resolution) plus queueing within the group
+            uint32_t groupLateUs = (group.lastRun != 0) ? (now - group.lastRun - group.interval) * 1000 : 0;
+            uint32_t groupStart = micros();
+#endif
             group.lastRun = now;
 
             for (uint8_t i = 0; i < group.taskCount; i++) {
@@ -95,13 +291,7 @@ void SimpleScheduler::run() {
 #ifdef SCHEDULER_TIMING_STATS
                     uint32_t startTime = micros();
                     task.function();
-                    uint32_t elapsed = micros() - startTime;
-                    task.stats.runCount++;
-                    task.stats.totalTime += elapsed;
-                    task.stats.lastRunTime = elapsed;
-                    if (elapsed > task.stats.maxTime) {
-                        task.stats.maxTime = elapsed;
-                    }
+                    recordRun(task.stats, micros() - startTime, groupLateUs + (startTime - groupStart));
 #else
                     task.function();
 #endif
@@ -109,6 +299,11 @@ void SimpleScheduler::run() {
             }
         }
     }
+
+    // Nothing was ready - wait for the next interrupt instead of spinning
+    if (idleSleep && !didWork) {
+        idle();
+    }
 }
 
 bool SimpleScheduler::enableTask(uint8_t groupIndex, const char* taskName) {
@@ -153,6 +348,49 @@ bool SimpleScheduler::disableGroup(uint8_t groupIndex) {
     return true;
 }
 
+bool SimpleScheduler::enableTimedTask(const char* taskName) {
+    int taskIndex = findTimedTaskIndex(taskName);
+    if (taskIndex < 0) {
+        return false;
+    }
+
+    TimedTask& task = timedTasks[taskIndex];
+    if (!task.enabled) {
+        // Re-release on the next pass rather than replaying missed periods
+        task.nextRun = micros();
+        task.enabled = true;
+    }
+    return true;
+}
+
+bool SimpleScheduler::disableTimedTask(const char* taskName) {
+    int taskIndex = findTimedTaskIndex(taskName);
+    if (taskIndex < 0) {
+        return false;
+    }
+    timedTasks[taskIndex].enabled = false;
+    return true;
+}
+
+bool SimpleScheduler::enableEventTask(const char* taskName) {
+    int taskIndex = findEventTaskIndex(taskName);
+    if (taskIndex < 0) {
+        return false;
+    }
+    eventTasks[taskIndex].enabled = true;
+    notify(taskIndex);  // Run once promptly to catch up
+    return true;
+}
+
+bool SimpleScheduler::disableEventTask(const char* taskName) {
+    int taskIndex = findEventTaskIndex(taskName);
+    if (taskIndex < 0) {
+        return false;
+    }
+    eventTasks[taskIndex].enabled = false;
+    return true;
+}
+
 void SimpleScheduler::setGroupInterval(uint8_t groupIndex, uint32_t intervalMs) {
     if (groupIndex > 0 && groupIndex < NUM_GROUPS) {  // Can't change EVERY_LOOP interval
         groups[groupIndex].interval = intervalMs;
@@ -173,6 +411,32 @@ int SimpleScheduler::findTaskIndex(uint8_t groupIndex, const char* taskName) {
     return -1;
 }
 
+int SimpleScheduler::findTimedTaskIndex(const char* taskName) {
+    if (taskName == nullptr) {
+        return -1;
+    }
+
+    for (uint8_t i = 0; i < timedTaskCount; i++) {
+        if (timedTasks[i].name && strcmp(timedTasks[i].name, taskName) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int SimpleScheduler::findEventTaskIndex(const char* taskName) {
+    if (taskName == nullptr) {
+        return -1;
+    }
+
+    for (uint8_t i = 0; i < eventTaskCount; i++) {
+        if (eventTasks[i].name && strcmp(eventTasks[i].name, taskName) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
 void SimpleScheduler::printStatus() {
     Serial.println("\n=== SimpleScheduler Status ===");
     Serial.printf("Loop count: %lu\n", loopCount);
@@ -195,12 +459,83 @@ void SimpleScheduler::printStatus() {
             }
         }
     }
+
+    if (timedTaskCount > 0) {
+        Serial.printf("\nTimed Tasks (tick budget %luus):\n", tickBudgetUs);
+        for (uint8_t i = 0; i < timedTaskCount; i++) {
+            TimedTask& task = timedTasks[i];
+            Serial.printf("  - %s: period=%luus prio=%d budget=%luus, %s\n",
+                         task.name ? task.name : "unnamed",
+                         task.period,
+                         task.priority,
+                         task.budget,
+                         task.enabled ? "enabled" : "disabled");
+        }
+    }
+
+    if (eventTaskCount > 0) {
+        Serial.printf("\nEvent Tasks:\n");
+        for (uint8_t i = 0; i < eventTaskCount; i++) {
+            EventTask& task = eventTasks[i];
+            Serial.printf("  - %s: event=%d ready-check=%s max-idle=%lums, %s\n",
+                         task.name ? task.name : "unnamed",
+                         i,
+                         task.ready ? "yes" : "no",
+                         task.maxIdle,
+                         task.enabled ? "enabled" : "disabled");
+        }
+    }
+
+    Serial.printf("\nIdle sleep: %s (%lu sleeps, %lums total)\n",
+                  idleSleep ? "enabled" : "disabled", idleCount, idleTimeUs / 1000);
 }
 
 #ifdef SCHEDULER_TIMING_STATS
 
+uint32_t SimpleScheduler::Histogram::percentile(uint8_t pct, uint32_t maxUs) const {
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < HIST_BUCKETS; i++) {
+        total += counts[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    // Rank of the sample we want (1-based, rounded up)
+    uint32_t rank = (uint32_t)(((uint64_t)total * pct + 99) / 100);
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < HIST_BUCKETS; i++) {
+        seen += counts[i];
+        if (seen >= rank) {
+            uint32_t upper = (i < HIST_BUCKETS - 1) ? ((2UL << i) - 1) : maxUs;
+            return (upper < maxUs) ? upper : maxUs;
+        }
+    }
+    return maxUs;
+}
+
+void SimpleScheduler::recordRun(TaskStats& stats, uint32_t elapsed, uint32_t lateness) {
+    stats.runCount++;
+    stats.totalTime += elapsed;
+    stats.lastRunTime = elapsed;
+    if (elapsed > stats.maxTime) {
+        stats.maxTime = elapsed;
+    }
+    stats.totalLateness += lateness;
+    if (lateness > stats.maxLateness) {
+        stats.maxLateness = lateness;
+    }
+    stats.execHist.add(elapsed);
+    stats.lateHist.add(lateness);
+}
+
 void SimpleScheduler::printStats() {
     Serial.println("\n=== SimpleScheduler Timing Stats ===");
+    Serial.println("(p50/p99 are log2 bucket upper bounds)");
 
     for (uint8_t g = 0; g < NUM_GROUPS; g++) {
         FrequencyGroup& group = groups[g];
@@ -211,16 +546,60 @@ void SimpleScheduler::printStats() {
                 Task& task = group.tasks[i];
                 if (task.stats.runCount > 0) {
                     uint32_t avgTime = task.stats.totalTime / task.stats.runCount;
-                    Serial.printf("  %s: runs=%lu, avg=%luus, max=%luus, last=%luus\n",
+                    Serial.printf("  %s: runs=%lu, avg=%luus, p50=%luus, p99=%luus, max=%luus, last=%luus, late p99=%luus max=%luus\n",
                                  task.name ? task.name : "unnamed",
                                  task.stats.runCount,
                                  avgTime,
+                                 task.stats.execHist.percentile(50, task.stats.maxTime),
+                                 task.stats.execHist.percentile(99, task.stats.maxTime),
                                  task.stats.maxTime,
-                                 task.stats.lastRunTime);
+                                 task.stats.lastRunTime,
+                                 task.stats.lateHist.percentile(99, task.stats.maxLateness),
+                                 task.stats.maxLateness);
                 }
             }
         }
     }
+
+    if (timedTaskCount > 0) {
+        Serial.printf("\nTimed Tasks:\n");
+        for (uint8_t i = 0; i < timedTaskCount; i++) {
+            TimedTask& task = timedTasks[i];
+            if (task.stats.runCount > 0) {
+                Serial.printf("  %s: runs=%lu, avg=%luus, p50=%luus, p99=%luus, max=%luus, late avg=%luus p99=%luus max=%luus, overruns=%lu, deferred=%lu\n",
+                             task.name ? task.name : "unnamed",
+                             task.stats.runCount,
+                             task.stats.totalTime / task.stats.runCount,
+                             task.stats.execHist.percentile(50, task.stats.maxTime),
+                             task.stats.execHist.percentile(99, task.stats.maxTime),
+                             task.stats.maxTime,
+                             task.stats.totalLateness / task.stats.runCount,
+                             task.stats.lateHist.percentile(99, task.stats.maxLateness),
+                             task.stats.maxLateness,
+                             task.stats.budgetOverruns,
+                             task.stats.deferrals);
+            }
+        }
+    }
+
+    if (eventTaskCount > 0) {
+        Serial.printf("\nEvent Tasks:\n");
+        for (uint8_t i = 0; i < eventTaskCount; i++) {
+            EventTask& task = eventTasks[i];
+            if (task.stats.runCount > 0) {
+                Serial.printf("  %s: runs=%lu, avg=%luus, p50=%luus, p99=%luus, max=%luus\n",
+                             task.name ? task.name : "unnamed",
+                             task.stats.runCount,
+                             task.stats.totalTime / task.stats.runCount,
+                             task.stats.execHist.percentile(50, task.stats.maxTime),
+                             task.stats.execHist.percentile(99, task.stats.maxTime),
+                             task.stats.maxTime);
+            }
+        }
+    }
+
+    Serial.printf("\nLoops: %lu, idle sleeps: %lu, idle time: %lums\n",
+                  loopCount, idleCount, idleTimeUs / 1000);
 }
 
 void SimpleScheduler::resetStats() {
@@ -228,9 +607,19 @@ void SimpleScheduler::resetStats() {
         FrequencyGroup& group = groups[g];
         for (uint8_t i = 0; i < group.taskCount; i++) {
             Task& task = group.tasks[i];
-            task.stats = {0, 0, 0, 0};
+            task.stats = {};
         }
     }
+
+    for (uint8_t i = 0; i < timedTaskCount; i++) {
+        timedTasks[i].stats = {};
+    }
+
+    for (uint8_t i = 0; i < eventTaskCount; i++) {
+        eventTasks[i].stats = {};
+    }
+    idleCount = 0;
+    idleTimeUs = 0;
 }
 
 SimpleScheduler::TaskStats* SimpleScheduler::getTaskStats(uint8_t groupIndex, uint8_t taskIndex) {
@@ -240,4 +629,113 @@ SimpleScheduler::TaskStats* SimpleScheduler::getTaskStats(uint8_t groupIndex, ui
     return &groups[groupIndex].tasks[taskIndex].stats;
 }
 
+SimpleScheduler::TaskStats* SimpleScheduler::getTimedTaskStats(uint8_t taskIndex) {
+    if (taskIndex >= timedTaskCount) {
+        return nullptr;
+    }
+    return &timedTasks[taskIndex].stats;
+}
+
+SimpleScheduler::TaskStats* SimpleScheduler::getEventTaskStats(uint8_t taskIndex) {
+    if (taskIndex >= eventTaskCount) {
+        return nullptr;
+    }
+    return &eventTasks[taskIndex].stats;
+}
+
+uint8_t SimpleScheduler::getTotalTaskCount() const {
+    uint8_t count = timedTaskCount + eventTaskCount;
+    for (uint8_t g = 0; g < NUM_GROUPS; g++) {
+        count += groups[g].taskCount;
+    }
+    return count;
+}
+
+bool SimpleScheduler::getTaskInfo(uint8_t index, TaskInfo& info) const {
+    for (uint8_t g = 0; g < NUM_GROUPS; g++) {
+        const FrequencyGroup& group = groups[g];
+        if (index < group.taskCount) {
+            const Task& task = group.tasks[index];
+            info.name = task.name ? task.name : "unnamed";
+            info.group = g;
+            info.enabled = task.enabled && group.enabled;
+            info.stats = &task.stats;
+            return true;
+        }
+        index -= group.taskCount;
+    }
+
+    if (index < timedTaskCount) {
+        const TimedTask& task = timedTasks[index];
+        info.name = task.name ? task.name : "unnamed";
+        info.group = TIMED_GROUP;
+        info.enabled = task.enabled;
+        info.stats = &task.stats;
+        return true;
+    }
+    index -= timedTaskCount;
+
+    if (index < eventTaskCount) {
+        const EventTask& task = eventTasks[index];
+        info.name = task.name ? task.name : "unnamed";
+        info.group = EVENT_GROUP;
+        info.enabled = task.enabled;
+        info.stats = &task.stats;
+        return true;
+    }
+    return false;
+}
+
+const char* SimpleScheduler::getGroupName(uint8_t groupIndex) const {
+    if (groupIndex == TIMED_GROUP) {
+        return "Timed";
+    }
+    if (groupIndex == EVENT_GROUP) {
+        return "Event";
+    }
+    return (groupIndex < NUM_GROUPS) ? groups[groupIndex].name : "unknown";
+}
+
+size_t SimpleScheduler::buildStatsFrame(uint8_t* buffer, size_t bufferSize) const {
+    if (buffer == nullptr || bufferSize < sizeof(StatsFrameHeader)) {
+        return 0;
+    }
+
+    StatsFrameHeader header = {};
+    memcpy(header.magic, "SCHD", 4);
+    header.version = STATS_FRAME_VERSION;
+    header.bucketCount = HIST_BUCKETS;
+    header.timestamp = millis();
+    header.loopCount = loopCount;
+
+    // Records are copied field by field into the packed layout; stops at the
+    // buffer end so a small buffer just carries fewer tasks
+    size_t offset = sizeof(StatsFrameHeader);
+    uint8_t total = getTotalTaskCount();
+    for (uint8_t i = 0; i < total && offset + sizeof(StatsFrameTask) <= bufferSize; i++) {
+        TaskInfo info;
+        if (!getTaskInfo(i, info)) {
+            break;
+        }
+
+        StatsFrameTask record = {};
+        strncpy(record.name, info.name, sizeof(record.name) - 1);
+        record.group = info.group;
+        record.enabled = info.enabled ? 1 : 0;
+        record.runCount = info.stats->runCount;
+        record.maxTime = info.stats->maxTime;
+        record.maxLateness = info.stats->maxLateness;
+        record.deferrals = info.stats->deferrals;
+        memcpy(record.exec, info.stats->execHist.counts, sizeof(record.exec));
+        memcpy(record.late, info.stats->lateHist.counts, sizeof(record.late));
+
+        memcpy(buffer + offset, &record, sizeof(record));
+        offset += sizeof(record);
+        header.taskCount++;
+    }
+
+    memcpy(buffer, &header, sizeof(header));
+    return offset;
+}
+
 #endif // SCHEDULER_TIMING_STATS
\ No newline at end of file
@@ -11,7 +11,11 @@
 #ifndef SIMPLE_SCHEDULER_H
 #define SIMPLE_SCHEDULER_H
 
+#ifdef SCHEDULER_HOST_SIM
+#include "SchedulerHostShim.h"  // tools/scheduler_sim: virtual clock, no hardware
+#else
 #include <Arduino.h>
+#endif
 
 class SimpleScheduler {
 public:
@@ -28,22 +32,74 @@ public:
     static constexpr uint8_t HZ_1 = 5;
     static constexpr uint8_t HZ_0_2 = 6;
 
+    // Deadline-driven task limits
+    static constexpr uint8_t MAX_TIMED_TASKS = 16;
+    static constexpr uint32_t DEFAULT_TICK_BUDGET_US = 1000;  // Soft budget for one run() pass
+
+    // Event-driven task limits (one notify bit per task)
+    static constexpr uint8_t MAX_EVENT_TASKS = 16;
+
+    // Timed task priorities (lower value runs first)
+    static constexpr uint8_t PRIORITY_CONTROL = 0;  // Never deferred, always runs first
+    static constexpr uint8_t PRIORITY_HIGH = 1;
+    static constexpr uint8_t PRIORITY_NORMAL = 2;
+    static constexpr uint8_t PRIORITY_LOW = 3;
+
     // Task function type
     typedef void (*TaskFunction)(void);
 
+    // Cheap readiness probe for sources whose interrupt lives in the Teensy core
+    // or a library (UART RX buffers, Ethernet) and can't call notify() itself
+    typedef bool (*ReadyCheck)(void);
+
     SimpleScheduler();
 
     // Add a task to a frequency group
     bool addTask(uint8_t groupIndex, TaskFunction function, const char* name = nullptr);
 
+    // Add a deadline-driven task with its own period and phase offset.
+    // Phase spreads tasks of the same period across different ticks, budgetUs is
+    // the declared worst-case run time used to decide whether it still fits in
+    // the current tick (0 = unknown, only deferred once the tick is already over).
+    bool addTimedTask(TaskFunction function, const char* name,
+                      uint32_t periodUs, uint32_t phaseUs = 0,
+                      uint8_t priority = PRIORITY_NORMAL, uint32_t budgetUs = 0);
+
+    // Add an event-driven task that only runs when it has work: its event was
+    // notified, its ready check returns true, or maxIdleMs passed since it last
+    // ran (housekeeping such as timeouts; 0 = never).
+    // Returns the event id for notify(), or -1 if the table is full.
+    int8_t addEventTask(TaskFunction function, const char* name,
+                        ReadyCheck ready = nullptr, uint32_t maxIdleMs = 0);
+
+    // Mark an event task ready - safe to call from any ISR
+    inline void notify(uint8_t eventId) {
+        __atomic_fetch_or(&pendingEvents, 1UL << eventId, __ATOMIC_RELAXED);
+    }
+
     // Main scheduler execution - call from loop()
     void run();
 
+    // Sleep with WFI when a pass finds no event or timed task to run. Any
+    // interrupt wakes the core (UART/CAN/Ethernet RX, timers, the 1ms SysTick),
+    // so ready checks are re-evaluated right after new data arrives.
+    void setIdleSleep(bool enable) { idleSleep = enable; }
+    bool getIdleSleep() const { return idleSleep; }
+
+    // Soft time budget for one run() pass; lower priority timed tasks that would
+    // exceed it are pushed to the next pass
+    void setTickBudget(uint32_t budgetUs) { tickBudgetUs = budgetUs; }
+    uint32_t getTickBudget() const { return tickBudgetUs; }
+
     // Task control
     bool enableTask(uint8_t groupIndex, const char* taskName);
     bool disableTask(uint8_t groupIndex, const char* taskName);
     bool enableGroup(uint8_t groupIndex);
     bool disableGroup(uint8_t groupIndex);
+    bool enableTimedTask(const char* taskName);
+    bool disableTimedTask(const char* taskName);
+    bool enableEventTask(const char* taskName);
+    bool disableEventTask(const char* taskName);
 
     // Runtime frequency adjustment
     void setGroupInterval(uint8_t groupIndex, uint32_t intervalMs);
@@ -51,18 +107,89 @@ public:
     // Debug and statistics
     void printStatus();
     uint32_t getLoopCount() const { return loopCount; }
+    uint32_t getIdleCount() const { return idleCount; }
+    uint32_t getIdleTime() const { return idleTimeUs; }    // Total us spent in WFI
 
 #ifdef SCHEDULER_TIMING_STATS
+    // Log2-bucketed histogram in fixed memory: bucket 0 counts 0-1us,
+    // bucket n counts [2^n, 2^(n+1)) us, the last bucket also takes everything above
+    static constexpr uint8_t HIST_BUCKETS = 16;
+
+    struct Histogram {
+        uint32_t counts[HIST_BUCKETS];
+
+        inline void add(uint32_t us) {
+            uint8_t bucket = (us < 2) ? 0 : (31 - __builtin_clz(us));
+            counts[bucket < HIST_BUCKETS ? bucket : HIST_BUCKETS - 1]++;
+        }
+
+        // Upper bound of the bucket holding the pct-th percentile sample, capped at maxUs
+        uint32_t percentile(uint8_t pct, uint32_t maxUs) const;
+    };
+
     struct TaskStats {
         uint32_t runCount;
         uint32_t totalTime;
         uint32_t maxTime;
         uint32_t lastRunTime;
+        uint32_t totalLateness;   // Sum of start lateness (us)
+        uint32_t maxLateness;     // Worst start lateness (us)
+        // Deadline-driven tasks only
+        uint32_t budgetOverruns;  // Runs longer than the declared budget
+        uint32_t deferrals;       // Times pushed to the next tick
+        Histogram execHist;       // Run time distribution
+        Histogram lateHist;       // Start lateness distribution
+    };
+
+    // Read-only view of one task for the web/telemetry exporters.
+    // Index runs over all group tasks first, then the timed, then the event tasks.
+    static constexpr uint8_t TIMED_GROUP = 0xFF;
+    static constexpr uint8_t EVENT_GROUP = 0xFE;
+    struct TaskInfo {
+        const char* name;
+        uint8_t group;            // Group index, TIMED_GROUP or EVENT_GROUP
+        bool enabled;
+        const TaskStats* stats;
     };
 
     void printStats();
     void resetStats();
     TaskStats* getTaskStats(uint8_t groupIndex, uint8_t taskIndex);
+    TaskStats* getTimedTaskStats(uint8_t taskIndex);
+    TaskStats* getEventTaskStats(uint8_t taskIndex);
+    uint8_t getTotalTaskCount() const;
+    bool getTaskInfo(uint8_t index, TaskInfo& info) const;
+    const char* getGroupName(uint8_t groupIndex) const;
+
+    // Binary stats frame for the telemetry WebSocket (little-endian, packed)
+    struct __attribute__((packed)) StatsFrameHeader {
+        char magic[4];            // "SCHD" - telemetry packets are 32 bytes, this is larger
+        uint8_t version;
+        uint8_t taskCount;
+        uint8_t bucketCount;
+        uint8_t reserved;
+        uint32_t timestamp;       // millis()
+        uint32_t loopCount;
+    };
+
+    struct __attribute__((packed)) StatsFrameTask {
+        char name[16];            // Truncated to 15 chars, NUL padded
+        uint8_t group;
+        uint8_t enabled;
+        uint16_t reserved;
+        uint32_t runCount;
+        uint32_t maxTime;
+        uint32_t maxLateness;
+        uint32_t deferrals;
+        uint32_t exec[HIST_BUCKETS];
+        uint32_t late[HIST_BUCKETS];
+    };
+
+    static constexpr uint8_t STATS_FRAME_VERSION = 1;
+
+    // Fill buffer with a header plus one record per task; returns bytes written
+    // (0 if the buffer is too small for the header)
+    size_t buildStatsFrame(uint8_t* buffer, size_t bufferSize) const;
 #endif
 
 private:
@@ -92,14 +219,69 @@ private:
         }
     };
 
+    struct TimedTask {
+        TaskFunction function;
+        const char* name;
+        uint32_t period;        // us
+        uint32_t budget;        // us, 0 = undeclared
+        uint32_t nextRun;       // micros() deadline of the next release
+        uint8_t priority;
+        bool enabled;
+
+#ifdef SCHEDULER_TIMING_STATS
+        TaskStats stats;
+#endif
+    };
+
+    struct EventTask {
+        TaskFunction function;
+        const char* name;
+        ReadyCheck ready;       // nullptr = notify()/maxIdle only
+        uint32_t maxIdle;       // ms, 0 = no housekeeping runs
+        uint32_t lastRun;       // millis() of the last run
+        bool enabled;
+
+#ifdef SCHEDULER_TIMING_STATS
+        TaskStats stats;
+#endif
+    };
+
     FrequencyGroup groups[NUM_GROUPS];
+    TimedTask timedTasks[MAX_TIMED_TASKS];  // Kept sorted by priority
+    uint8_t timedTaskCount;
+    uint32_t timedEpoch;                    // micros() of the first timed registration
+    uint32_t tickBudgetUs;
+    uint32_t nextTimedRelease;              // Earliest nextRun of an enabled timed task
+    EventTask eventTasks[MAX_EVENT_TASKS];
+    uint8_t eventTaskCount;
+    volatile uint32_t pendingEvents;        // Set by notify(), cleared by run()
+    bool idleSleep;
+    uint32_t idleCount;
+    uint32_t idleTimeUs;
     uint32_t loopCount;
 
+    // Run due timed tasks in priority order within the tick budget.
+    // Returns true if any task ran.
+    bool runTimedTasks();
+
+    // Run event tasks with pending work. Returns true if any task ran.
+    bool runEventTasks();
+
+    // WFI until the next interrupt, unless work is pending or a timed task is
+    // about to be released
+    void idle();
+
+#ifdef SCHEDULER_TIMING_STATS
+    static void recordRun(TaskStats& stats, uint32_t elapsed, uint32_t lateness);
+#endif
+
     // Initialize group names and intervals
     void initializeGroups();
 
     // Find task by name in a group
     int findTaskIndex(uint8_t groupIndex, const char* taskName);
+    int findTimedTaskIndex(const char* taskName);
+    int findEventTaskIndex(const char* taskName);
 };
 
 // Global instance (optional - can also create in main.cpp)
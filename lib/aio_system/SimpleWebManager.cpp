@@ -20,6 +20,10 @@
 #include "AutosteerProcessor.h"
 #include "NAVProcessor.h"
 #include "GNSSProcessor.h"
+#include "LatencyTrace.h"
+#include "RTCMProcessor.h"
+#include "PGNProcessor.h"
+#include "QNEthernetUDPHandler.h"
 #include "web_pages/CommonStyles.h"  // Common CSS
 #include "web_pages/SimpleDeviceSettingsNoReplace.h"  // Device settings without replacements
 #include "web_pages/TouchFriendlyEventLoggerPage.h"  // Touch-friendly event logger page
@@ -27,6 +31,9 @@
 #include "web_pages/TouchFriendlyAnalogWorkSwitchPage.h"  // Touch-friendly analog work switch page
 #include "web_pages/TouchFriendlyOTAPage.h"  // Touch-friendly OTA update page
 #include "web_pages/TouchFriendlyGPSConfigPage.h"  // Touch-friendly GPS configuration page
+#include "web_pages/TouchFriendlyLatencyPage.h"  // Touch-friendly latency trace page
+#include "web_pages/TouchFriendlyRTCMPage.h"  // Touch-friendly RTCM status page
+#include "web_pages/TouchFriendlyPGNPage.h"  // Touch-friendly PGN traffic page
 #include "web_pages/TouchFriendlyHomePage.h"  // Touch-friendly interface
 #include "web_pages/TouchFriendlyStyles.h"  // Touch-friendly CSS
 #include "web_pages/TouchFriendlyDeviceSettingsPage.h"  // Touch-friendly device settings
@@ -41,6 +48,7 @@
 #include "ESP32Interface.h"
 #include "UM98xManager.h"
 #include "SerialManager.h"
+#include "SimpleScheduler/SimpleScheduler.h"
 
 using namespace qindesign::network;
 
@@ -317,6 +325,162 @@ void SimpleWebManager::setupRoutes() {
         }
     });
     
+    httpServer.on("/api/um98x/logformat", [this](EthernetClient& client, const String& method, const String& query) {
+        if (method == "POST") {
+            handleUM98xLogFormat(client);
+        } else {
+            SimpleHTTPServer::send(client, 405, "text/plain", "Method Not Allowed");
+        }
+    });
+    
+    // Scheduler timing stats - GET returns JSON, ?snapshot=1 also starts a new window
+    httpServer.on("/api/scheduler/stats", [this](EthernetClient& client, const String& method, const String& query) {
+        if (method == "GET") {
+            handleSchedulerStats(client, query);
+        } else {
+            SimpleHTTPServer::send(client, 405, "text/plain", "Method Not Allowed");
+        }
+    });
+    
+    httpServer.on("/api/scheduler/reset", [](EthernetClient& client, const String& method, const String& query) {
+        if (method == "POST") {
+#ifdef SCHEDULER_TIMING_STATS
+            scheduler.resetStats();
+            SimpleHTTPServer::sendJSON(client, "{\"success\":true}");
+#else
+            SimpleHTTPServer::send(client, 404, "application/json", "{\"error\":\"SCHEDULER_TIMING_STATS not enabled\"}");
+#endif
+        } else {
+            SimpleHTTPServer::send(client, 405, "text/plain", "Method Not Allowed");
+        }
+    });
+    
+    // Sensor-to-wire latency trace
+    httpServer.on("/latency", [this](EthernetClient& client, const String& method, const String& query) {
+        sendLatencyPage(client);
+    });
+    
+    httpServer.on("/api/latency", [this](EthernetClient& client, const String& method, const String& query) {
+        if (method == "GET") {
+            handleLatencyStats(client);
+        } else {
+            SimpleHTTPServer::send(client, 405, "text/plain", "Method Not Allowed");
+        }
+    });
+    
+    httpServer.on("/api/latency/reset", [](EthernetClient& client, const String& method, const String& query) {
+        if (method == "POST") {
+            LatencyTrace::getInstance()->reset();
+            SimpleHTTPServer::sendJSON(client, "{\"success\":true}");
+        } else {
+            SimpleHTTPServer::send(client, 405, "text/plain", "Method Not Allowed");
+        }
+    });
+    
+    // Online actuator identification and the gains it schedules
+    httpServer.on("/api/steer/identify", [this](EthernetClient& client, const String& method, const String& query) {
+        if (method == "GET") {
+            handleActuatorEstimate(client);
+        } else {
+            SimpleHTTPServer::send(client, 405, "text/plain", "Method Not Allowed");
+        }
+    });
+    
+    httpServer.on("/api/steer/identify/reset", [](EthernetClient& client, const String& method, const String& query) {
+        if (method == "POST") {
+            AutosteerProcessor::getInstance()->resetActuatorEstimate();
+            SimpleHTTPServer::sendJSON(client, "{\"success\":true}");
+        } else {
+            SimpleHTTPServer::send(client, 405, "text/plain", "Method Not Allowed");
+        }
+    });
+    
+    // RTCM correction status
+    httpServer.on("/rtcm", [this](EthernetClient& client, const String& method, const String& query) {
+        sendRTCMPage(client);
+    });
+    
+    httpServer.on("/api/rtcm", [this](EthernetClient& client, const String& method, const String& query) {
+        if (method == "GET") {
+            handleRTCMStats(client);
+        } else {
+            SimpleHTTPServer::send(client, 405, "text/plain", "Method Not Allowed");
+        }
+    });
+    
+    httpServer.on("/api/rtcm/outputs", [this](EthernetClient& client, const String& method, const String& query) {
+        if (method == "POST") {
+            handleRTCMOutputs(client);
+        } else {
+            SimpleHTTPServer::send(client, 405, "text/plain", "Method Not Allowed");
+        }
+    });
+    
+    httpServer.on("/api/rtcm/reset", [](EthernetClient& client, const String& method, const String& query) {
+        if (method == "POST") {
+            RTCMProcessor::getInstance()->resetStats();
+            SimpleHTTPServer::sendJSON(client, "{\"success\":true}");
+        } else {
+            SimpleHTTPServer::send(client, 405, "text/plain", "Method Not Allowed");
+        }
+    });
+    
+    // PGN traffic from AgIO
+    httpServer.on("/pgn", [this](EthernetClient& client, const String& method, const String& query) {
+        sendPGNPage(client);
+    });
+    
+    httpServer.on("/api/pgn", [this](EthernetClient& client, const String& method, const String& query) {
+        if (method == "GET") {
+            handlePGNStats(client);
+        } else {
+            SimpleHTTPServer::send(client, 405, "text/plain", "Method Not Allowed");
+        }
+    });
+    
+    httpServer.on("/api/pgn/reset", [](EthernetClient& client, const String& method, const String& query) {
+        if (method == "POST") {
+            PGNProcessor::instance->resetStats();
+            QNEthernetUDPHandler::resetSocketStats();
+            QNEthernetUDPHandler::resetTxStats();
+            SimpleHTTPServer::sendJSON(client, "{\"success\":true}");
+        } else {
+            SimpleHTTPServer::send(client, 405, "text/plain", "Method Not Allowed");
+        }
+    });
+    
+    // Runtime only - packing is off at boot
+    httpServer.on("/api/pgn/tx", [this](EthernetClient& client, const String& method, const String& query) {
+        if (method == "POST") {
+            StaticJsonDocument<64> doc;
+            if (deserializeJson(doc, readPostBody(client))) {
+                SimpleHTTPServer::sendJSON(client, "{\"status\":\"error\",\"message\":\"Invalid JSON\"}");
+                return;
+            }
+            QNEthernetUDPHandler::setTxPacking(doc["packing"] | false);
+            SimpleHTTPServer::sendJSON(client, "{\"success\":true}");
+        } else {
+            SimpleHTTPServer::send(client, 405, "text/plain", "Method Not Allowed");
+        }
+    });
+    
+    // Runtime only - the budget is back to the default at boot
+    httpServer.on("/api/pgn/budget", [this](EthernetClient& client, const String& method, const String& query) {
+        if (method == "POST") {
+            StaticJsonDocument<64> doc;
+            if (deserializeJson(doc, readPostBody(client))) {
+                SimpleHTTPServer::sendJSON(client, "{\"status\":\"error\",\"message\":\"Invalid JSON\"}");
+                return;
+            }
+            int budgetUs = doc["budgetUs"] | (int)QNEthernetUDPHandler::DEFAULT_POLL_BUDGET_US;
+            int maxPackets = doc["maxPackets"] | (int)QNEthernetUDPHandler::DEFAULT_POLL_MAX_PACKETS;
+            QNEthernetUDPHandler::setPollBudget(constrain(budgetUs, 50, 5000), constrain(maxPackets, 1, 64));
+            SimpleHTTPServer::sendJSON(client, "{\"success\":true}");
+        } else {
+            SimpleHTTPServer::send(client, 405, "text/plain", "Method Not Allowed");
+        }
+    });
+    
     // Note: Removed polling endpoints like /api/was/angle and /api/encoder/count
     // These are now provided via WebSocket telemetry
     
@@ -363,6 +527,21 @@ void SimpleWebManager::sendOTAPage(EthernetClient& client) {
     SimpleHTTPServer::sendP(client, 200, "text/html", TOUCH_FRIENDLY_OTA_PAGE);
 }
 
+void SimpleWebManager::sendLatencyPage(EthernetClient& client) {
+    extern const char TOUCH_FRIENDLY_LATENCY_PAGE[];
+    SimpleHTTPServer::sendP(client, 200, "text/html", TOUCH_FRIENDLY_LATENCY_PAGE);
+}
+
+void SimpleWebManager::sendRTCMPage(EthernetClient& client) {
+    extern const char TOUCH_FRIENDLY_RTCM_PAGE[];
+    SimpleHTTPServer::sendP(client, 200, "text/html", TOUCH_FRIENDLY_RTCM_PAGE);
+}
+
+void SimpleWebManager::sendPGNPage(EthernetClient& client) {
+    extern const char TOUCH_FRIENDLY_PGN_PAGE[];
+    SimpleHTTPServer::sendP(client, 200, "text/html", TOUCH_FRIENDLY_PGN_PAGE);
+}
+
 void SimpleWebManager::sendDeviceSettingsPage(EthernetClient& client) {
     extern const char TOUCH_FRIENDLY_DEVICE_SETTINGS_PAGE[];
     
@@ -390,7 +569,7 @@ void SimpleWebManager::sendCANConfigUploadPage(EthernetClient& client) {
 // API handlers
 
 void SimpleWebManager::handleApiStatus(EthernetClient& client) {
-    StaticJsonDocument<512> doc;
+    StaticJsonDocument<768> doc;
     
     // Basic system info
     doc["version"] = FIRMWARE_VERSION;
@@ -418,6 +597,16 @@ void SimpleWebManager::handleApiStatus(EthernetClient& client) {
     // ESP32 status
     doc["esp32Detected"] = esp32Interface.isDetected();
     doc["esp32Active"] = esp32Interface.isDetected();  // Active if detected
+    const ESP32Interface::Stats& esp32Stats = esp32Interface.getStats();
+    JsonObject esp32 = doc.createNestedObject("esp32");
+    esp32["rxPGNs"] = esp32Interface.getFramer().validFrames;
+    esp32["rxBadCRC"] = esp32Interface.getFramer().badCRC;
+    esp32["rxResyncs"] = esp32Interface.getFramer().resyncs;
+    esp32["rxOverflows"] = esp32Stats.rxOverflows;
+    esp32["rxBps"] = esp32Stats.rxBytesPerSec;
+    esp32["txPGNs"] = esp32Stats.txFrames;
+    esp32["txDropped"] = esp32Stats.txDropped;
+    esp32["txBps"] = esp32Stats.txBytesPerSec;
     
     // System status
     doc["systemHealthy"] = true;
@@ -438,6 +627,7 @@ void SimpleWebManager::handleEventLoggerConfig(EthernetClient& client, const Str
         doc["serialLevel"] = config.serialLevel;
         doc["udpEnabled"] = config.enableUDP;
         doc["udpLevel"] = config.udpLevel;
+        doc["webLevel"] = config.webLevel;
         doc["rateLimitDisabled"] = config.disableRateLimit;
         
         String json;
@@ -481,6 +671,11 @@ void SimpleWebManager::handleEventLoggerConfig(EthernetClient& client, const Str
             logger->setUDPLevel(static_cast<EventSeverity>(level));
             LOG_INFO(EventSource::NETWORK, "Set UDP level: %d", level);
         }
+        if (!doc["webLevel"].isNull()) {
+            int level = doc["webLevel"];
+            logger->setWebLevel(static_cast<EventSeverity>(level));
+            LOG_INFO(EventSource::NETWORK, "Set web level: %d", level);
+        }
         if (!doc["rateLimitDisabled"].isNull()) {
             bool disabled = doc["rateLimitDisabled"];
             logger->setRateLimitEnabled(!disabled);
@@ -491,10 +686,10 @@ void SimpleWebManager::handleEventLoggerConfig(EthernetClient& client, const Str
         logger->saveConfig();
         
         EventConfig& config = logger->getConfig();
-        LOG_INFO(EventSource::NETWORK, "EventLogger config after update: Serial=%d/%d, UDP=%d/%d, RateLimit=%d", 
+        LOG_INFO(EventSource::NETWORK, "EventLogger config after update: Serial=%d/%d, UDP=%d/%d, Web=%d, RateLimit=%d", 
                  config.enableSerial, config.serialLevel, 
                  config.enableUDP, config.udpLevel, 
-                 config.disableRateLimit);
+                 config.webLevel, config.disableRateLimit);
         
         SimpleHTTPServer::sendJSON(client, "{\"status\":\"saved\"}");
         
@@ -647,7 +842,7 @@ void SimpleWebManager::handleDeviceSettings(EthernetClient& client, const String
         // Return current settings from ConfigManager
         ConfigManager* config = ConfigManager::getInstance();
         
-        StaticJsonDocument<256> doc;
+        StaticJsonDocument<384> doc;
         doc["deviceType"] = "Steer";  // Fixed for steer module
         doc["moduleId"] = 126;  // Steer module ID
         doc["udpPassthrough"] = config->getGPSPassThrough();
@@ -658,6 +853,13 @@ void SimpleWebManager::handleDeviceSettings(EthernetClient& client, const String
         doc["serialRadioBaud"] = config->getSerialRadioBaudRate();
         doc["jdPWMEnabled"] = config->getJDPWMEnabled();
         doc["jdPWMSensitivity"] = config->getJDPWMSensitivity();
+        doc["navEmitMode"] = config->getNavEmitMode();
+        doc["steerControlMode"] = config->getSteerControlMode();
+        doc["steerKi"] = config->getSteerKi();
+        doc["steerKd"] = config->getSteerKd();
+        doc["steerKff"] = config->getSteerKff();
+        doc["controlLaneRate"] = config->getControlLaneRateHz();
+        doc["steerAutoGains"] = config->getSteerAutoGains();
         
         String json;
         serializeJson(doc, json);
@@ -668,7 +870,7 @@ void SimpleWebManager::handleDeviceSettings(EthernetClient& client, const String
         String body = readPostBody(client);
         
         // Parse JSON
-        StaticJsonDocument<256> doc;
+        StaticJsonDocument<384> doc;
         DeserializationError error = deserializeJson(doc, body);
         
         if (error) {
@@ -685,22 +887,39 @@ void SimpleWebManager::handleDeviceSettings(EthernetClient& client, const String
         uint32_t serialRadioBaud = doc["serialRadioBaud"] | 115200;
         bool jdPWMEnabled = doc["jdPWMEnabled"] | false;
         int jdPWMSensitivity = doc["jdPWMSensitivity"] | 5;
+        ConfigManager* config = ConfigManager::getInstance();
+        uint8_t navEmitMode = doc["navEmitMode"] | config->getNavEmitMode();
+        uint8_t steerControlMode = doc["steerControlMode"] | config->getSteerControlMode();
+        float steerKi = doc["steerKi"] | config->getSteerKi();
+        float steerKd = doc["steerKd"] | config->getSteerKd();
+        float steerKff = doc["steerKff"] | config->getSteerKff();
+        uint16_t controlLaneRate = doc["controlLaneRate"] | config->getControlLaneRateHz();
+        bool steerAutoGains = doc["steerAutoGains"] | config->getSteerAutoGains();
 
         // Save to ConfigManager
-        ConfigManager* config = ConfigManager::getInstance();
         config->setGPSPassThrough(udpPassthrough);
+        config->setNavEmitMode(navEmitMode);
         config->setPWMBrakeMode(pwmBrakeMode);
         config->setSoftStartDurationMs(softStartDuration);
         config->setEncoderType(encoderType);
         config->setSerialRadioBaudRate(serialRadioBaud);
         config->setJDPWMEnabled(jdPWMEnabled);
         config->setJDPWMSensitivity(jdPWMSensitivity);
+        // Controller gains apply on the next control tick, the rate after a restart
+        config->setSteerControlMode(steerControlMode);
+        config->setSteerKi(steerKi);
+        config->setSteerKd(steerKd);
+        config->setSteerKff(steerKff);
+        config->setControlLaneRateHz(controlLaneRate);
+        config->setSteerAutoGains(steerAutoGains);
         // Sensor fusion configuration not implemented yet
         
         // Save to EEPROM
         config->saveTurnSensorConfig();  // This saves encoder type and JD PWM settings
         config->saveSteerConfig();       // This saves PWM brake mode
-        config->saveGPSConfig();         // This saves GPS passthrough
+        config->saveSteerSettings();     // This saves the steering controller
+        config->saveMiscConfig();        // This saves the control rate
+        config->saveGPSConfig();         // This saves GPS passthrough and PANDA/PAOGI trigger
         
         // Apply JD PWM mode change to ADProcessor
         extern ADProcessor adProcessor;
@@ -708,6 +927,7 @@ void SimpleWebManager::handleDeviceSettings(EthernetClient& client, const String
 
         // Update GNSSProcessor with new passthrough setting
         gnssProcessor.setUDPPassthrough(udpPassthrough);
+        NAVProcessor::getInstance()->setEmitMode(config->getNavEmitMode());
 
         // Apply new radio baud rate immediately
         extern SerialManager serialManager;
@@ -1107,6 +1327,422 @@ void SimpleWebManager::broadcastTelemetry() {
     
     // Broadcast to all connected clients
     telemetryWS.broadcastBinary((const uint8_t*)&packet, sizeof(packet));
+    
+    // Scheduler histograms ride along once per second
+    static uint32_t lastSchedulerStats = 0;
+    if (now - lastSchedulerStats >= 1000) {
+        lastSchedulerStats = now;
+        broadcastSchedulerStats();
+    }
+}
+
+void SimpleWebManager::broadcastSchedulerStats() {
+#ifdef SCHEDULER_TIMING_STATS
+    // Sized for 32 tasks; extra tasks are left out of the frame
+    static uint8_t frame[sizeof(SimpleScheduler::StatsFrameHeader) + 32 * sizeof(SimpleScheduler::StatsFrameTask)];
+    size_t length = scheduler.buildStatsFrame(frame, sizeof(frame));
+    if (length > 0) {
+        telemetryWS.broadcastBinary(frame, length);
+    }
+#endif
+}
+
+void SimpleWebManager::handleSchedulerStats(EthernetClient& client, const String& query) {
+#ifdef SCHEDULER_TIMING_STATS
+    // Send response headers manually for chunked streaming
+    client.println("HTTP/1.1 200 OK");
+    client.println("Content-Type: application/json");
+    client.println("Connection: close");
+    client.println();
+    
+    // Stream JSON directly to client - full histograms are too big for a JsonDocument
+    client.print("{\"uptime\":");
+    client.print(millis());
+    client.print(",\"loopCount\":");
+    client.print(scheduler.getLoopCount());
+    client.print(",\"tickBudgetUs\":");
+    client.print(scheduler.getTickBudget());
+    client.print(",\"bucketCount\":");
+    client.print(SimpleScheduler::HIST_BUCKETS);
+    client.print(",\"tasks\":[");
+    
+    uint8_t total = scheduler.getTotalTaskCount();
+    for (uint8_t i = 0; i < total; i++) {
+        SimpleScheduler::TaskInfo info;
+        if (!scheduler.getTaskInfo(i, info)) {
+            break;
+        }
+        const SimpleScheduler::TaskStats& stats = *info.stats;
+        
+        if (i > 0) client.print(",");
+        client.print("{\"name\":\"");
+        client.print(info.name);
+        client.print("\",\"group\":\"");
+        client.print(scheduler.getGroupName(info.group));
+        client.print("\",\"enabled\":");
+        client.print(info.enabled ? "true" : "false");
+        client.print(",\"runs\":");
+        client.print(stats.runCount);
+        client.print(",\"exec\":{\"avg\":");
+        client.print(stats.runCount ? stats.totalTime / stats.runCount : 0);
+        client.print(",\"p50\":");
+        client.print(stats.execHist.percentile(50, stats.maxTime));
+        client.print(",\"p99\":");
+        client.print(stats.execHist.percentile(99, stats.maxTime));
+        client.print(",\"max\":");
+        client.print(stats.maxTime);
+        client.print(",\"hist\":[");
+        for (uint8_t b = 0; b < SimpleScheduler::HIST_BUCKETS; b++) {
+            if (b > 0) client.print(",");
+            client.print(stats.execHist.counts[b]);
+        }
+        client.print("]},\"late\":{\"avg\":");
+        client.print(stats.runCount ? stats.totalLateness / stats.runCount : 0);
+        client.print(",\"p50\":");
+        client.print(stats.lateHist.percentile(50, stats.maxLateness));
+        client.print(",\"p99\":");
+        client.print(stats.lateHist.percentile(99, stats.maxLateness));
+        client.print(",\"max\":");
+        client.print(stats.maxLateness);
+        client.print(",\"hist\":[");
+        for (uint8_t b = 0; b < SimpleScheduler::HIST_BUCKETS; b++) {
+            if (b > 0) client.print(",");
+            client.print(stats.lateHist.counts[b]);
+        }
+        client.print("]},\"overruns\":");
+        client.print(stats.budgetOverruns);
+        client.print(",\"deferrals\":");
+        client.print(stats.deferrals);
+        client.print("}");
+    }
+    
+    client.print("]}");
+    client.flush();
+    
+    // Snapshot: what was just sent becomes a closed window
+    if (query.indexOf("snapshot=1") >= 0) {
+        scheduler.resetStats();
+    }
+#else
+    SimpleHTTPServer::send(client, 404, "application/json", "{\"error\":\"SCHEDULER_TIMING_STATS not enabled\"}");
+#endif
+}
+
+void SimpleWebManager::handleLatencyStats(EthernetClient& client) {
+    LatencyTrace* trace = LatencyTrace::getInstance();
+    
+    client.println("HTTP/1.1 200 OK");
+    client.println("Content-Type: application/json");
+    client.println("Connection: close");
+    client.println();
+    
+    client.print("{\"uptime\":");
+    client.print(millis());
+    client.print(",\"paths\":[");
+    for (uint8_t p = 0; p < LatencyTrace::PATH_COUNT; p++) {
+        LatencyTrace::Path path = (LatencyTrace::Path)p;
+        const LatencyTrace::PathStats& stats = trace->getStats(path);
+        
+        if (p > 0) client.print(",");
+        client.print("{\"name\":\"");
+        client.print(LatencyTrace::getPathName(path));
+        client.print("\",\"count\":");
+        client.print(stats.count);
+        client.print(",\"avg\":");
+        client.print(stats.count ? (uint32_t)(stats.totalUs / stats.count) : 0);
+        client.print(",\"p50\":");
+        client.print(trace->percentile(path, 50));
+        client.print(",\"p99\":");
+        client.print(trace->percentile(path, 99));
+        client.print(",\"max\":");
+        client.print(stats.maxUs);
+        client.print(",\"hist\":[");
+        for (uint8_t b = 0; b < LatencyTrace::HIST_BUCKETS; b++) {
+            if (b > 0) client.print(",");
+            client.print(stats.hist[b]);
+        }
+        client.print("]}");
+    }
+    client.print("]}");
+    client.flush();
+}
+
+void SimpleWebManager::handleActuatorEstimate(EthernetClient& client) {
+    AutosteerProcessor* autosteer = AutosteerProcessor::getInstance();
+    ActuatorEstimator::Estimate estimate;
+    autosteer->getActuatorEstimate(estimate);
+    uint8_t band = ActuatorEstimator::speedBand(autosteer->getVehicleSpeed());
+    ConfigManager* config = ConfigManager::getInstance();
+    
+    StaticJsonDocument<768> doc;
+    doc["valid"] = estimate.valid;
+    doc["gain"] = estimate.gain;
+    doc["deadband"] = estimate.deadband;
+    doc["lagMs"] = estimate.lag * 1000.0f;
+    doc["confidence"] = estimate.confidence;
+    doc["updates"] = estimate.updates;
+    doc["skipped"] = estimate.skipped;
+    doc["autoGains"] = config->getSteerAutoGains();
+    doc["applied"] = config->getSteerAutoGains() && estimate.valid;
+    doc["band"] = band;
+    doc["kp"] = config->getKp();          // PGN 252 gains, used until the estimate is applied
+    doc["minPWM"] = config->getMinPWM();
+    
+    // What each speed band would run with this estimate
+    JsonArray bands = doc.createNestedArray("bands");
+    for (uint8_t b = 0; b < ActuatorEstimator::SPEED_BANDS; b++) {
+        JsonObject entry = bands.createNestedObject();
+        entry["maxKmh"] = ActuatorEstimator::BAND_MAX_KMH[b];
+        if (estimate.valid) {
+            ActuatorEstimator::ScheduledGains gains = ActuatorEstimator::gainsFor(estimate, b);
+            entry["kp"] = gains.kp;
+            entry["minPWM"] = gains.minPWM;
+        }
+    }
+    
+    String json;
+    serializeJson(doc, json);
+    SimpleHTTPServer::sendJSON(client, json);
+}
+
+static void printRTCMSource(EthernetClient& client, RTCMProcessor* rtcm, RTCMSource source, uint32_t now) {
+    const RTCMProcessor::SourceState& state = rtcm->getSource(source);
+    const RTCMArbiter::Source& epochState = rtcm->getSourceEpochs(source);
+    client.print("{\"name\":\"");
+    client.print(RTCMProcessor::getSourceName(source));
+    client.print("\",\"primary\":");
+    client.print(rtcm->getPrimary() == (int8_t)source ? "true" : "false");
+    client.print(",\"age\":");
+    client.print(epochState.lastFrameMillis ? (int32_t)(now - epochState.lastFrameMillis) : -1);
+    client.print(",\"epochMs\":");
+    client.print(epochState.epochIntervalMs);
+    client.print(",\"epochs\":");
+    client.print(epochState.epochCount);
+    client.print(",\"cleanEpochs\":");
+    client.print(__builtin_popcount(RTCMArbiter::history(epochState)));
+    client.print(",\"frames\":");
+    client.print(state.framer.validFrames);
+    client.print(",\"standby\":");
+    client.print(state.standbyFrames);
+    client.print(",\"badCRC\":");
+    client.print(state.framer.badCRC);
+    client.print(",\"badLength\":");
+    client.print(state.framer.badLength);
+    client.print(",\"skipped\":");
+    client.print(state.framer.skippedBytes);
+    client.print(",\"lost\":");
+    client.print(state.framesCut);
+    client.print("}");
+}
+
+void SimpleWebManager::handleRTCMStats(EthernetClient& client) {
+    RTCMProcessor* rtcm = RTCMProcessor::getInstance();
+    uint32_t now = millis();
+    
+    client.println("HTTP/1.1 200 OK");
+    client.println("Content-Type: application/json");
+    client.println("Connection: close");
+    client.println();
+    
+    client.print("{\"datagrams\":");
+    client.print(rtcm->getDatagramCount());
+    client.print(",\"radioOverruns\":");
+    client.print(rtcm->getRadioOverruns());
+    client.print(",\"radioRxFull\":");
+    client.print(rtcm->getRadioSaturations());
+    client.print(",\"sources\":[");
+    printRTCMSource(client, rtcm, RTCMSource::NETWORK, now);
+    client.print(",");
+    printRTCMSource(client, rtcm, RTCMSource::RADIO, now);
+    client.print("],\"primary\":\"");
+    client.print(rtcm->getPrimary() < 0 ? "" : RTCMProcessor::getSourceName((RTCMSource)rtcm->getPrimary()));
+    client.print("\",\"switches\":");
+    client.print(rtcm->getSwitchCount());
+    client.print(",\"switchAge\":");
+    client.print(rtcm->getSwitchCount() ? (int32_t)(now - rtcm->getLastSwitchMillis()) : -1);
+    client.print(",\"switchReason\":\"");
+    client.print(rtcm->getLastSwitchReason());
+    client.print("\",\"outputs\":[");
+    const RTCMFanout& fanout = rtcm->getFanout();
+    for (uint8_t i = 0; i < RTCMFanout::OUTPUT_COUNT; i++) {
+        const RTCMFanout::Output& output = fanout.getOutput(i);
+        if (i > 0) client.print(",");
+        client.print("{\"name\":\"");
+        client.print(output.name);
+        client.print("\",\"enabled\":");
+        client.print(output.enabled ? "true" : "false");
+        client.print(",\"policy\":\"");
+        client.print(output.policy == RTCMFanout::DropPolicy::DROP_OLDEST ? "oldest" : "newest");
+        client.print("\",\"queued\":");
+        client.print(output.count);
+        client.print(",\"peak\":");
+        client.print(output.peakQueued);
+        client.print(",\"frames\":");
+        client.print(output.frames);
+        client.print(",\"bytes\":");
+        client.print(output.bytes);
+        client.print(",\"dropped\":");
+        client.print(output.dropped);
+        client.print("}");
+    }
+    uint8_t udpIP[4];
+    ConfigManager::getInstance()->getRTCMUdpIP(udpIP);
+    client.print("],\"udpIP\":\"");
+    client.print(udpIP[0]); client.print("."); client.print(udpIP[1]); client.print(".");
+    client.print(udpIP[2]); client.print("."); client.print(udpIP[3]);
+    client.print("\",\"udpPort\":");
+    client.print(fanout.getUDPPort());
+    client.print(",\"bytesPerSec\":");
+    client.print(rtcm->getBytesPerSec());
+    client.print(",\"age\":");
+    client.print(rtcm->getLastFrameMillis() ? (int32_t)(now - rtcm->getLastFrameMillis()) : -1);
+    client.print(",\"types\":[");
+    for (uint8_t i = 0; i < rtcm->getMessageTypeCount(); i++) {
+        const RTCMProcessor::MessageStats& stats = rtcm->getMessageStats(i);
+        if (i > 0) client.print(",");
+        client.print("{\"type\":");
+        client.print(stats.type);
+        client.print(",\"count\":");
+        client.print(stats.count);
+        client.print(",\"bytes\":");
+        client.print(stats.bytes);
+        client.print(",\"rate\":");
+        client.print(stats.bytesPerSec);
+        client.print(",\"age\":");
+        client.print((int32_t)(now - stats.lastMillis));
+        client.print("}");
+    }
+    client.print("]}");
+    client.flush();
+}
+
+void SimpleWebManager::handlePGNStats(EthernetClient& client) {
+    PGNProcessor* pgnProcessor = PGNProcessor::instance;
+    
+    client.println("HTTP/1.1 200 OK");
+    client.println("Content-Type: application/json");
+    client.println("Connection: close");
+    client.println();
+    
+    client.print("{\"unhandled\":");
+    client.print(pgnProcessor->getUnhandledCount());
+    client.print(",\"unhandledCRCErrors\":");
+    client.print(pgnProcessor->getUnhandledCRCErrors());
+    client.print(",\"pgns\":[");
+    for (uint8_t i = 0; i < pgnProcessor->getEntryCount(); i++) {
+        const PGNProcessor::PGNEntry& entry = pgnProcessor->getEntry(i);
+        if (i > 0) client.print(",");
+        client.print("{\"pgn\":");
+        client.print(entry.pgn);
+        client.print(",\"subscribers\":[");
+        for (uint8_t j = 0; j < entry.subscriberCount; j++) {
+            if (j > 0) client.print(",");
+            client.print("\"");
+            client.print(entry.subscribers[j].name);
+            client.print("\"");
+        }
+        client.print("],\"received\":");
+        client.print(entry.stats.received);
+        client.print(",\"crcErrors\":");
+        client.print(entry.stats.crcErrors);
+        client.print(",\"handlerUs\":");
+        client.print(entry.stats.handlerUsTotal);
+        client.print(",\"handlerMaxUs\":");
+        client.print(entry.stats.handlerUsMax);
+        client.print("}");
+    }
+    
+    static const char* const socketNames[QNEthernetUDPHandler::SOCKET_COUNT] = {"PGN 8888", "RTCM 2233", "DHCP 67"};
+    client.print("],\"budgetUs\":");
+    client.print(QNEthernetUDPHandler::getPollBudgetUs());
+    client.print(",\"maxPackets\":");
+    client.print(QNEthernetUDPHandler::getPollMaxPackets());
+    client.print(",\"sockets\":[");
+    for (uint8_t i = 0; i < QNEthernetUDPHandler::SOCKET_COUNT; i++) {
+        QNEthernetUDPHandler::Socket socket = (QNEthernetUDPHandler::Socket)i;
+        const QNEthernetUDPHandler::SocketStats& stats = QNEthernetUDPHandler::getSocketStats(socket);
+        if (i > 0) client.print(",");
+        client.print("{\"name\":\"");
+        client.print(socketNames[i]);
+        client.print("\",\"queue\":");
+        client.print(QNEthernetUDPHandler::getReceiveQueueSize(socket));
+        client.print(",\"datagrams\":");
+        client.print(stats.datagrams);
+        client.print(",\"bytes\":");
+        client.print(stats.bytes);
+        client.print(",\"peak\":");
+        client.print(stats.peakDepth);
+        client.print(",\"overflows\":");
+        client.print(stats.overflows);
+        client.print(",\"budgetHits\":");
+        client.print(stats.budgetHits);
+        client.print(",\"dropped\":");
+        client.print(stats.dropped);
+        client.print("}");
+    }
+    
+    const QNEthernetUDPHandler::TxStats& tx = QNEthernetUDPHandler::getTxStats();
+    client.print("],\"tx\":{\"queued\":");
+    client.print(tx.queued);
+    client.print(",\"sent\":");
+    client.print(tx.sent);
+    client.print(",\"failed\":");
+    client.print(tx.failed);
+    client.print(",\"packed\":");
+    client.print(tx.packed);
+    client.print(",\"flushes\":");
+    client.print(tx.flushes);
+    client.print(",\"earlyFlushes\":");
+    client.print(tx.earlyFlushes);
+    client.print(",\"peak\":");
+    client.print(tx.peakDepth);
+    client.print(",\"slots\":");
+    client.print(QNEthernetUDPHandler::TX_QUEUE_SLOTS);
+    client.print(",\"queueUs\":");
+    client.print(tx.queueUsTotal);
+    client.print(",\"queueMaxUs\":");
+    client.print(tx.queueUsMax);
+    client.print(",\"packing\":");
+    client.print(QNEthernetUDPHandler::getTxPacking() ? "true" : "false");
+    client.print("}}");
+    client.flush();
+}
+
+void SimpleWebManager::handleRTCMOutputs(EthernetClient& client) {
+    String body = readPostBody(client);
+    
+    StaticJsonDocument<256> doc;
+    DeserializationError error = deserializeJson(doc, body);
+    if (error) {
+        SimpleHTTPServer::sendJSON(client, "{\"status\":\"error\",\"message\":\"Invalid JSON\"}");
+        return;
+    }
+    
+    ConfigManager* config = ConfigManager::getInstance();
+    uint8_t mask = 0;
+    if (doc["gps2"] | false) mask |= 1 << RTCMFanout::OUTPUT_GPS2;
+    if (doc["rs232"] | false) mask |= 1 << RTCMFanout::OUTPUT_RS232;
+    if (doc["udp"] | false) mask |= 1 << RTCMFanout::OUTPUT_UDP;
+    
+    // Empty or 0.0.0.0 = the module's broadcast address
+    IPAddress ip(0, 0, 0, 0);
+    const char* ipText = doc["udpIP"] | "";
+    if (ipText[0] && !ip.fromString(ipText)) {
+        SimpleHTTPServer::sendJSON(client, "{\"status\":\"error\",\"message\":\"Invalid IP address\"}");
+        return;
+    }
+    uint8_t udpIP[4] = {ip[0], ip[1], ip[2], ip[3]};
+    
+    config->setRTCMOutputMask(mask);
+    config->setRTCMUdpIP(udpIP);
+    config->setRTCMUdpPort(doc["udpPort"] | RTCMFanout::DEFAULT_UDP_PORT);
+    config->saveGPSConfig();
+    RTCMProcessor::getInstance()->applyOutputConfig();
+    
+    LOG_INFO(EventSource::NETWORK, "RTCM outputs: GPS2 %s, RS232 %s, UDP %s port %u",
+             (mask & 0x01) ? "on" : "off", (mask & 0x02) ? "on" : "off", (mask & 0x04) ? "on" : "off",
+             config->getRTCMUdpPort());
+    SimpleHTTPServer::sendJSON(client, "{\"status\":\"saved\"}");
 }
 
 // UM98x GPS Configuration handlers
@@ -1219,6 +1855,56 @@ void SimpleWebManager::handleUM98xWrite(EthernetClient& client) {
     SimpleHTTPServer::send(client, success ? 200 : 500, "application/json", response);
 }
 
+void SimpleWebManager::handleUM98xLogFormat(EthernetClient& client) {
+    LOG_INFO(EventSource::NETWORK, "handleUM98xLogFormat() called");
+    
+    // Parse POST body - {"binary": true|false}
+    String body = readPostBody(client);
+    
+    StaticJsonDocument<128> doc;
+    DeserializationError error = deserializeJson(doc, body);
+    
+    if (error || !doc.containsKey("binary")) {
+        StaticJsonDocument<128> responseDoc;
+        responseDoc["success"] = false;
+        responseDoc["error"] = "Invalid JSON";
+        
+        String response;
+        serializeJson(responseDoc, response);
+        SimpleHTTPServer::send(client, 400, "application/json", response);
+        return;
+    }
+    
+    static UM98xManager um98xManager;
+    static bool managerInitialized = false;
+    
+    if (!managerInitialized) {
+        if (!um98xManager.init(&SerialGPS1)) {
+            StaticJsonDocument<128> responseDoc;
+            responseDoc["success"] = false;
+            responseDoc["error"] = "Failed to initialize UM98x manager";
+            
+            String response;
+            serializeJson(responseDoc, response);
+            SimpleHTTPServer::send(client, 500, "application/json", response);
+            return;
+        }
+        managerInitialized = true;
+    }
+    
+    bool success = um98xManager.setBinaryLogs(doc["binary"].as<bool>());
+    
+    StaticJsonDocument<128> responseDoc;
+    responseDoc["success"] = success;
+    if (!success) {
+        responseDoc["error"] = "Failed to switch GPS log format";
+    }
+    
+    String response;
+    serializeJson(responseDoc, response);
+    SimpleHTTPServer::send(client, success ? 200 : 500, "application/json", response);
+}
+
 void SimpleWebManager::handleCANInfo(EthernetClient& client) {
     // Check if custom configuration exists in LittleFS
     if (CANConfigStorage::hasCustomConfig()) {
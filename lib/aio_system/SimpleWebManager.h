@@ -68,6 +68,9 @@ private:
     void sendAnalogWorkSwitchPage(EthernetClient& client);
     void sendCANConfigPage(EthernetClient& client);
     void sendCANConfigUploadPage(EthernetClient& client);
+    void sendLatencyPage(EthernetClient& client);
+    void sendRTCMPage(EthernetClient& client);
+    void sendPGNPage(EthernetClient& client);
 
     // API handlers
     void handleApiStatus(EthernetClient& client);
@@ -90,6 +93,22 @@ private:
     void sendUM98xConfigPage(EthernetClient& client);
     void handleUM98xRead(EthernetClient& client);
     void handleUM98xWrite(EthernetClient& client);
+    void handleUM98xLogFormat(EthernetClient& client);
+    
+    // Scheduler timing stats (histograms, p50/p99/max)
+    void handleSchedulerStats(EthernetClient& client, const String& query);
+    void broadcastSchedulerStats();
+    
+    // Sensor-to-wire latency trace (per-path histograms, p50/p99/max)
+    void handleLatencyStats(EthernetClient& client);
+    
+    // Actuator estimate and the Kp/minPWM it schedules per speed band
+    void handleActuatorEstimate(EthernetClient& client);
+    
+    // RTCM frame counts, rates and correction age per message type
+    void handleRTCMStats(EthernetClient& client);
+    void handleRTCMOutputs(EthernetClient& client);
+    void handlePGNStats(EthernetClient& client);
     
     // Helper to parse POST body
     String readPostBody(EthernetClient& client);
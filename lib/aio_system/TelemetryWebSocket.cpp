@@ -74,7 +74,7 @@ const char wsTestPage[] PROGMEM = R"HTML(
             };
             
             ws.onmessage = (event) => {
-                if (event.data instanceof ArrayBuffer) {
+                if (event.data instanceof ArrayBuffer && event.data.byteLength === 32) {
                     messageCount++;
                     const view = new DataView(event.data);
                     
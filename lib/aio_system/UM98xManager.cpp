@@ -310,6 +310,130 @@ bool UM98xManager::writeConfiguration(const UM98xConfig& config) {
     return success;
 }
 
+bool UM98xManager::setBinaryLogs(bool binary) {
+    if (!gpsSerial) {
+        LOG_ERROR(EventSource::SYSTEM, "UM98xManager: Not initialized");
+        return false;
+    }
+    
+    // Pause GNSSProcessor
+    gnssProcessor.pauseProcessing();
+    
+    String response;
+    String currentLogs;
+    String newLogs;
+    bool success = true;
+    
+    // Current log list, rewritten line by line
+    if (!sendCommandAndWaitForResponse("UNILOGLIST", response)) {
+        LOG_ERROR(EventSource::SYSTEM, "UNILOGLIST command failed");
+        success = false;
+    } else {
+        parseLogListResponse(response, currentLogs);
+        
+        int start = 0;
+        int end = currentLogs.indexOf('\n');
+        
+        while (end != -1 || start < (int)currentLogs.length()) {
+            String line;
+            if (end != -1) {
+                line = currentLogs.substring(start, end);
+                start = end + 1;
+                end = currentLogs.indexOf('\n', start);
+            } else {
+                line = currentLogs.substring(start);
+                start = currentLogs.length();
+            }
+            
+            line.trim();
+            String converted = convertLogLine(line, binary);
+            // GGA and GNS both become BESTNAVB - only log it once
+            if (converted.length() > 0 && newLogs.indexOf(converted) < 0) {
+                if (newLogs.length() > 0) {
+                    newLogs += "\n";
+                }
+                newLogs += converted;
+            }
+        }
+        
+        if (newLogs.length() == 0) {
+            LOG_ERROR(EventSource::SYSTEM, "No logs to switch to %s", binary ? "binary" : "ASCII");
+            success = false;
+        }
+    }
+    
+    if (success) {
+        LOG_INFO(EventSource::SYSTEM, "Switching UM98x logs to %s...", binary ? "binary" : "ASCII");
+        
+        sendCommandAndWaitForResponse("UNLOGALL COM1", response);
+        sendCommandAndWaitForResponse("UNLOGALL COM2", response);
+        sendCommandAndWaitForResponse("UNLOGALL COM3", response);
+        delay(100);
+        
+        int start = 0;
+        int end = newLogs.indexOf('\n');
+        
+        while (end != -1 || start < (int)newLogs.length()) {
+            String line;
+            if (end != -1) {
+                line = newLogs.substring(start, end);
+                start = end + 1;
+                end = newLogs.indexOf('\n', start);
+            } else {
+                line = newLogs.substring(start);
+                start = newLogs.length();
+            }
+            
+            LOG_INFO(EventSource::SYSTEM, "  %s", line.c_str());
+            if (!sendCommandAndWaitForResponse(line, response)) {
+                LOG_ERROR(EventSource::SYSTEM, "Failed to set log: %s", line.c_str());
+                success = false;
+                break;
+            }
+        }
+    }
+    
+    if (success) {
+        if (!sendCommandAndWaitForResponse("SAVECONFIG", response, SAVECONFIG_TIMEOUT)) {
+            LOG_ERROR(EventSource::SYSTEM, "SAVECONFIG failed - log format not saved!");
+            success = false;
+        } else {
+            LOG_INFO(EventSource::SYSTEM, "UM98x logs switched to %s and saved", binary ? "binary" : "ASCII");
+        }
+    }
+    
+    // Resume GNSSProcessor
+    gnssProcessor.resumeProcessing();
+    
+    return success;
+}
+
+String UM98xManager::convertLogLine(const String& line, bool binary) {
+    // "<LOG> <PORT> <PERIOD>" - only the log name changes
+    int space = line.indexOf(' ');
+    if (space <= 0) {
+        return line;
+    }
+    String name = line.substring(0, space);
+    String rest = line.substring(space);
+    name.toUpperCase();
+    
+    // Talker prefix doesn't matter for GGA/GNS/VTG/HPR
+    String sentence = (name.length() == 5 && name[0] == 'G') ? name.substring(2) : name;
+    
+    if (binary) {
+        if (name == "INSPVAXA" || name == "INSPVAA") return "INSPVAXB" + rest;
+        if (sentence == "GGA" || sentence == "GNS") return "BESTNAVB" + rest;
+        if (sentence == "VTG") return "";  // BESTNAVB carries velocity too
+        if (sentence == "HPR") return "HEADING2B" + rest;
+    } else {
+        if (name == "INSPVAXB") return "INSPVAXA" + rest;
+        if (name == "BESTNAVB") return "GNGGA" + rest + "\nGNVTG" + rest;
+        if (name == "HEADING2B") return "GNHPR" + rest;
+    }
+    return line;
+}
+
 bool UM98xManager::sendCommandAndWaitForResponse(const String& cmd, String& response, uint32_t timeout) {
     // Clear serial buffer first
     flushSerialBuffer();
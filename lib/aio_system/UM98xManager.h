@@ -32,6 +32,11 @@ public:
     // Write configuration to GPS and save to EEPROM
     bool writeConfiguration(const UM98xConfig& config);
     
+    // Switch the navigation logs between Unicore binary (BESTNAVB, INSPVAXB,
+    // HEADING2B) and their ASCII equivalents, keeping each log's port and
+    // rate, and save to EEPROM
+    bool setBinaryLogs(bool binary);
+    
 private:
     HardwareSerial* gpsSerial;
     static constexpr uint32_t COMMAND_TIMEOUT = 5000;  // 5 second timeout
@@ -52,6 +57,9 @@ private:
     bool parseModeResponse(const String& response, String& modeOut);
     bool parseLogListResponse(const String& response, String& messagesOut);
     
+    // Rewrite one UNILOGLIST line for setBinaryLogs(), may return 0-2 lines
+    static String convertLogLine(const String& line, bool binary);
+    
     // Extract line from serial with timeout
     bool readLineWithTimeout(String& line, uint32_t timeout);
 };
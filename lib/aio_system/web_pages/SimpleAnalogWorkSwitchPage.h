@@ -89,7 +89,7 @@ function connectWebSocket() {
     };
     
     ws.onmessage = function(event) {
-        if (event.data instanceof ArrayBuffer) {
+        if (event.data instanceof ArrayBuffer && event.data.byteLength === 32) {
             const view = new DataView(event.data);
             
             // Debug: log packet size
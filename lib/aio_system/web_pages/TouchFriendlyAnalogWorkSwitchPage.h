@@ -198,7 +198,7 @@ const char TOUCH_FRIENDLY_ANALOG_WORK_SWITCH_PAGE[] PROGMEM = R"rawliteral(
             };
             
             ws.onmessage = function(event) {
-                if (event.data instanceof ArrayBuffer) {
+                if (event.data instanceof ArrayBuffer && event.data.byteLength === 32) {
                     const view = new DataView(event.data);
                     
                     // Parse telemetry packet - work switch data at bytes 29-30
@@ -214,6 +214,12 @@ const char TOUCH_FRIENDLY_DEVICE_SETTINGS_PAGE[] PROGMEM = R"rawliteral(
             document.getElementById('sensitivityValue').textContent = value;
         }
 
+        function toggleControllerGains() {
+            const mode = parseInt(document.getElementById('steerControlMode').value);
+            document.getElementById('pidGainsGroup').style.display = mode >= 1 ? 'block' : 'none';
+            document.getElementById('kffGroup').style.display = mode == 2 ? 'block' : 'none';
+        }
+
 
         function saveSettings() {
             const settings = {
@@ -224,7 +230,14 @@ const char TOUCH_FRIENDLY_DEVICE_SETTINGS_PAGE[] PROGMEM = R"rawliteral(
                 encoderType: parseInt(document.getElementById('encoderType').value),
                 serialRadioBaud: parseInt(document.getElementById('serialRadioBaud').value),
                 jdPWMEnabled: document.getElementById('jdPWMEnabled').checked,
-                jdPWMSensitivity: parseInt(document.getElementById('jdPWMSensitivity').value)
+                jdPWMSensitivity: parseInt(document.getElementById('jdPWMSensitivity').value),
+                navEmitMode: parseInt(document.getElementById('navEmitMode').value),
+                steerControlMode: parseInt(document.getElementById('steerControlMode').value),
+                steerKi: parseFloat(document.getElementById('steerKi').value) || 0,
+                steerKd: parseFloat(document.getElementById('steerKd').value) || 0,
+                steerKff: parseFloat(document.getElementById('steerKff').value) || 0,
+                controlLaneRate: parseInt(document.getElementById('controlLaneRate').value),
+                steerAutoGains: document.getElementById('steerAutoGains').checked
             };
             
             // Show saving status
@@ -275,16 +288,58 @@ const char TOUCH_FRIENDLY_DEVICE_SETTINGS_PAGE[] PROGMEM = R"rawliteral(
                     document.getElementById('serialRadioBaud').value = data.serialRadioBaud || 115200;
                     document.getElementById('jdPWMEnabled').checked = data.jdPWMEnabled || false;
                     document.getElementById('jdPWMSensitivity').value = data.jdPWMSensitivity || 5;
+                    document.getElementById('navEmitMode').value = (data.navEmitMode !== undefined) ? data.navEmitMode : 1;
+                    document.getElementById('steerControlMode').value = data.steerControlMode || 0;
+                    document.getElementById('steerKi').value = data.steerKi || 0;
+                    document.getElementById('steerKd').value = data.steerKd || 0;
+                    document.getElementById('steerKff').value = data.steerKff || 0;
+                    document.getElementById('controlLaneRate').value = data.controlLaneRate || 0;
+                    document.getElementById('steerAutoGains').checked = data.steerAutoGains || false;
                     updateSensitivityValue(data.jdPWMSensitivity || 5);
                     toggleJDPWMSensitivity();
+                    toggleControllerGains();
                 })
                 .catch((error) => {
                     console.error('Error loading settings:', error);
                 });
         }
         
+        function loadActuatorEstimate() {
+            fetch('/api/steer/identify')
+                .then(response => response.json())
+                .then(data => {
+                    let text;
+                    if (data.updates === 0) {
+                        text = 'No estimate yet - engage autosteer and drive.';
+                    } else {
+                        text = 'Gain ' + data.gain.toFixed(3) + ' &deg;/s per PWM, deadband ' +
+                               data.deadband.toFixed(0) + ' PWM, lag ' + data.lagMs.toFixed(0) + ' ms<br>' +
+                               'Confidence ' + Math.round(data.confidence * 100) + '% from ' + data.updates +
+                               ' samples (' + data.skipped + ' skipped)';
+                    }
+                    if (data.applied) {
+                        const band = data.bands[data.band];
+                        text += '<br><strong>Using Kp ' + band.kp.toFixed(0) + ', Min PWM ' + band.minPWM + '</strong>';
+                    } else if (data.autoGains) {
+                        text += '<br>Using AgOpenGPS Kp ' + data.kp + ', Min PWM ' + data.minPWM + ' until the estimate is confident';
+                    }
+                    document.getElementById('actuatorEstimate').innerHTML = text;
+                })
+                .catch((error) => {
+                    console.error('Error loading actuator estimate:', error);
+                });
+        }
+
+        function resetActuatorEstimate() {
+            if (!confirm('Discard the actuator estimate and identify from scratch?')) return;
+            fetch('/api/steer/identify/reset', { method: 'POST' })
+                .then(() => loadActuatorEstimate());
+        }
+
         window.onload = function() {
             loadSettings();
+            loadActuatorEstimate();
+            setInterval(loadActuatorEstimate, 2000);
         };
     </script>
 </head>
@@ -365,6 +420,65 @@ const char TOUCH_FRIENDLY_DEVICE_SETTINGS_PAGE[] PROGMEM = R"rawliteral(
                     </div>
                 </div>
 
+                <div class="form-group" style="margin-top: 15px;">
+                    <label for="steerControlMode">Steering Controller:</label>
+                    <select id="steerControlMode" name="steerControlMode" onchange="toggleControllerGains()">
+                        <option value="0">P - AgOpenGPS Kp only (Default)</option>
+                        <option value="1">PID</option>
+                        <option value="2">PID + target rate feed-forward</option>
+                    </select>
+                    <div class="help-text" style="margin-top: 5px;">
+                        Kp, Min PWM and High PWM always come from AgOpenGPS. PID adds an integral to remove steady offset on valves with deadband, and damping from the wheel angle rate to stop overshoot. Feed-forward drives ahead of the change AgOpenGPS is asking for.
+                    </div>
+                </div>
+
+                <div id="pidGainsGroup" style="display: none;">
+                    <div class="form-group">
+                        <label for="steerKi">Ki (PWM per degree-second):</label>
+                        <input type="number" id="steerKi" name="steerKi" min="0" max="100" step="0.1" value="0">
+                    </div>
+                    <div class="form-group">
+                        <label for="steerKd">Kd (PWM per degree/s):</label>
+                        <input type="number" id="steerKd" name="steerKd" min="0" max="20" step="0.01" value="0">
+                    </div>
+                    <div class="form-group" id="kffGroup" style="display: none;">
+                        <label for="steerKff">Kff (PWM per degree/s of target):</label>
+                        <input type="number" id="steerKff" name="steerKff" min="0" max="20" step="0.01" value="0">
+                    </div>
+                </div>
+
+                <div class="form-group" style="margin-top: 15px;">
+                    <label for="controlLaneRate">Steering Control Rate:</label>
+                    <select id="controlLaneRate" name="controlLaneRate">
+                        <option value="0">100 Hz loop task (Default)</option>
+                        <option value="100">100 Hz timer</option>
+                        <option value="250">250 Hz timer</option>
+                        <option value="500">500 Hz timer</option>
+                        <option value="1000">1000 Hz timer</option>
+                    </select>
+                    <div class="help-text" style="margin-top: 5px;">
+                        Timer rates sample the WAS and update the motor on every tick. Requires a PWM, Tractor CAN or Keya serial motor driver; others stay on the loop task. Takes effect after a restart.
+                    </div>
+                </div>
+
+                <div class="toggle-container" style="margin-top: 15px;">
+                    <div class="toggle-info">
+                        <label for="steerAutoGains" class="toggle-label">Auto Gains from Actuator Identification</label>
+                        <div class="help-text">
+                            While steering, the module measures the valve or motor's gain, deadband and lag. Once confident, it sets Kp and Min PWM for the current speed instead of the AgOpenGPS values. High PWM and the PID gains still apply.
+                        </div>
+                    </div>
+                    <label class="toggle-switch">
+                        <input type="checkbox" id="steerAutoGains" name="steerAutoGains">
+                        <span class="toggle-slider"></span>
+                    </label>
+                </div>
+                <div class="help-text" id="actuatorEstimate" style="margin-top: 5px;">Loading...</div>
+                <button type="button" class="touch-button" style="background: #7f8c8d; margin-top: 10px;"
+                        onclick="resetActuatorEstimate()">
+                    Reset Actuator Estimate
+                </button>
+
                 <div class="form-group">
                     <label for="encoderType">Encoder Type:</label>
                     <select id="encoderType" name="encoderType">
@@ -376,6 +490,20 @@ const char TOUCH_FRIENDLY_DEVICE_SETTINGS_PAGE[] PROGMEM = R"rawliteral(
                     </div>
                 </div>
 
+                <div class="form-group" style="margin-top: 15px;">
+                    <label for="navEmitMode">PANDA/PAOGI Send Trigger:</label>
+                    <select id="navEmitMode" name="navEmitMode">
+                        <option value="1">Auto (Default)</option>
+                        <option value="2">Single: GGA + VTG</option>
+                        <option value="3">Dual: GGA + HPR/RELPOSNED, or KSXT</option>
+                        <option value="4">INS: INSPVAA/INSPVAXA</option>
+                        <option value="0">Fixed 10 Hz</option>
+                    </select>
+                    <div class="help-text" style="margin-top: 5px;">
+                        Send the position to AgIO as soon as the receiver finishes a fix instead of waiting for the next 10 Hz tick. Use Fixed 10 Hz only if your receiver does not send the listed messages.
+                    </div>
+                </div>
+
                 <div class="form-group" style="margin-top: 15px;">
                     <label for="serialRadioBaud">RTK Radio Baud Rate:</label>
                     <select id="serialRadioBaud" name="serialRadioBaud">
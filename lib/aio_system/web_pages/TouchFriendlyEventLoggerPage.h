@@ -99,6 +99,7 @@ const char TOUCH_FRIENDLY_EVENT_LOGGER_PAGE[] PROGMEM = R"rawliteral(
                 document.getElementById('serialLevel').value = data.serialLevel;
                 document.getElementById('udpEnabled').checked = data.udpEnabled;
                 document.getElementById('udpLevel').value = data.udpLevel;
+                document.getElementById('webLevel').value = data.webLevel;
                 document.getElementById('rateLimitDisabled').checked = data.rateLimitDisabled;
             })
             .catch(error => {
@@ -120,6 +121,7 @@ const char TOUCH_FRIENDLY_EVENT_LOGGER_PAGE[] PROGMEM = R"rawliteral(
                 serialLevel: parseInt(document.getElementById('serialLevel').value),
                 udpEnabled: document.getElementById('udpEnabled').checked,
                 udpLevel: parseInt(document.getElementById('udpLevel').value),
+                webLevel: parseInt(document.getElementById('webLevel').value),
                 rateLimitDisabled: document.getElementById('rateLimitDisabled').checked
             };
             
@@ -218,6 +220,22 @@ const char TOUCH_FRIENDLY_EVENT_LOGGER_PAGE[] PROGMEM = R"rawliteral(
                 </div>
             </div>
             
+            <div class="config-section">
+                <div class="toggle-row">
+                    <label for="webLevel" class="toggle-label">Web Log Viewer Level</label>
+                    <select id="webLevel" class="level-select">
+                        <option value="0">Emergency</option>
+                        <option value="1">Alert</option>
+                        <option value="2">Critical</option>
+                        <option value="3">Error</option>
+                        <option value="4">Warning</option>
+                        <option value="5">Notice</option>
+                        <option value="6">Info</option>
+                        <option value="7">Debug</option>
+                    </select>
+                </div>
+            </div>
+            
             <div class="config-section">
                 <div class="toggle-row">
                     <label for="rateLimitDisabled" class="toggle-label">Disable Rate Limiting</label>
@@ -65,6 +65,13 @@ const char TOUCH_FRIENDLY_GPS_CONFIG_PAGE[] PROGMEM = R"rawliteral(
             margin-bottom: 20px;
         }
         
+        .log-format-grid {
+            display: grid;
+            grid-template-columns: 1fr 1fr;
+            gap: 15px;
+            margin-bottom: 20px;
+        }
+        
         .nav-buttons {
             display: grid;
             grid-template-columns: 1fr;
@@ -184,6 +191,33 @@ const char TOUCH_FRIENDLY_GPS_CONFIG_PAGE[] PROGMEM = R"rawliteral(
             }
         }
         
+        async function setLogFormat(binary) {
+            setLoading(true);
+            showStatus('Switching GPS logs to ' + (binary ? 'binary' : 'ASCII') + '...', 'info');
+            
+            try {
+                const response = await fetch('/api/um98x/logformat', {
+                    method: 'POST',
+                    headers: {
+                        'Content-Type': 'application/json'
+                    },
+                    body: JSON.stringify({binary: binary})
+                });
+                
+                const data = await response.json();
+                
+                if (data.success) {
+                    showStatus('GPS logs switched and saved - Read to see them', 'success');
+                } else {
+                    showStatus('Error: ' + (data.error || 'Failed to switch log format'), 'error');
+                }
+            } catch (error) {
+                showStatus('Error: ' + error.message, 'error');
+            } finally {
+                setLoading(false);
+            }
+        }
+        
         function clearAll() {
             if (confirm('Clear all configuration fields?')) {
                 document.getElementById('config').value = '';
@@ -241,6 +275,11 @@ CONFIG COM3 460800`;
             <button class="touch-button btn-danger" onclick="clearAll()">Clear</button>
         </div>
         
+        <div class="log-format-grid">
+            <button class="touch-button btn-secondary" onclick="setLogFormat(true)">Binary Logs</button>
+            <button class="touch-button btn-secondary" onclick="setLogFormat(false)">ASCII Logs</button>
+        </div>
+        
         <div class="card">
             <div class="config-group">
                 <label for="config">Configuration Commands</label>
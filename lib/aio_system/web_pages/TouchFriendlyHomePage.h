@@ -70,6 +70,24 @@ const char TOUCH_FRIENDLY_HOME_PAGE[] PROGMEM = R"rawliteral(
                 </svg>
                 GPS Config
             </a></li>
+            <li><a href="/latency">
+                <svg width="24" height="24" viewBox="0 0 24 24" fill="white" style="margin-right: 10px;">
+                    <path d="M12 2a10 10 0 1 0 0 20a10 10 0 0 0 0-20m0 18a8 8 0 1 1 0-16a8 8 0 0 1 0 16m.5-13H11v6l5.25 3.15l.75-1.23l-4.5-2.67V7Z"/>
+                </svg>
+                Latency Trace
+            </a></li>
+            <li><a href="/rtcm">
+                <svg width="24" height="24" viewBox="0 0 24 24" fill="white" style="margin-right: 10px;">
+                    <path d="M12 5c-3.87 0-7.39 1.57-9.93 4.11l1.41 1.41A12 12 0 0 1 12 7c3.31 0 6.31 1.34 8.49 3.52l1.41-1.41A13.96 13.96 0 0 0 12 5m0 4c-2.76 0-5.26 1.12-7.07 2.93l1.41 1.41A8 8 0 0 1 12 11c2.21 0 4.21.9 5.66 2.34l1.41-1.41A9.97 9.97 0 0 0 12 9m0 4c-1.66 0-3.16.67-4.24 1.76L12 19l4.24-4.24A5.98 5.98 0 0 0 12 13Z"/>
+                </svg>
+                RTCM Status
+            </a></li>
+            <li><a href="/pgn">
+                <svg width="24" height="24" viewBox="0 0 24 24" fill="white" style="margin-right: 10px;">
+                    <path d="M4 5h16v2H4V5m0 6h10v2H4v-2m0 6h16v2H4v-2m14-7l4 2-4 2v-4Z"/>
+                </svg>
+                PGN Traffic
+            </a></li>
         </nav>
         
         <h2>System</h2>
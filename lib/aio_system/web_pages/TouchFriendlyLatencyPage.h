@@ -0,0 +1,153 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// TouchFriendlyLatencyPage.h
+// Touch-optimized end-to-end latency trace page (polls /api/latency)
+
+#ifndef TOUCH_FRIENDLY_LATENCY_PAGE_H
+#define TOUCH_FRIENDLY_LATENCY_PAGE_H
+
+#include <Arduino.h>
+
+const char TOUCH_FRIENDLY_LATENCY_PAGE[] PROGMEM = R"rawliteral(
+<!DOCTYPE html>
+<html>
+<head>
+    <meta charset="UTF-8">
+    <meta name="viewport" content="width=device-width, initial-scale=1.0, maximum-scale=1.0, user-scalable=no">
+    <meta name="apple-mobile-web-app-capable" content="yes">
+    <title>Latency Trace - AiO New Dawn</title>
+    <link rel="stylesheet" href="/touch.css">
+    <style>
+        /* Additional styles specific to latency trace */
+        .latency-table {
+            width: 100%;
+            border-collapse: collapse;
+            font-size: 16px;
+        }
+
+        .latency-table th, .latency-table td {
+            padding: 8px 6px;
+            text-align: right;
+            border-bottom: 1px solid #ecf0f1;
+        }
+
+        .latency-table th:first-child, .latency-table td:first-child {
+            text-align: left;
+        }
+
+        .hist-title {
+            font-size: 18px;
+            font-weight: 600;
+            color: #2c3e50;
+            margin: 15px 0 5px 0;
+        }
+
+        .hist-row {
+            display: flex;
+            align-items: center;
+            font-size: 13px;
+            height: 18px;
+        }
+
+        .hist-label {
+            width: 80px;
+            color: #7f8c8d;
+        }
+
+        .hist-bar {
+            height: 12px;
+            background: #3498db;
+            border-radius: 3px;
+            margin-right: 6px;
+        }
+
+        .nav-buttons {
+            display: grid;
+            grid-template-columns: 1fr 1fr;
+            gap: 15px;
+            margin-bottom: 20px;
+        }
+    </style>
+    <script>
+        function bucketLabel(b, count) {
+            const fmt = us => us >= 1000 ? (us / 1000) + 'ms' : us + 'us';
+            if (b === 0) return '<2us';
+            if (b === count - 1) return '>=' + fmt(1 << b);
+            return fmt(1 << b) + '+';
+        }
+
+        function render(data) {
+            let rows = '';
+            let hists = '';
+            data.paths.forEach(p => {
+                const avg = p.count ? p.avg : '-';
+                rows += '<tr><td>' + p.name + '</td><td>' + p.count + '</td><td>' + avg +
+                        '</td><td>' + p.p50 + '</td><td>' + p.p99 + '</td><td>' + p.max + '</td></tr>';
+
+                if (p.count === 0) return;
+                const peak = Math.max.apply(null, p.hist);
+                hists += '<div class="hist-title">' + p.name + '</div>';
+                p.hist.forEach((n, b) => {
+                    if (n === 0) return;
+                    const width = Math.max(1, Math.round(200 * n / peak));
+                    hists += '<div class="hist-row"><span class="hist-label">' + bucketLabel(b, p.hist.length) +
+                             '</span><span class="hist-bar" style="width:' + width + 'px"></span>' + n + '</div>';
+                });
+            });
+            document.getElementById('latencyRows').innerHTML = rows;
+            document.getElementById('histograms').innerHTML = hists || 'No samples yet';
+        }
+
+        function loadStats() {
+            fetch('/api/latency')
+            .then(response => response.json())
+            .then(render)
+            .catch(error => console.error('Error loading latency stats:', error));
+        }
+
+        function resetStats() {
+            fetch('/api/latency/reset', {method: 'POST'})
+            .then(() => loadStats());
+        }
+
+        window.onload = function() {
+            loadStats();
+            setInterval(loadStats, 1000);
+        };
+    </script>
+</head>
+<body>
+    <div class="container">
+        <h1>Latency Trace</h1>
+
+        <div class="nav-buttons">
+            <button type="button" class="touch-button" style="background: #7f8c8d;"
+                    onclick="window.location.href='/'">
+                Back to Home
+            </button>
+            <button type="button" class="touch-button" onclick="resetStats()">
+                Reset
+            </button>
+        </div>
+
+        <div class="card">
+            <table class="latency-table">
+                <thead>
+                    <tr><th>Path</th><th>Count</th><th>Avg</th><th>p50</th><th>p99</th><th>Max</th></tr>
+                </thead>
+                <tbody id="latencyRows"></tbody>
+            </table>
+            <div class="info">All times in microseconds, from the first byte read to the data leaving the board</div>
+        </div>
+
+        <div class="card" id="histograms">Loading...</div>
+    </div>
+</body>
+</html>
+)rawliteral";
+
+#endif // TOUCH_FRIENDLY_LATENCY_PAGE_H
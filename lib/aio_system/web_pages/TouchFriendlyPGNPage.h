@@ -0,0 +1,206 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// TouchFriendlyPGNPage.h
+// Touch-optimized PGN traffic page (polls /api/pgn)
+
+#ifndef TOUCH_FRIENDLY_PGN_PAGE_H
+#define TOUCH_FRIENDLY_PGN_PAGE_H
+
+#include <Arduino.h>
+
+const char TOUCH_FRIENDLY_PGN_PAGE[] PROGMEM = R"rawliteral(
+<!DOCTYPE html>
+<html>
+<head>
+    <meta charset="UTF-8">
+    <meta name="viewport" content="width=device-width, initial-scale=1.0, maximum-scale=1.0, user-scalable=no">
+    <meta name="apple-mobile-web-app-capable" content="yes">
+    <title>PGN Traffic - AiO New Dawn</title>
+    <link rel="stylesheet" href="/touch.css">
+    <style>
+        /* Additional styles specific to PGN traffic */
+        .pgn-table {
+            width: 100%;
+            border-collapse: collapse;
+            font-size: 16px;
+        }
+
+        .pgn-table th, .pgn-table td {
+            padding: 8px 6px;
+            text-align: right;
+            border-bottom: 1px solid #ecf0f1;
+        }
+
+        .pgn-table th:first-child, .pgn-table td:first-child,
+        .pgn-table th:nth-child(2), .pgn-table td:nth-child(2) {
+            text-align: left;
+        }
+
+        .errors {
+            color: #e74c3c;
+        }
+
+        .nav-buttons {
+            display: grid;
+            grid-template-columns: 1fr 1fr;
+            gap: 15px;
+            margin-bottom: 20px;
+        }
+    </style>
+    <script>
+        const NAMES = {200: 'Hello', 201: 'Subnet change', 202: 'Scan request', 229: 'Sections 1-64',
+                       235: 'Section dimensions', 236: 'Machine pin config', 238: 'Machine config',
+                       239: 'Machine data', 251: 'Steer config', 252: 'Steer settings', 254: 'Steer data'};
+
+        let previous = null;
+        let previousTime = 0;
+        let budgetLoaded = false;
+
+        function render(data) {
+            const now = Date.now();
+            let rows = '';
+            data.pgns.sort((a, b) => a.pgn - b.pgn).forEach(p => {
+                let rate = '-';
+                if (previous) {
+                    const old = previous.pgns.find(o => o.pgn === p.pgn);
+                    if (old && p.received >= old.received) {
+                        rate = ((p.received - old.received) * 1000 / (now - previousTime)).toFixed(1);
+                    }
+                }
+                const avg = p.received ? (p.handlerUs / p.received).toFixed(0) : '-';
+                const crc = p.crcErrors ? '<span class="errors">' + p.crcErrors + '</span>' : '0';
+                rows += '<tr><td>' + p.pgn + ' ' + (NAMES[p.pgn] || '') + '</td><td>' + p.subscribers.join(', ') +
+                        '</td><td>' + p.received + '</td><td>' + rate + '</td><td>' + crc + '</td><td>' +
+                        avg + ' / ' + p.handlerMaxUs + '</td></tr>';
+            });
+            rows += '<tr><td>Unhandled</td><td>-</td><td>' + data.unhandled + '</td><td>-</td><td>' +
+                    data.unhandledCRCErrors + '</td><td>-</td></tr>';
+            document.getElementById('pgnRows').innerHTML = rows;
+
+            let sockets = '';
+            data.sockets.forEach(s => {
+                const full = s.overflows ? '<span class="errors">' + s.overflows + '</span>' : '0';
+                const dropped = s.dropped ? '<span class="errors">' + s.dropped + '</span>' : '0';
+                sockets += '<tr><td>' + s.name + '</td><td>' + s.datagrams + '</td><td>' + s.peak + ' / ' + s.queue +
+                           '</td><td>' + full + '</td><td>' + s.budgetHits + '</td><td>' + dropped + '</td></tr>';
+            });
+            document.getElementById('socketRows').innerHTML = sockets;
+            document.getElementById('budget').textContent = data.budgetUs + ' us, ' + data.maxPackets + ' datagrams per socket';
+            if (!budgetLoaded) {
+                document.getElementById('budgetUs').value = data.budgetUs;
+                document.getElementById('maxPackets').value = data.maxPackets;
+                budgetLoaded = true;
+            }
+
+            const tx = data.tx;
+            const datagrams = tx.sent + tx.failed;
+            document.getElementById('txSent').textContent = tx.sent + ' of ' + tx.queued + ' queued' +
+                (tx.packed ? ' (' + tx.packed + ' packed)' : '');
+            document.getElementById('txFailed').innerHTML = tx.failed ? '<span class="errors">' + tx.failed + '</span>' : '0';
+            document.getElementById('txQueue').textContent = (datagrams ? (tx.queueUs / datagrams).toFixed(0) : '-') +
+                ' / ' + tx.queueMaxUs + ' us';
+            document.getElementById('txDepth').textContent = tx.peak + ' / ' + tx.slots +
+                (tx.earlyFlushes ? ', ' + tx.earlyFlushes + ' early flushes' : '');
+            document.getElementById('txPacking').checked = tx.packing;
+            previous = data;
+            previousTime = now;
+        }
+
+        function loadStats() {
+            fetch('/api/pgn')
+            .then(response => response.json())
+            .then(render)
+            .catch(error => console.error('Error loading PGN stats:', error));
+        }
+
+        function setPacking(enabled) {
+            fetch('/api/pgn/tx', {method: 'POST', headers: {'Content-Type': 'application/json'},
+                                  body: JSON.stringify({packing: enabled})});
+        }
+
+        function setBudget() {
+            fetch('/api/pgn/budget', {method: 'POST', headers: {'Content-Type': 'application/json'},
+                                      body: JSON.stringify({budgetUs: parseInt(document.getElementById('budgetUs').value),
+                                                            maxPackets: parseInt(document.getElementById('maxPackets').value)})})
+            .then(() => { budgetLoaded = false; loadStats(); });
+        }
+
+        function resetStats() {
+            fetch('/api/pgn/reset', {method: 'POST'})
+            .then(() => { previous = null; loadStats(); });
+        }
+
+        window.onload = function() {
+            loadStats();
+            setInterval(loadStats, 1000);
+        };
+    </script>
+</head>
+<body>
+    <div class="container">
+        <h1>PGN Traffic</h1>
+
+        <div class="nav-buttons">
+            <button type="button" class="touch-button" style="background: #7f8c8d;"
+                    onclick="window.location.href='/'">
+                Back to Home
+            </button>
+            <button type="button" class="touch-button" onclick="resetStats()">
+                Reset
+            </button>
+        </div>
+
+        <div class="card">
+            <table class="pgn-table">
+                <thead>
+                    <tr><th>PGN</th><th>Subscribers</th><th>Received</th><th>Hz</th><th>Bad CRC</th><th>Handler us avg / max</th></tr>
+                </thead>
+                <tbody id="pgnRows"></tbody>
+            </table>
+            <div class="info">Datagrams from AgIO on port 9999. Handler time is all subscribers of a PGN together;
+                Unhandled counts PGNs no module subscribes to</div>
+        </div>
+
+        <div class="card">
+            <table class="pgn-table">
+                <thead>
+                    <tr><th>Socket</th><th>Datagrams</th><th>Peak / queue</th><th>Overflows</th><th>Budget hits</th><th>Dropped</th></tr>
+                </thead>
+                <tbody id="socketRows"></tbody>
+            </table>
+            <div class="info">Each poll drains every socket within a budget of <span id="budget">-</span>.
+                Peak is the most datagrams waiting at once; Overflows counts datagrams discarded for a newer one
+                because the queue was full. Dropped counts empty or oversize fragmented datagrams.</div>
+            <table class="pgn-table">
+                <tbody>
+                    <tr><td>Poll budget (us, 50-5000)</td><td><input type="number" id="budgetUs" min="50" max="5000"></td></tr>
+                    <tr><td>Datagrams per socket (1-64)</td><td><input type="number" id="maxPackets" min="1" max="64"></td></tr>
+                </tbody>
+            </table>
+            <button type="button" class="touch-button" onclick="setBudget()">Apply Budget</button>
+            <div class="info">The budget is back to 500 us, 16 datagrams after every restart.</div>
+        </div>
+
+        <div class="card">
+            <table class="pgn-table">
+                <tbody>
+                    <tr><td>Sent to AgIO</td><td id="txSent">-</td></tr>
+                    <tr><td>Send failures</td><td id="txFailed">-</td></tr>
+                    <tr><td>Time in queue avg / max</td><td id="txQueue">-</td></tr>
+                    <tr><td>Peak queued / slots</td><td id="txDepth">-</td></tr>
+                    <tr><td>Pack NMEA sentences</td><td><input type="checkbox" id="txPacking" onchange="setPacking(this.checked)"></td></tr>
+                </tbody>
+            </table>
+            <div class="info">Outgoing PGNs and sentences are queued by each task and sent together once per loop pass.
+                Packing puts consecutive sentences in one datagram; it is off after every restart.</div>
+        </div>
+    </div>
+</body>
+</html>
+)rawliteral";
+
+#endif // TOUCH_FRIENDLY_PGN_PAGE_H
@@ -0,0 +1,261 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// TouchFriendlyRTCMPage.h
+// Touch-optimized RTCM correction status page (polls /api/rtcm)
+
+#ifndef TOUCH_FRIENDLY_RTCM_PAGE_H
+#define TOUCH_FRIENDLY_RTCM_PAGE_H
+
+#include <Arduino.h>
+
+const char TOUCH_FRIENDLY_RTCM_PAGE[] PROGMEM = R"rawliteral(
+<!DOCTYPE html>
+<html>
+<head>
+    <meta charset="UTF-8">
+    <meta name="viewport" content="width=device-width, initial-scale=1.0, maximum-scale=1.0, user-scalable=no">
+    <meta name="apple-mobile-web-app-capable" content="yes">
+    <title>RTCM Status - AiO New Dawn</title>
+    <link rel="stylesheet" href="/touch.css">
+    <style>
+        /* Additional styles specific to RTCM status */
+        .rtcm-table {
+            width: 100%;
+            border-collapse: collapse;
+            font-size: 16px;
+        }
+
+        .rtcm-table th, .rtcm-table td {
+            padding: 8px 6px;
+            text-align: right;
+            border-bottom: 1px solid #ecf0f1;
+        }
+
+        .rtcm-table th:first-child, .rtcm-table td:first-child {
+            text-align: left;
+        }
+
+        .summary-grid {
+            display: grid;
+            grid-template-columns: 1fr 1fr;
+            gap: 8px 15px;
+            font-size: 16px;
+        }
+
+        .summary-value {
+            font-weight: 600;
+            text-align: right;
+        }
+
+        .stale {
+            color: #e74c3c;
+        }
+
+        .output-options {
+            display: grid;
+            grid-template-columns: 1fr 1fr;
+            gap: 10px 15px;
+            font-size: 16px;
+            margin-top: 15px;
+            align-items: center;
+        }
+
+        .output-options input[type="text"], .output-options input[type="number"] {
+            font-size: 16px;
+            padding: 8px;
+        }
+
+        .nav-buttons {
+            display: grid;
+            grid-template-columns: 1fr 1fr;
+            gap: 15px;
+            margin-bottom: 20px;
+        }
+    </style>
+    <script>
+        // Well-known message numbers; MSM families are named by their 4th digit
+        const NAMES = {1005: 'Base ARP', 1006: 'Base ARP + height', 1008: 'Antenna', 1033: 'Receiver/antenna',
+                       1230: 'GLONASS biases'};
+        const MSM = {107: 'GPS', 108: 'GLONASS', 109: 'Galileo', 111: 'QZSS', 112: 'BeiDou'};
+
+        function typeName(t) {
+            if (NAMES[t]) return NAMES[t];
+            const family = MSM[Math.floor(t / 10)];
+            return family ? family + ' MSM' + (t % 10) : '';
+        }
+
+        function fmtAge(ms) {
+            if (ms < 0) return '-';
+            const s = ms / 1000;
+            const text = s.toFixed(1) + 's';
+            return s > 10 ? '<span class="stale">' + text + '</span>' : text;
+        }
+
+        function render(data) {
+            document.getElementById('datagrams').textContent = data.datagrams;
+            document.getElementById('radioLoss').textContent = data.radioOverruns + ' overruns, ' +
+                                                               data.radioRxFull + ' RX full';
+            document.getElementById('rate').textContent = data.bytesPerSec + ' B/s';
+            document.getElementById('age').innerHTML = fmtAge(data.age);
+            document.getElementById('primary').textContent = data.primary || '-';
+            document.getElementById('switches').textContent = data.switches +
+                (data.switches ? ' (last ' + (data.switchAge / 1000).toFixed(0) + 's ago, ' + data.switchReason + ')' : '');
+
+            let sources = '';
+            data.sources.forEach(s => {
+                const name = s.primary ? '<b>' + s.name + '</b>' : s.name;
+                const epochs = s.epochs ? s.cleanEpochs + '/' + s.epochs : '-';
+                sources += '<tr><td>' + name + '</td><td>' + fmtAge(s.age) + '</td><td>' + epochs +
+                           '</td><td>' + s.frames + '</td><td>' + s.standby + '</td><td>' + s.badCRC +
+                           '</td><td>' + (s.skipped + s.badLength) + '</td><td>' + s.lost + '</td></tr>';
+            });
+            document.getElementById('sourceRows').innerHTML = sources;
+
+            let outputs = '';
+            data.outputs.forEach(o => {
+                outputs += '<tr><td>' + o.name + '</td><td>' + (o.enabled ? 'On' : 'Off') + '</td><td>' +
+                           o.frames + '</td><td>' + o.queued + ' / ' + o.peak + '</td><td>' + o.dropped + '</td></tr>';
+            });
+            document.getElementById('outputRows').innerHTML = outputs;
+            if (!outputsLoaded) {
+                // Only once, so a refresh doesn't undo unsaved edits
+                document.getElementById('outGPS2').checked = data.outputs[0].enabled;
+                document.getElementById('outRS232').checked = data.outputs[1].enabled;
+                document.getElementById('outUDP').checked = data.outputs[2].enabled;
+                document.getElementById('udpIP').value = data.udpIP === '0.0.0.0' ? '' : data.udpIP;
+                document.getElementById('udpPort').value = data.udpPort;
+                outputsLoaded = true;
+            }
+
+            let rows = '';
+            data.types.sort((a, b) => a.type - b.type).forEach(t => {
+                rows += '<tr><td>' + t.type + ' ' + typeName(t.type) + '</td><td>' + t.count + '</td><td>' +
+                        t.rate + '</td><td>' + fmtAge(t.age) + '</td></tr>';
+            });
+            document.getElementById('typeRows').innerHTML = rows || '<tr><td colspan="4">No frames yet</td></tr>';
+        }
+
+        function loadStats() {
+            fetch('/api/rtcm')
+            .then(response => response.json())
+            .then(render)
+            .catch(error => console.error('Error loading RTCM stats:', error));
+        }
+
+        let outputsLoaded = false;
+
+        function saveOutputs() {
+            const settings = {
+                gps2: document.getElementById('outGPS2').checked,
+                rs232: document.getElementById('outRS232').checked,
+                udp: document.getElementById('outUDP').checked,
+                udpIP: document.getElementById('udpIP').value.trim(),
+                udpPort: parseInt(document.getElementById('udpPort').value) || 2234
+            };
+            fetch('/api/rtcm/outputs', {
+                method: 'POST',
+                headers: {'Content-Type': 'application/json'},
+                body: JSON.stringify(settings)
+            })
+            .then(response => response.json())
+            .then(data => {
+                document.getElementById('outputStatus').textContent =
+                    data.status === 'saved' ? 'Saved' : ('Error: ' + (data.message || 'not saved'));
+                loadStats();
+            })
+            .catch(error => document.getElementById('outputStatus').textContent = 'Error: ' + error);
+        }
+
+        function resetStats() {
+            fetch('/api/rtcm/reset', {method: 'POST'})
+            .then(() => loadStats());
+        }
+
+        window.onload = function() {
+            loadStats();
+            setInterval(loadStats, 1000);
+        };
+    </script>
+</head>
+<body>
+    <div class="container">
+        <h1>RTCM Status</h1>
+
+        <div class="nav-buttons">
+            <button type="button" class="touch-button" style="background: #7f8c8d;"
+                    onclick="window.location.href='/'">
+                Back to Home
+            </button>
+            <button type="button" class="touch-button" onclick="resetStats()">
+                Reset
+            </button>
+        </div>
+
+        <div class="card">
+            <div class="summary-grid">
+                <span>Correction age</span><span class="summary-value" id="age">-</span>
+                <span>Rate to GPS1</span><span class="summary-value" id="rate">-</span>
+                <span>UDP datagrams</span><span class="summary-value" id="datagrams">-</span>
+                <span>Radio UART loss</span><span class="summary-value" id="radioLoss">-</span>
+                <span>Primary source</span><span class="summary-value" id="primary">-</span>
+                <span>Source switches</span><span class="summary-value" id="switches">-</span>
+            </div>
+        </div>
+
+        <div class="card">
+            <table class="rtcm-table">
+                <thead>
+                    <tr><th>Source</th><th>Age</th><th>Epochs</th><th>Frames</th><th>Standby</th><th>Bad CRC</th><th>Skipped</th><th>Cut</th></tr>
+                </thead>
+                <tbody id="sourceRows"></tbody>
+            </table>
+            <div class="info">The primary (bold) feeds GPS1; Standby counts the other source's frames held back.
+                Epochs shows clean epochs of the last 8. Skipped counts bytes outside any valid frame;
+                Cut counts frames lost to a radio UART overflow</div>
+        </div>
+
+        <div class="card">
+            <table class="rtcm-table">
+                <thead>
+                    <tr><th>Message</th><th>Count</th><th>B/s</th><th>Age</th></tr>
+                </thead>
+                <tbody id="typeRows"></tbody>
+            </table>
+            <div class="info">Only frames with a good CRC-24Q are forwarded to the receiver</div>
+        </div>
+
+        <div class="card">
+            <table class="rtcm-table">
+                <thead>
+                    <tr><th>Output</th><th>State</th><th>Frames</th><th>Queued / peak</th><th>Dropped</th></tr>
+                </thead>
+                <tbody id="outputRows"></tbody>
+            </table>
+            <div class="output-options">
+                <label><input type="checkbox" id="outGPS2"> GPS2 receiver</label>
+                <label><input type="checkbox" id="outRS232"> RS232</label>
+                <label><input type="checkbox" id="outUDP"> UDP</label>
+                <span></span>
+                <label for="udpIP">UDP address</label>
+                <input type="text" id="udpIP" placeholder="Module broadcast">
+                <label for="udpPort">UDP port</label>
+                <input type="number" id="udpPort" min="1" max="65534" value="2234">
+            </div>
+            <div class="nav-buttons" style="margin-top: 15px;">
+                <button type="button" class="touch-button" onclick="saveOutputs()">Save Outputs</button>
+                <span id="outputStatus" style="align-self: center;"></span>
+            </div>
+            <div class="info">Frames sent to GPS1 are repeated to the outputs selected here for a second
+                receiver or rover. A slow output drops its oldest frames instead of delaying the others.
+                Port 2233 is where this module receives corrections - use another port for UDP.</div>
+        </div>
+    </div>
+</body>
+</html>
+)rawliteral";
+
+#endif // TOUCH_FRIENDLY_RTCM_PAGE_H
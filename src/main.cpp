@@ -171,17 +171,36 @@ void taskUDPPoll() {
   QNEthernetUDPHandler::poll();
 }
 
+// GPS UARTs are drained in bursts so a stalled loop pass doesn't cost bytes.
+// A full RX buffer on entry (core 64 + 128 from addMemoryForRead) means the
+// UART has probably already dropped data.
+static constexpr int GPS_RX_CAPACITY = 64 + 128;
+static constexpr int GPS_BURST_SIZE = 64;
+static constexpr int GPS_DRAIN_BUDGET = 256;  // Bytes per task run, bounds time spent here
+
 void taskGPS1Serial() {
-  if (SerialGPS1.available()) {
-    char c = SerialGPS1.read();
-    gnssProcessor.processNMEAChar(c);
+  static char burst[GPS_BURST_SIZE];
+  int avail = SerialGPS1.available();
+  if (avail >= GPS_RX_CAPACITY - 1) {
+    gnssProcessor.noteRxSaturated();
+  }
+
+  int budget = GPS_DRAIN_BUDGET;
+  while (avail > 0 && budget > 0) {
+    int n = min(min(avail, GPS_BURST_SIZE), budget);
+    for (int i = 0; i < n; i++) {
+      burst[i] = SerialGPS1.read();
+    }
+    gnssProcessor.processNMEAStream(burst, n);
+    budget -= n;
+    avail = SerialGPS1.available();
   }
 }
 
 void taskGPS2Serial() {
-  if (SerialGPS2.available()) {
-    uint8_t b = SerialGPS2.read();
-    gnssProcessor.processUBXByte(b);
+  int budget = GPS_DRAIN_BUDGET;
+  while (budget-- > 0 && SerialGPS2.available()) {
+    gnssProcessor.processUBXByte(SerialGPS2.read());
   }
 }
 
@@ -487,59 +506,76 @@ void setup()
   LOG_INFO(EventSource::SYSTEM, "Initializing SimpleScheduler...");
 
   // Add EVERY_LOOP tasks (no timing)
+  // QNEthernet and the UDP handlers need polling after every Ethernet interrupt
   scheduler.addTask(SimpleScheduler::EVERY_LOOP, taskEthernetLoop, "Ethernet Loop");
   scheduler.addTask(SimpleScheduler::EVERY_LOOP, taskQNetworkPoll, "QNetwork Poll");
   scheduler.addTask(SimpleScheduler::EVERY_LOOP, taskUDPPoll, "UDP Poll");
-  scheduler.addTask(SimpleScheduler::EVERY_LOOP, taskGPS1Serial, "GPS1 Serial");
-  scheduler.addTask(SimpleScheduler::EVERY_LOOP, taskGPS2Serial, "GPS2 Serial");
 
-  // Add these as EVERY_LOOP for now (they have no timing currently)
-  scheduler.addTask(SimpleScheduler::EVERY_LOOP, []{
+  // Event-driven tasks: run only when their UART has data (the RX interrupt
+  // wakes the idle loop) or when their housekeeping interval (ms) expires
+  scheduler.addEventTask(taskGPS1Serial, "GPS1 Serial", []{ return SerialGPS1.available() > 0; });
+  scheduler.addEventTask(taskGPS2Serial, "GPS2 Serial", []{ return SerialGPS2.available() > 0; });
+  scheduler.addEventTask([]{
     imuProcessor.process();
-  }, "IMU");
-  scheduler.addTask(SimpleScheduler::EVERY_LOOP, []{
-    adProcessor.process();
-  }, "ADProcessor");
-  scheduler.addTask(SimpleScheduler::EVERY_LOOP, []{
+  }, "IMU", []{ return SerialIMU.available() > 0; }, 10);
+  scheduler.addEventTask([]{
     esp32Interface.process();
-  }, "ESP32");
-  scheduler.addTask(SimpleScheduler::EVERY_LOOP, []{
+  }, "ESP32", []{ return SerialESP32.available() > 0 || esp32Interface.hasPendingTx(); }, 100);
+  scheduler.addEventTask([]{
     RTCMProcessor::getInstance()->process();
-  }, "RTCM");
-  scheduler.addTask(SimpleScheduler::EVERY_LOOP, []{
+  }, "RTCM", []{
+    return SerialRadio.available() > 0 || RTCMProcessor::getInstance()->hasPendingOutput();
+  }, 1000);
+
+  // Sampling/watchdog tasks that used to spin every loop - they keep their own
+  // internal cadence, so waking them at that cadence is enough
+  scheduler.addEventTask([]{
+    adProcessor.process();
+  }, "ADProcessor", nullptr, 1);  // 1ms current sampling, 5ms WAS
+  scheduler.addEventTask([]{
+    KickoutMonitor::getInstance()->process();
+  }, "Kickout Monitor", nullptr, 1);
+  scheduler.addEventTask([]{
     EncoderProcessor::getInstance()->process();
-  }, "Encoder");
-  scheduler.addTask(SimpleScheduler::EVERY_LOOP, []{
+  }, "Encoder", nullptr, 10);  // Counting happens in the Encoder library ISR
+  scheduler.addEventTask([]{
     MachineProcessor::getInstance()->process();
-  }, "Machine");
-  scheduler.addTask(SimpleScheduler::EVERY_LOOP, []{
+  }, "Machine", nullptr, 10);
+  scheduler.addEventTask([]{
     pwmProcessor.process();
-  }, "PWM");
-  scheduler.addTask(SimpleScheduler::EVERY_LOOP, []{
-    KickoutMonitor::getInstance()->process();
-  }, "Kickout Monitor");
-
-  // Add 100Hz tasks (critical timing)
-  scheduler.addTask(SimpleScheduler::HZ_100, taskAutosteer, "Autosteer");
-  scheduler.addTask(SimpleScheduler::HZ_100, taskWebHandleClient, "Web Client");
-  scheduler.addTask(SimpleScheduler::HZ_100, taskWebBroadcastTelemetry, "Web Telemetry");
-
-  // Add 50Hz tasks (motor control)
-  scheduler.addTask(SimpleScheduler::HZ_50, taskMotorDriver, "Motor Driver");
-
-  // Add 10Hz tasks (UI and status)
-  scheduler.addTask(SimpleScheduler::HZ_10, taskLEDUpdate, "LED Update");
-  scheduler.addTask(SimpleScheduler::HZ_10, taskNetworkCheck, "Network Check");
-  scheduler.addTask(SimpleScheduler::HZ_10, taskNAVProcess, "NAV Process");
-  scheduler.addTask(SimpleScheduler::HZ_10, taskKickoutSendPGN250, "PGN250 Send");
+  }, "PWM", nullptr, 50);  // Speed pulse updates every 200ms
+
+  // Deadline-driven tasks: period, phase offset, priority and budget (all us).
+  // Phases spread the 10ms frame so no two periodic tasks share a tick:
+  //   0ms Autosteer | 1ms Motor | 2ms LED | 3ms Web Client | 4ms Network Check
+  //   5ms NAV | 6ms Web Telemetry | 7ms PGN250 | 8ms CommandHandler
+  scheduler.addTimedTask(taskAutosteer, "Autosteer",
+                         10000, 0, SimpleScheduler::PRIORITY_CONTROL, 300);
+  scheduler.addTimedTask(taskMotorDriver, "Motor Driver",
+                         20000, 1000, SimpleScheduler::PRIORITY_HIGH, 200);
+  scheduler.addTimedTask(taskNAVProcess, "NAV Process",  // Backstop - PANDA/PAOGI normally go out on fix epoch
+                         100000, 5000, SimpleScheduler::PRIORITY_HIGH, 200);
+  scheduler.addTimedTask(taskKickoutSendPGN250, "PGN250 Send",
+                         100000, 7000, SimpleScheduler::PRIORITY_HIGH, 100);
+  scheduler.addTimedTask(taskWebHandleClient, "Web Client",
+                         10000, 3000, SimpleScheduler::PRIORITY_NORMAL, 500);
+  scheduler.addTimedTask(taskWebBroadcastTelemetry, "Web Telemetry",
+                         10000, 6000, SimpleScheduler::PRIORITY_NORMAL, 500);
+  scheduler.addTimedTask(taskLEDUpdate, "LED Update",
+                         100000, 2000, SimpleScheduler::PRIORITY_LOW, 300);
+  scheduler.addTimedTask(taskNetworkCheck, "Network Check",
+                         100000, 4000, SimpleScheduler::PRIORITY_LOW, 100);
   // Buffer stats disabled - only enable when actually monitoring
-  // scheduler.addTask(SimpleScheduler::HZ_10, taskBufferStats, "Buffer Stats");
-  scheduler.addTask(SimpleScheduler::HZ_10, []{
+  // scheduler.addTimedTask(taskBufferStats, "Buffer Stats", 100000, 9000, SimpleScheduler::PRIORITY_LOW);
+  scheduler.addTimedTask([]{
     CommandHandler::getInstance()->process();
-  }, "CommandHandler");
+  }, "CommandHandler", 100000, 8000, SimpleScheduler::PRIORITY_LOW, 200);
+
+  // Nothing ready -> WFI until the next interrupt instead of spinning
+  scheduler.setIdleSleep(true);
 
   LOG_INFO(EventSource::SYSTEM, "SimpleScheduler initialized with %d tasks",
-           5 + 8 + 3 + 1 + 5); // EVERY_LOOP + 100Hz + 50Hz + 10Hz
+           3 + 10 + 9); // EVERY_LOOP + event + timed
 
   // Display access information
   localIP = Ethernet.localIP();  // Reuse existing variable
@@ -580,6 +616,8 @@ void loop()
   // ============================================
   scheduler.run();
 
+  // Everything the tasks queued for AgIO goes out together
+  QNEthernetUDPHandler::flushTx();
 
   // Loop timing - ultra lightweight, just increment counter
   if (loopTimingEnabled) {
@@ -0,0 +1,541 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+
+// autosteer_sim.cpp
+// Closed-loop host simulation of the autosteer path. The real
+// AutosteerProcessor, ADProcessor (WAS scaling) and ConfigManager run against
+// a simulated tractor:
+//   vehicle  - kinematic bicycle model, 2.8 m wheelbase
+//   guidance - AgOpenGPS-style pure pursuit on a straight AB line, a 30 m
+//              radius curve or a line weaving 1.5 m either side every 40 m
+//              (keeps the steering busy), sent as PGN 254 at 10Hz; settings
+//              as PGN 252
+//   actuator - a MotorDriverInterface that moves the wheels:
+//                valve   - PWM hydraulic valve (deadband, flow lag)
+//                keya    - Keya serial motor (50Hz command, accel and RPM limit)
+//                danfoss - Danfoss PVE (25-75% duty, spool overlap and lag)
+//   WAS      - the wheel angle as 12-bit counts on the WAS pin
+// Time is virtual: millis()/micros() advance with the 10kHz plant step and
+// the firmware runs on the main loop's schedule (ADProcessor every 1ms,
+// autosteer 100Hz, motor driver 50Hz) plus the control lane tick when the
+// actuator supports it. Network, CAN, encoder, VWAS and web are stubbed
+// (firmware_stubs.cpp, shim/).
+//
+// After engaging 1 s in, reports the time to acquire the line (within 10 cm),
+// then from 10 s after engaging: cross-track and wheel angle tracking error,
+// actuator effort, the actuator estimate the firmware identified, the host CPU
+// time per autosteer tick, ADProcessor pass and control lane tick, and the
+// speed-up over real time. --auto-gains 1 lets the estimate schedule Kp and minPWM. The firmware keeps function statics, so
+// each run is a separate process. --max-xte-cm makes it exit 1 when the
+// cross-track RMS is over the limit, for regression runs. --log-level sets
+// the EventLogger serial level the firmware gates its LOG_* calls on (INFO
+// by default, as shipped); --log prints messages up to that severity.
+//
+// Build (from the repository root):
+//   g++ -std=gnu++17 -O2 -Itools/autosteer_sim/shim -Ilib/aio_autosteer -Ilib/aio_config -Ilib/aio_system -Ilib/aio_communications tools/autosteer_sim/*.cpp lib/aio_autosteer/AutosteerProcessor.cpp lib/aio_autosteer/ADProcessor.cpp lib/aio_autosteer/KickoutMonitor.cpp lib/aio_config/ConfigManager.cpp -o autosteer_sim
+//
+// Run:
+//   ./autosteer_sim [--actuator valve|keya|danfoss] [--path line|curve|wave] [--speed KMH] [--offset M]
+//                   [--duration S] [--rate 0|100..1000] [--mode p|pid|pidff] [--kp N] [--ki N] [--kd N]
+//                   [--kff N] [--min N] [--high N] [--auto-gains 0|1] [--max-xte-cm N] [--log 0..7]
+//                   [--log-level 0..7]
+
+#include "AutosteerProcessor.h"
+#include "ADProcessor.h"
+#include "ConfigManager.h"
+#include "HardwareManager.h"
+#include "MotorDriverInterface.h"
+#include "ControlLane.h"
+#include "PGNProcessor.h"
+#include "EventLogger.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+
+// Firmware globals normally defined in main.cpp
+ConfigManager configManager;
+ADProcessor adProcessor;
+MotorDriverInterface* motorPTR = nullptr;
+
+// Shim state
+bool simLinkUp = true;
+uint32_t simCycleCounter = 0;
+int simLogLevel = -1;  // EventSeverity to print up to, -1 = silent
+extern ControlLane::TickFunction simLaneTick;
+extern uint16_t simLaneRateHz;
+
+static constexpr uint32_t PHYSICS_STEP_US = 100;   // 10kHz plant integration
+static constexpr uint32_t PGN254_PERIOD_US = 100000;
+static constexpr uint32_t ENGAGE_US = 1000000;
+static constexpr uint32_t MEASURE_AFTER_US = 10000000;  // Steady state starts 10 s after engaging
+static constexpr uint8_t WAS_COUNTS_PER_DEGREE = 30;
+
+// Virtual clock and pins
+static uint64_t simMicros = 0;
+static uint16_t wasCounts = 2048;
+
+static void advanceClock(uint32_t us)
+{
+    simMicros += us;
+    simCycleCounter = (uint32_t)(simMicros * (F_CPU_ACTUAL / 1000000UL));
+}
+
+uint32_t micros() { return (uint32_t)simMicros; }
+uint32_t millis() { return (uint32_t)(simMicros / 1000); }
+void delay(uint32_t ms) { advanceClock(ms * 1000); }
+void delayMicroseconds(uint32_t us) { advanceClock(us); }
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+int digitalRead(uint8_t) { return HIGH; }  // Steer and work switches open
+int analogRead(uint8_t pin) { return pin == WAS_SENSOR_PIN ? wasCounts : 0; }
+
+void simLog(const char* severity, const char* source, const char* message)
+{
+    printf("%10.3f %-6s %-5s %s\n", simMicros / 1e6, severity, source, message);
+}
+
+// Actuators: a positive drive steers towards negative angles, as on the
+// tractor. Each integrates the wheel angle it produces.
+class SimActuator : public MotorDriverInterface {
+public:
+    SimActuator(const char* name, MotorDriverType type, bool laneCapable)
+        : name(name), type(type), laneCapable(laneCapable) {}
+
+    bool init() override { return true; }
+    void enable(bool en) override
+    {
+        enabled = en;
+        if (!en) command = 0;
+    }
+    void setPWM(int16_t pwm) override { command = enabled ? constrain(pwm, -255, 255) : 0; }
+    void stop() override { command = 0; }
+    MotorStatus getStatus() const override
+    {
+        MotorStatus status = {};
+        status.enabled = enabled;
+        status.targetPWM = command;
+        status.actualPWM = command;
+        return status;
+    }
+    MotorDriverType getType() const override { return type; }
+    const char* getTypeName() const override { return name; }
+    bool hasCurrentSensing() const override { return false; }
+    bool hasPositionFeedback() const override { return false; }
+    bool supportsControlLane() const override { return laneCapable; }
+    bool isDetected() override { return true; }
+    void handleKickout(KickoutType, float) override {}
+    float getCurrentDraw() override { return 0.0f; }
+
+    virtual void step(double dt) = 0;
+    virtual void describe() const = 0;
+
+    bool isEnabled() const { return enabled; }
+    int16_t getCommand() const { return command; }
+    double angle = 0.0;  // Wheel angle, degrees, positive right
+
+protected:
+    void move(double rate, double dt)
+    {
+        angle -= rate * dt;
+        angle = constrain(angle, -MAX_ANGLE, MAX_ANGLE);
+    }
+
+    static constexpr double MAX_ANGLE = 40.0;
+    const char* name;
+    MotorDriverType type;
+    bool laneCapable;
+    bool enabled = false;
+    int16_t command = 0;
+};
+
+class ValveActuator : public SimActuator {
+public:
+    ValveActuator() : SimActuator("PWM valve", MotorDriverType::DRV8701, true) {}
+
+    void step(double dt) override
+    {
+        double excess = abs(command) > DEADBAND ? (abs(command) - DEADBAND) * (command > 0 ? 1 : -1) : 0.0;
+        flow += (excess * GAIN - flow) * dt / LAG;
+        move(flow, dt);
+    }
+    void describe() const override
+    {
+        printf("PWM valve: deadband %.0f PWM, %.2f deg/s per PWM, lag %.0f ms\n", DEADBAND, GAIN, LAG * 1000);
+    }
+
+private:
+    static constexpr double DEADBAND = 45.0;
+    static constexpr double GAIN = 0.30;
+    static constexpr double LAG = 0.12;
+    double flow = 0.0;
+};
+
+class KeyaActuator : public SimActuator {
+public:
+    KeyaActuator() : SimActuator("Keya motor", MotorDriverType::KEYA_SERIAL, true) {}
+
+    // KeyaSerialDriver sends the latest target every 20ms from the 50Hz task
+    void process() override { commandedRPM = (float)(command * 100 / 255); }
+
+    void step(double dt) override
+    {
+        float target = constrain(commandedRPM, -RPM_LIMIT, RPM_LIMIT);
+        if (fabsf(target) < STICTION_RPM) target = 0.0f;
+        float maxChange = ACCEL * dt;
+        rpm += constrain(target - rpm, -maxChange, maxChange);
+        move(rpm * 6.0 / STEERING_RATIO, dt);  // 6 deg/s per RPM at the steering wheel
+    }
+    void describe() const override
+    {
+        printf("Keya motor: %.0f RPM limit, %.0f RPM/s, %.0f:1 steering ratio, 50Hz commands\n", RPM_LIMIT, ACCEL,
+               STEERING_RATIO);
+    }
+
+private:
+    static constexpr float RPM_LIMIT = 80.0f;
+    static constexpr float ACCEL = 800.0f;
+    static constexpr float STICTION_RPM = 2.0f;
+    static constexpr double STEERING_RATIO = 16.0;
+    float commandedRPM = 0.0f;
+    float rpm = 0.0f;
+};
+
+class DanfossActuator : public SimActuator {
+public:
+    DanfossActuator() : SimActuator("Danfoss PVE", MotorDriverType::DANFOSS, false) {}
+
+    void step(double dt) override
+    {
+        // DanfossMotorDriver maps -255..255 onto 25-75% duty around 50%
+        int16_t duty = (int16_t)((float)command / 255.0f * 64);
+        double spool = duty / 64.0;
+        double open = fabs(spool) > OVERLAP ? (fabs(spool) - OVERLAP) / (1.0 - OVERLAP) * (spool > 0 ? 1 : -1) : 0.0;
+        flow += (open * MAX_RATE - flow) * dt / LAG;
+        move(flow, dt);
+    }
+    void describe() const override
+    {
+        printf("Danfoss PVE: %.0f%% spool overlap, %.0f deg/s full open, lag %.0f ms\n", OVERLAP * 100, MAX_RATE,
+               LAG * 1000);
+    }
+
+private:
+    static constexpr double OVERLAP = 0.12;
+    static constexpr double MAX_RATE = 35.0;
+    static constexpr double LAG = 0.08;
+    double flow = 0.0;
+};
+
+static SimActuator* makeActuator(const char* name)
+{
+    if (!strcmp(name, "valve")) return new ValveActuator();
+    if (!strcmp(name, "keya")) return new KeyaActuator();
+    if (!strcmp(name, "danfoss")) return new DanfossActuator();
+    return nullptr;
+}
+
+// Kinematic bicycle; heading in radians anticlockwise from +x
+struct Vehicle {
+    static constexpr double WHEELBASE = 2.8;
+    double x = 0.0;
+    double y = 0.0;
+    double heading = M_PI / 2;
+
+    void step(double speed, double steerDeg, double dt)
+    {
+        x += speed * cos(heading) * dt;
+        y += speed * sin(heading) * dt;
+        heading -= speed / WHEELBASE * tan(steerDeg * DEG_TO_RAD) * dt;  // Positive steer turns right
+    }
+};
+
+// Guidance line through the origin heading +y: straight, or curving right
+struct Path {
+    double radius;  // 0 = straight AB line
+    double wave;    // Amplitude of a sinusoidal line along the AB line, m
+
+    static constexpr double WAVELENGTH = 40.0;
+
+    double station(double x, double y) const { return radius > 0 ? radius * atan2(y, radius - x) : y; }
+    void point(double s, double& px, double& py) const
+    {
+        if (radius > 0) {
+            px = radius - radius * cos(s / radius);
+            py = radius * sin(s / radius);
+        } else {
+            px = wave * sin(2.0 * M_PI * s / WAVELENGTH);
+            py = s;
+        }
+    }
+    // Positive when the vehicle is right of the line
+    double crossTrack(double x, double y) const
+    {
+        if (radius > 0) return radius - hypot(x - radius, y);
+        double k = 2.0 * M_PI / WAVELENGTH;
+        return (x - wave * sin(k * y)) * cos(atan(wave * k * cos(k * y)));
+    }
+};
+
+// AgOpenGPS pure pursuit: steer for the arc through a point one lookahead ahead
+static float purePursuit(const Path& path, const Vehicle& vehicle, double speed)
+{
+    double lookahead = fmax(3.0, speed * 1.2);
+    double gx, gy;
+    path.point(path.station(vehicle.x, vehicle.y) + lookahead, gx, gy);
+    double dx = gx - vehicle.x;
+    double dy = gy - vehicle.y;
+    double forward = dx * cos(vehicle.heading) + dy * sin(vehicle.heading);
+    double left = -dx * sin(vehicle.heading) + dy * cos(vehicle.heading);
+    double alpha = atan2(left, forward);
+    double steer = -atan(2.0 * Vehicle::WHEELBASE * sin(alpha) / lookahead) * RAD_TO_DEG;
+    return (float)constrain(steer, -35.0, 35.0);
+}
+
+struct Settings {
+    const char* actuator = "valve";
+    const char* path = "line";
+    double speedKmh = 10.0;
+    double offset = 1.0;
+    double duration = 60.0;
+    uint16_t rateHz = 0;
+    uint8_t mode = 0;
+    uint8_t kp = 40;
+    float ki = 0.0f;
+    float kd = 0.0f;
+    float kff = 0.0f;
+    uint8_t minPWM = 40;
+    uint8_t highPWM = 255;
+    bool autoGains = false;
+    double maxXteCm = 0.0;  // 0 = no limit
+    int logLevel = static_cast<int>(EventSeverity::INFO);
+};
+
+struct Timing {
+    uint32_t count = 0;
+    double totalNs = 0.0;
+    double maxNs = 0.0;
+
+    template <typename F>
+    void measure(F&& f)
+    {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        count++;
+        totalNs += ns;
+        if (ns > maxNs) maxNs = ns;
+    }
+    void print(const char* name) const
+    {
+        if (count) printf("%-14s %8u ticks, %7.0f ns mean, %8.0f ns max\n", name, count, totalNs / count, maxNs);
+    }
+};
+
+static void sendSteerSettings(const Settings& settings)
+{
+    // PGN 252: Kp, highPWM, lowPWM, minPWM, counts, WAS offset (int16), Ackerman
+    uint8_t data[8] = {settings.kp, settings.highPWM, 0, settings.minPWM, WAS_COUNTS_PER_DEGREE, 0, 0, 100};
+    PGNProcessor::instance->deliver(252, data, sizeof(data));
+}
+
+static void sendSteerData(double speedKmh, uint8_t status, float steerAngle, double crossTrack)
+{
+    // PGN 254: speed (0.1 km/h), status, steer angle (0.01 deg), XTE, sections
+    uint16_t speed = (uint16_t)lround(speedKmh * 10.0);
+    int16_t angle = (int16_t)lroundf(steerAngle * 100.0f);
+    int8_t xte = (int8_t)constrain(lround(crossTrack * 100.0), -127L, 127L);
+    uint8_t data[8] = {(uint8_t)speed, (uint8_t)(speed >> 8), status, (uint8_t)angle, (uint8_t)(angle >> 8),
+                       (uint8_t)xte, 0, 0};
+    PGNProcessor::instance->deliver(254, data, sizeof(data));
+}
+
+static bool parseArgs(int argc, char** argv, Settings& settings)
+{
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[++i] : nullptr;
+        if (!value) return false;
+        if (!strcmp(arg, "--actuator")) settings.actuator = value;
+        else if (!strcmp(arg, "--path")) settings.path = value;
+        else if (!strcmp(arg, "--speed")) settings.speedKmh = atof(value);
+        else if (!strcmp(arg, "--offset")) settings.offset = atof(value);
+        else if (!strcmp(arg, "--duration")) settings.duration = atof(value);
+        else if (!strcmp(arg, "--rate")) settings.rateHz = atoi(value);
+        else if (!strcmp(arg, "--kp")) settings.kp = atoi(value);
+        else if (!strcmp(arg, "--ki")) settings.ki = atof(value);
+        else if (!strcmp(arg, "--kd")) settings.kd = atof(value);
+        else if (!strcmp(arg, "--kff")) settings.kff = atof(value);
+        else if (!strcmp(arg, "--min")) settings.minPWM = atoi(value);
+        else if (!strcmp(arg, "--high")) settings.highPWM = atoi(value);
+        else if (!strcmp(arg, "--auto-gains")) settings.autoGains = atoi(value) != 0;
+        else if (!strcmp(arg, "--max-xte-cm")) settings.maxXteCm = atof(value);
+        else if (!strcmp(arg, "--log")) simLogLevel = atoi(value);
+        else if (!strcmp(arg, "--log-level")) settings.logLevel = atoi(value);
+        else if (!strcmp(arg, "--mode")) {
+            if (!strcmp(value, "p")) settings.mode = SteerController::P;
+            else if (!strcmp(value, "pid")) settings.mode = SteerController::PID;
+            else if (!strcmp(value, "pidff")) settings.mode = SteerController::PID_FF;
+            else return false;
+        } else {
+            return false;
+        }
+    }
+    return strcmp(settings.path, "line") == 0 || strcmp(settings.path, "curve") == 0 ||
+           strcmp(settings.path, "wave") == 0;
+}
+
+int main(int argc, char** argv)
+{
+    Settings settings;
+    SimActuator* actuator = parseArgs(argc, argv, settings) ? makeActuator(settings.actuator) : nullptr;
+    if (!actuator || settings.duration * 1e6 <= ENGAGE_US + MEASURE_AFTER_US) {
+        fprintf(stderr,
+                "usage: %s [--actuator valve|keya|danfoss] [--path line|curve|wave] [--speed KMH] [--offset M]\n"
+                "          [--duration S > 11] [--rate 0|100..1000] [--mode p|pid|pidff] [--kp N] [--ki N] [--kd N]\n"
+                "          [--kff N] [--min N] [--high N] [--auto-gains 0|1] [--max-xte-cm N] [--log 0..7]\n"
+                "          [--log-level 0..7]\n",
+                argv[0]);
+        return 1;
+    }
+
+    // Bring the firmware up in main.cpp's order
+    configManager.init();
+    configManager.setControlLaneRateHz(settings.rateHz);
+    configManager.setSteerControlMode(settings.mode);
+    configManager.setSteerKi(settings.ki);
+    configManager.setSteerKd(settings.kd);
+    configManager.setSteerKff(settings.kff);
+    configManager.setSteerAutoGains(settings.autoGains);
+    configManager.saveSteerSettings();  // AutosteerProcessor::init() reloads them, as the web page saves them
+    ADProcessor::instance = &adProcessor;
+    adProcessor.init();
+    motorPTR = actuator;
+    motorPTR->init();
+    PGNProcessor::instance = new PGNProcessor();
+    AutosteerProcessor* autosteer = AutosteerProcessor::getInstance();
+    if (!autosteer->init()) {
+        fprintf(stderr, "AutosteerProcessor init failed\n");
+        return 1;
+    }
+    sendSteerSettings(settings);
+
+    // setup() ends by leaving startup mode; printed messages must get past the gate
+    int logLevel = max(settings.logLevel, simLogLevel);
+    EventLogger::getInstance()->setSerialLevel(static_cast<EventSeverity>(constrain(logLevel, 0, 7)));
+    EventLogger::getInstance()->setStartupMode(false);
+
+    Path path = {strcmp(settings.path, "curve") == 0 ? 30.0 : 0.0, strcmp(settings.path, "wave") == 0 ? 1.5 : 0.0};
+    Vehicle vehicle;
+    vehicle.x = -settings.offset;  // Start left of the line
+    double speed = settings.speedKmh / 3.6;
+    uint32_t lanePeriodUs = simLaneTick ? 1000000 / simLaneRateHz : 0;
+
+    actuator->describe();
+    printf("%s path at %.1f km/h, %.2f m offset, %s Kp %u Ki %.1f Kd %.2f Kff %.2f minPWM %u highPWM %u, ",
+           settings.path, settings.speedKmh, settings.offset, SteerController::modeName(settings.mode), settings.kp,
+           settings.ki, settings.kd, settings.kff, settings.minPWM, settings.highPWM);
+    if (lanePeriodUs) printf("control lane %uHz\n\n", simLaneRateHz);
+    else printf("100Hz loop task\n\n");
+
+    Timing processTiming, adTiming, laneTiming;
+    float steerTarget = 0.0f;
+    double lastOutsideUs = -1.0;
+    bool disengaged = false;
+    double sumSqXte = 0.0, maxXte = 0.0, sumSqAngle = 0.0, sumPWM = 0.0, travel = 0.0;
+    uint32_t samples = 0, reversals = 0;
+    int16_t lastSign = 0;
+
+    uint64_t startUs = simMicros;
+    uint64_t endUs = startUs + (uint64_t)(settings.duration * 1e6);
+    auto wallStart = std::chrono::steady_clock::now();
+    for (uint64_t t = 0; simMicros < endUs; t += PHYSICS_STEP_US) {
+        wasCounts = (uint16_t)constrain(lround(2048 + actuator->angle * WAS_COUNTS_PER_DEGREE), 0L, 4095L);
+
+        if (t % PGN254_PERIOD_US == 0) {
+            steerTarget = purePursuit(path, vehicle, speed);
+            uint8_t status = t >= ENGAGE_US ? 0x41 : 0x00;  // Guidance + autosteer (OSB)
+            sendSteerData(settings.speedKmh, status, steerTarget, path.crossTrack(vehicle.x, vehicle.y));
+        }
+        if (t % 1000 == 0) {
+            adTiming.measure([&] { adProcessor.process(); });
+        }
+        if (t % 20000 == 0) {
+            motorPTR->process();
+        }
+        if (t % 10000 == 0) {
+            processTiming.measure([&] { autosteer->process(); });
+        }
+        if (lanePeriodUs && t % lanePeriodUs == 0) {
+            laneTiming.measure([&] { AutosteerProcessor::controlLaneTick(lanePeriodUs / 1e6f); });
+        }
+        if (SCB_AIRCR) {
+            fprintf(stderr, "Firmware requested a reboot at %.3f s\n", t / 1e6);
+            return 1;
+        }
+
+        double before = actuator->angle;
+        actuator->step(PHYSICS_STEP_US / 1e6);
+        vehicle.step(speed, actuator->angle, PHYSICS_STEP_US / 1e6);
+        advanceClock(PHYSICS_STEP_US);
+
+        if (t < ENGAGE_US) continue;
+        double xte = path.crossTrack(vehicle.x, vehicle.y);
+        if (fabs(xte) > 0.10) lastOutsideUs = t;
+        if (t < ENGAGE_US + MEASURE_AFTER_US) continue;
+        if (!actuator->isEnabled()) disengaged = true;
+        samples++;
+        sumSqXte += xte * xte;
+        if (fabs(xte) > maxXte) maxXte = fabs(xte);
+        sumSqAngle += (actuator->angle - steerTarget) * (actuator->angle - steerTarget);
+        sumPWM += abs(actuator->getCommand());
+        travel += fabs(actuator->angle - before);
+        int16_t sign = (actuator->getCommand() > 0) - (actuator->getCommand() < 0);
+        if (sign != 0) {
+            if (lastSign != 0 && sign != lastSign) reversals++;
+            lastSign = sign;
+        }
+    }
+    double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+    double window = samples * PHYSICS_STEP_US / 1e6;
+    double xteRms = sqrt(sumSqXte / samples) * 100.0;
+    char acquire[16];
+    if (lastOutsideUs < (double)(endUs - startUs) - 1e6) snprintf(acquire, sizeof(acquire), "%.1f s", (lastOutsideUs - ENGAGE_US) / 1e6);
+    else snprintf(acquire, sizeof(acquire), "never");
+    printf("Acquire line   %s (within 10 cm)\n", acquire);
+    printf("Cross-track    %6.2f cm RMS, %6.2f cm max\n", xteRms, maxXte * 100.0);
+    printf("Wheel angle    %6.3f deg RMS from the PGN 254 target\n", sqrt(sumSqAngle / samples));
+    printf("Effort         %6.1f mean |PWM|, %.2f reversals/s, %.2f deg/s travel\n", sumPWM / samples,
+           reversals / window, travel / window);
+    ActuatorEstimator::Estimate estimate;
+    autosteer->getActuatorEstimate(estimate);
+    printf("Identified     %.3f deg/s per PWM, %.0f PWM deadband, %.0f ms lag, %.0f%% confidence (%u fitted, %u skipped)%s\n",
+           estimate.gain, estimate.deadband, estimate.lag * 1000.0f, estimate.confidence * 100.0f, estimate.updates,
+           estimate.skipped, estimate.valid ? "" : " - not valid");
+    if (settings.autoGains && estimate.valid) {
+        ActuatorEstimator::ScheduledGains gains =
+            ActuatorEstimator::gainsFor(estimate, ActuatorEstimator::speedBand(settings.speedKmh));
+        printf("Auto gains     Kp %.0f, minPWM %u\n", gains.kp, gains.minPWM);
+    }
+    processTiming.print("Autosteer tick");
+    adTiming.print("ADProcessor");
+    laneTiming.print("Lane tick");
+    printf("Speed-up       %.0fx real time (%.1f s in %.3f s)\n", settings.duration / wallSeconds, settings.duration,
+           wallSeconds);
+
+    if (disengaged) {
+        printf("FAIL: autosteer disengaged during the run\n");
+        return 1;
+    }
+    if (settings.maxXteCm > 0.0 && xteRms > settings.maxXteCm) {
+        printf("FAIL: cross-track RMS %.2f cm over %.2f cm\n", xteRms, settings.maxXteCm);
+        return 1;
+    }
+    return 0;
+}
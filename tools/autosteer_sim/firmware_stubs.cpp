@@ -0,0 +1,218 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+
+// firmware_stubs.cpp
+// The firmware collaborators the autosteer simulator does not model. Each
+// keeps the behaviour AutosteerProcessor relies on with the feature off:
+// no encoder, no VWAS, no web popups, no latency tracing, a fixed pin map.
+// Log calls cost what they do on the Teensy - level gate, rate limit,
+// formatting - but are only printed when the simulator turns on simLogLevel.
+
+#include "EventLogger.h"
+#include "HardwareManager.h"
+#include "LatencyTrace.h"
+#include "MessageBuilder.h"
+#include "EncoderProcessor.h"
+#include "WheelAngleFusion.h"
+#include "MotorDriverManager.h"
+#include "ControlLane.h"
+#include "PGNProcessor.h"
+#include "QNEthernetUDPHandler.h"
+#include "LEDManagerFSM.h"
+#include <EEPROM.h>
+#include <stdarg.h>
+
+// Simulator hooks (autosteer_sim.cpp)
+extern int simLogLevel;
+extern void simLog(const char* severity, const char* source, const char* message);
+ControlLane::TickFunction simLaneTick = nullptr;
+uint16_t simLaneRateHz = 0;
+
+// Teensy core globals
+SimSerial Serial;
+EEPROMClass EEPROM;
+volatile uint32_t SCB_AIRCR = 0;
+
+// Firmware globals normally defined in main.cpp
+LEDManagerFSM ledManagerFSM;
+PGNProcessor* PGNProcessor::instance = nullptr;
+uint32_t QNEthernetUDPHandler::committed = 0;
+uint8_t QNEthernetUDPHandler::slot[320];
+MotorDriverManager* MotorDriverManager::instance = nullptr;
+WheelAngleFusion* wheelAngleFusionPtr = nullptr;
+GNSSProcessor* gnssProcessorPtr = nullptr;
+class IMUProcessor {} imuProcessor;  // Only its address is taken
+
+// AutosteerProcessor.h declares "extern MotorDriverInterface motorDriver" and
+// calls motorDriver.process(); the static type makes that the base class
+// no-op, which optimised builds inline away. Give unoptimised builds a symbol.
+class SimNoMotorDriver : public MotorDriverInterface {
+public:
+    bool init() override { return true; }
+    void enable(bool) override {}
+    void setPWM(int16_t) override {}
+    void stop() override {}
+    MotorStatus getStatus() const override { return MotorStatus{}; }
+    MotorDriverType getType() const override { return MotorDriverType::NONE; }
+    const char* getTypeName() const override { return "None"; }
+    bool hasCurrentSensing() const override { return false; }
+    bool hasPositionFeedback() const override { return false; }
+    bool isDetected() override { return false; }
+    void handleKickout(KickoutType, float) override {}
+    float getCurrentDraw() override { return 0.0f; }
+} motorDriver;
+
+void sendUDPbytes(uint8_t*, int)
+{
+    QNEthernetUDPHandler::committed++;
+}
+
+// EventLogger - the firmware's level gate, rate limit and formatting; the
+// message reaches simLog only up to simLogLevel
+uint8_t EventLogger::activeLevel = static_cast<uint8_t>(EventSeverity::DEBUG);
+
+EventLogger::EventLogger()
+{
+    for (int i = 0; i < 8; i++) {
+        buckets[i].tokens = maxMessagesPerSecond[i];
+        buckets[i].lastRefillTime = millis();
+    }
+}
+EventLogger::~EventLogger() {}
+
+EventLogger* EventLogger::getInstance()
+{
+    static EventLogger logger;
+    return &logger;
+}
+
+void EventLogger::updateActiveLevel()
+{
+    // Same rule as the firmware, so the default config is what ships
+    uint8_t level = config.webLevel;
+    if (config.enableSerial && config.serialLevel > level) {
+        level = config.serialLevel;
+    }
+    if (config.enableUDP && config.udpLevel > level) {
+        level = config.udpLevel;
+    }
+    if (startupMode) {
+        level = static_cast<uint8_t>(EventSeverity::DEBUG);
+    }
+    activeLevel = level;
+}
+
+void EventLogger::setSerialLevel(EventSeverity level)
+{
+    config.serialLevel = static_cast<uint8_t>(level);
+    updateActiveLevel();
+}
+
+void EventLogger::setStartupMode(bool startup)
+{
+    startupMode = startup;
+    updateActiveLevel();
+}
+
+bool EventLogger::checkRateLimit(EventSeverity severity)
+{
+    if (startupMode) {
+        return true;
+    }
+    TokenBucket& bucket = buckets[static_cast<uint8_t>(severity)];
+    uint8_t maxPerSecond = maxMessagesPerSecond[static_cast<uint8_t>(severity)];
+    uint32_t now = millis();
+    uint32_t elapsed = now - bucket.lastRefillTime;
+    if (elapsed > RATE_WINDOW_MS) {
+        bucket.tokens = maxPerSecond;
+        bucket.lastRefillTime = now;
+    } else if (elapsed > 0) {
+        bucket.tokens = min(bucket.tokens + (float)elapsed * maxPerSecond / RATE_WINDOW_MS, (float)maxPerSecond);
+        bucket.lastRefillTime = now;
+    }
+    if (bucket.tokens >= 1.0f) {
+        bucket.tokens -= 1.0f;
+        return true;
+    }
+    return false;
+}
+
+void EventLogger::log(EventSeverity severity, EventSource source, const char* format, ...)
+{
+    if (!checkRateLimit(severity)) {
+        return;
+    }
+    static const char* severityNames[] = {"EMERG", "ALERT", "CRIT", "ERROR", "WARN", "NOTICE", "INFO", "DEBUG"};
+    va_list args;
+    va_start(args, format);
+    vsnprintf(messageBuffer, sizeof(messageBuffer), format, args);
+    va_end(args);
+    eventCounter++;
+    if ((int)severity <= simLogLevel) {
+        simLog(severityNames[(int)severity], sourceNames[(int)source], messageBuffer);
+    }
+}
+
+// HardwareManager - the standard AiO v5 pin map, every request granted
+HardwareManager::HardwareManager() {}
+HardwareManager::~HardwareManager() {}
+
+HardwareManager* HardwareManager::getInstance()
+{
+    static HardwareManager manager;
+    return &manager;
+}
+
+uint8_t HardwareManager::getWASSensorPin() const { return WAS_SENSOR_PIN; }
+uint8_t HardwareManager::getSteerPin() const { return STEER_PIN; }
+uint8_t HardwareManager::getWorkPin() const { return WORK_PIN; }
+uint8_t HardwareManager::getKickoutDPin() const { return KICKOUT_D_PIN; }
+uint8_t HardwareManager::getCurrentPin() const { return CURRENT_PIN; }
+uint8_t HardwareManager::getKickoutAPin() const { return KICKOUT_A_PIN; }
+bool HardwareManager::requestPinOwnership(uint8_t, PinOwner, const char*) { return true; }
+bool HardwareManager::releasePinOwnership(uint8_t, PinOwner) { return true; }
+void HardwareManager::updatePinMode(uint8_t, uint8_t) {}
+bool HardwareManager::requestADCConfig(ADCModule, uint8_t, uint8_t, const char*) { return true; }
+
+// LatencyTrace - stamps come from the virtual cycle counter; nothing reads them
+LatencyTrace* LatencyTrace::getInstance()
+{
+    static LatencyTrace trace;
+    return &trace;
+}
+
+void LatencyTrace::record(Path, uint32_t) {}
+
+void MessageBuilder::sendHardwarePopup(const char*, uint8_t, uint8_t) {}
+
+// No shaft encoder fitted
+EncoderProcessor* encoderProcessor = nullptr;
+EncoderProcessor* EncoderProcessor::getInstance() { return nullptr; }
+void EncoderProcessor::resetPulseCount() {}
+void EncoderProcessor::updateConfig(EncoderType, bool) {}
+
+// VWAS never initialises, so the physical WAS is always used
+WheelAngleFusion::WheelAngleFusion() {}
+bool WheelAngleFusion::init(KeyaCANDriver*, GNSSProcessor*, IMUProcessor*) { return false; }
+bool WheelAngleFusion::isHealthy() const { return false; }
+void WheelAngleFusion::update(float) {}
+
+void MotorDriverManager::updateMotorConfig(uint8_t) {}
+
+// ControlLane - the simulator calls the tick itself at the requested rate
+ControlLane* ControlLane::getInstance()
+{
+    static ControlLane lane;
+    return &lane;
+}
+
+bool ControlLane::start(TickFunction tick, uint16_t rate)
+{
+    simLaneTick = tick;
+    simLaneRateHz = rate;
+    return true;
+}
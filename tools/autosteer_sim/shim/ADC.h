@@ -0,0 +1,35 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+// ADC.h (autosteer_sim shim)
+// Teensy ADC library stand-in: conversions return the simulator's pin values.
+
+#ifndef AUTOSTEER_SIM_ADC_H
+#define AUTOSTEER_SIM_ADC_H
+
+#include <Arduino.h>
+
+enum class ADC_CONVERSION_SPEED { LOW_SPEED, MED_SPEED, HIGH_SPEED, VERY_HIGH_SPEED };
+enum class ADC_SAMPLING_SPEED { LOW_SPEED, MED_SPEED, HIGH_SPEED, VERY_HIGH_SPEED };
+
+class ADC_Module {
+public:
+    void setAveraging(uint8_t) {}
+    void setResolution(uint8_t) {}
+    void setConversionSpeed(ADC_CONVERSION_SPEED) {}
+    void setSamplingSpeed(ADC_SAMPLING_SPEED) {}
+    int analogRead(uint8_t pin) { return ::analogRead(pin); }
+};
+
+class ADC {
+public:
+    ADC_Module* adc0 = &modules[0];
+    ADC_Module* adc1 = &modules[1];
+
+private:
+    ADC_Module modules[2];
+};
+
+#endif // AUTOSTEER_SIM_ADC_H
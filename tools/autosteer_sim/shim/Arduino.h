@@ -0,0 +1,115 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// Arduino.h (autosteer_sim shim)
+// Just enough of the Teensy core for the autosteer modules to build on the
+// host. The clock is virtual and pins read whatever the simulator set.
+
+#ifndef AUTOSTEER_SIM_ARDUINO_H
+#define AUTOSTEER_SIM_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define INPUT_PULLDOWN 3
+#define INPUT_DISABLE 5
+#define RISING 3
+#define FALLING 2
+#define CHANGE 4
+
+#define A12 26
+#define A13 27
+#define A15 39
+#define A17 41
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+#define HEX 16
+#define DEC 10
+
+#define F_CPU_ACTUAL 600000000UL
+extern uint32_t simCycleCounter;
+#define ARM_DWT_CYCCNT simCycleCounter
+
+// Mixed-type min/max as the Teensy core defines them
+template <class A, class B>
+constexpr auto min(A&& a, B&& b) -> decltype(a < b ? a : b) { return a < b ? a : b; }
+template <class A, class B>
+constexpr auto max(A&& a, B&& b) -> decltype(a < b ? a : b) { return a >= b ? a : b; }
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+
+// Reboot register - a write ends the simulation run (see autosteer_sim.cpp)
+extern volatile uint32_t SCB_AIRCR;
+
+template <typename T, typename L, typename H>
+inline T constrain(T amt, L low, H high) { return amt < low ? (T)low : (amt > high ? (T)high : amt); }
+
+// Virtual clock and pins, implemented by the simulator
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+inline uint8_t digitalPinToInterrupt(uint8_t pin) { return pin; }
+inline void attachInterrupt(uint8_t, void (*)(), int) {}
+inline void detachInterrupt(uint8_t) {}
+inline void __disable_irq() {}
+inline void __enable_irq() {}
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+struct SimSerial {
+    template <typename... Args>
+    void printf(const char*, Args...) {}
+    template <typename T>
+    void print(T) {}
+    template <typename T>
+    void println(T) {}
+    void println() {}
+    void flush() {}
+};
+extern SimSerial Serial;
+
+class HardwareSerial {
+public:
+    void begin(uint32_t) {}
+    int available() { return 0; }
+    int availableForWrite() { return 1024; }
+    int read() { return -1; }
+    size_t write(uint8_t) { return 1; }
+    size_t write(const uint8_t*, size_t length) { return length; }
+    void addMemoryForRead(void*, size_t) {}
+    void addMemoryForWrite(void*, size_t) {}
+};
+
+class IntervalTimer {
+public:
+    bool begin(void (*)(), float) { return true; }
+    void end() {}
+    void priority(uint8_t) {}
+};
+
+#endif // AUTOSTEER_SIM_ARDUINO_H
@@ -0,0 +1,40 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+// EEPROM.h (autosteer_sim shim)
+// 4KB of RAM that starts erased (0xFF), like a new Teensy 4.1.
+
+#ifndef AUTOSTEER_SIM_EEPROM_H
+#define AUTOSTEER_SIM_EEPROM_H
+
+#include <Arduino.h>
+
+class EEPROMClass {
+public:
+    EEPROMClass() { memset(data, 0xFF, sizeof(data)); }
+    uint8_t read(int addr) const { return data[addr]; }
+    void write(int addr, uint8_t value) { data[addr] = value; }
+    void update(int addr, uint8_t value) { data[addr] = value; }
+    uint16_t length() const { return sizeof(data); }
+    template <typename T>
+    T& get(int addr, T& value) const
+    {
+        memcpy((void*)&value, data + addr, sizeof(T));
+        return value;
+    }
+    template <typename T>
+    const T& put(int addr, const T& value)
+    {
+        memcpy(data + addr, (const void*)&value, sizeof(T));
+        return value;
+    }
+
+private:
+    uint8_t data[4284];
+};
+
+extern EEPROMClass EEPROM;
+
+#endif // AUTOSTEER_SIM_EEPROM_H
@@ -0,0 +1,20 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+// Encoder.h (autosteer_sim shim)
+
+#ifndef AUTOSTEER_SIM_ENCODER_H
+#define AUTOSTEER_SIM_ENCODER_H
+
+#include <Arduino.h>
+
+class Encoder {
+public:
+    Encoder(uint8_t, uint8_t) {}
+    int32_t read() { return 0; }
+    void write(int32_t) {}
+};
+
+#endif // AUTOSTEER_SIM_ENCODER_H
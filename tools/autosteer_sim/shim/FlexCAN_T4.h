@@ -0,0 +1,44 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+// FlexCAN_T4.h (autosteer_sim shim)
+// Types only - no CAN traffic in the simulator.
+
+#ifndef AUTOSTEER_SIM_FLEXCAN_T4_H
+#define AUTOSTEER_SIM_FLEXCAN_T4_H
+
+#include <Arduino.h>
+
+enum CAN_DEV_TABLE { CAN1, CAN2, CAN3 };
+enum FLEXCAN_RXQUEUE_TABLE { RX_SIZE_2 = 2, RX_SIZE_16 = 16, RX_SIZE_32 = 32, RX_SIZE_256 = 256 };
+enum FLEXCAN_TXQUEUE_TABLE { TX_SIZE_2 = 2, TX_SIZE_16 = 16, TX_SIZE_64 = 64, TX_SIZE_256 = 256 };
+
+typedef struct CAN_message_t {
+    uint32_t id = 0;
+    uint16_t timestamp = 0;
+    uint8_t idhit = 0;
+    struct {
+        bool extended = 0;
+        bool remote = 0;
+        bool overrun = 0;
+        bool reserved = 0;
+    } flags;
+    uint8_t len = 8;
+    uint8_t buf[8] = {0};
+    int8_t mb = 0;
+    uint8_t bus = 0;
+    bool seq = 0;
+} CAN_message_t;
+
+template <CAN_DEV_TABLE _bus, FLEXCAN_RXQUEUE_TABLE _rxSize = RX_SIZE_16, FLEXCAN_TXQUEUE_TABLE _txSize = TX_SIZE_16>
+class FlexCAN_T4 {
+public:
+    void begin() {}
+    void setBaudRate(uint32_t) {}
+    int read(CAN_message_t&) { return 0; }
+    int write(const CAN_message_t&) { return 1; }
+};
+
+#endif // AUTOSTEER_SIM_FLEXCAN_T4_H
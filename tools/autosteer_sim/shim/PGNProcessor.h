@@ -0,0 +1,43 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+// PGNProcessor.h (autosteer_sim shim)
+// Keeps the registered handlers so the simulator can deliver PGN payloads
+// (the bytes after the length, as the real dispatcher does).
+
+#ifndef AUTOSTEER_SIM_PGN_PROCESSOR_H
+#define AUTOSTEER_SIM_PGN_PROCESSOR_H
+
+#include <Arduino.h>
+
+typedef void (*PGNCallback)(uint8_t pgn, const uint8_t* data, size_t len);
+
+class PGNProcessor {
+public:
+    static PGNProcessor* instance;
+
+    bool registerCallback(uint8_t pgn, PGNCallback callback, const char*)
+    {
+        callbacks[pgn] = callback;
+        return true;
+    }
+    bool registerBroadcastCallback(PGNCallback callback, const char*)
+    {
+        broadcast = callback;
+        return true;
+    }
+    uint32_t getRxTraceCycles() const { return 0; }
+
+    void deliver(uint8_t pgn, const uint8_t* data, size_t len)
+    {
+        if (callbacks[pgn]) callbacks[pgn](pgn, data, len);
+    }
+
+private:
+    PGNCallback callbacks[256] = {};
+    PGNCallback broadcast = nullptr;
+};
+
+#endif // AUTOSTEER_SIM_PGN_PROCESSOR_H
@@ -0,0 +1,32 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+// QNEthernetUDPHandler.h (autosteer_sim shim)
+// Outgoing PGNs are built in one slot and counted, not sent.
+
+#ifndef AUTOSTEER_SIM_QNETHERNET_UDP_HANDLER_H
+#define AUTOSTEER_SIM_QNETHERNET_UDP_HANDLER_H
+
+#include <Arduino.h>
+
+class QNEthernetUDPHandler {
+public:
+    static uint8_t* beginPGN(uint8_t source, uint8_t pgn, uint8_t dataLength)
+    {
+        slot[2] = source;
+        slot[3] = pgn;
+        slot[4] = dataLength;
+        return slot + 5;
+    }
+    static void commitPGN() { committed++; }
+    static uint32_t committed;
+
+private:
+    static uint8_t slot[320];
+};
+
+void sendUDPbytes(uint8_t* data, int length);
+
+#endif // AUTOSTEER_SIM_QNETHERNET_UDP_HANDLER_H
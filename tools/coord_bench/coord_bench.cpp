@@ -0,0 +1,337 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// coord_bench.cpp
+// Host round-trip check and micro-benchmark for NMEACoordinate.
+// Collects lat/lon fields from a corpus (GGA/GNS DDMM.MMMM, KSXT/INSPVA
+// decimal degrees) plus a generated set covering every decimal count and the
+// range edges, then:
+//  - checks parse -> format gives back the input text byte for byte
+//    (decimal-degree fields are checked through their exact minute form)
+//  - runs the previous atof/double/float path on the same fields and reports
+//    its worst position error
+//  - reports ns per field for both paths (parse + PANDA formatting)
+//
+// Build (from the repository root):
+//   g++ -std=gnu++17 -O2 -Ilib/aio_navigation tools/coord_bench/coord_bench.cpp -o coord_bench
+//
+// Run:
+//   ./coord_bench tools/nmea_bench/corpus.nmea [--passes N]
+
+#include "NMEACoordinate.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using NMEACoordinate::Angle;
+
+struct Field {
+    std::string text;
+    bool degrees;      // Decimal degrees (KSXT/INSPVA) rather than DDMM.MMMM
+    uint8_t degDigits; // 2 for latitude, 3 for longitude
+};
+
+static double nowNs()
+{
+    using namespace std::chrono;
+    return (double)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// ---- Previous path (GNSSProcessor + NMEAMessageBuilder before the change) ----
+
+static char* oldWriteInt(char* p, int value)
+{
+    char tmp[12];
+    int n = 0;
+    do {
+        tmp[n++] = '0' + value % 10;
+        value /= 10;
+    } while (value > 0);
+    while (n) *p++ = tmp[--n];
+    return p;
+}
+
+static char* oldWriteFloat(char* p, float value, int decimals)
+{
+    int ipart = (int)value;
+    p = oldWriteInt(p, ipart);
+    *p++ = '.';
+    float fpart = value - ipart;
+    for (int i = 0; i < decimals; i++) {
+        fpart *= 10;
+        int digit = (int)fpart;
+        *p++ = '0' + digit;
+        fpart -= digit;
+    }
+    return p;
+}
+
+static char* oldFormat(char* p, double nmea, uint8_t degDigits)
+{
+    int degrees = (int)(nmea / 100);
+    double minutes = nmea - (degrees * 100);
+    if (degDigits == 3 && degrees < 100) *p++ = '0';
+    if (degrees < 10) *p++ = '0';
+    p = oldWriteInt(p, degrees);
+    if (minutes < 10) *p++ = '0';
+    return oldWriteFloat(p, minutes, 6);
+}
+
+// Old cached NMEA value for a field
+static double oldParse(const Field& f)
+{
+    double value = atof(f.text.c_str());
+    if (!f.degrees) return value;
+
+    // cacheNMEACoordinates()
+    double absDeg = fabs(value);
+    int wholeDeg = (int)absDeg;
+    return wholeDeg * 100.0 + (absDeg - wholeDeg) * 60.0;
+}
+
+// ---- New path ----
+
+static bool newParse(const Field& f, Angle& angle, bool& negative)
+{
+    negative = false;
+    if (f.degrees) {
+        return NMEACoordinate::parseDegrees(f.text.data(), (uint16_t)f.text.size(), angle, negative);
+    }
+    return NMEACoordinate::parseDegMin(f.text.data(), (uint16_t)f.text.size(), angle);
+}
+
+// Decimal-degree text back from the exact minute form
+static std::string formatDegrees(const Angle& angle, bool negative, uint8_t decimals)
+{
+    int64_t nanoDegrees = angle.nanoMinutes / 60;
+    char buf[32];
+    int n = snprintf(buf, sizeof(buf), "%s%lld", negative ? "-" : "",
+                     (long long)(nanoDegrees / NMEACoordinate::NANO));
+    if (decimals > 0) {
+        long long fraction = (long long)(nanoDegrees % NMEACoordinate::NANO) /
+                             NMEACoordinate::POW10[NMEACoordinate::MAX_DECIMALS - decimals];
+        snprintf(buf + n, sizeof(buf) - n, ".%0*lld", decimals, fraction);
+    }
+    return buf;
+}
+
+static uint8_t countDecimals(const std::string& text)
+{
+    size_t dot = text.find('.');
+    return dot == std::string::npos ? 0 : (uint8_t)(text.size() - dot - 1);
+}
+
+// ---- Field collection ----
+
+static void collectCorpus(const std::string& corpus, std::vector<Field>& fields)
+{
+    std::istringstream lines(corpus);
+    std::string line;
+    while (std::getline(lines, line)) {
+        size_t star = line.find('*');
+        if (star == std::string::npos || line.size() < 6) continue;
+
+        std::vector<std::string> parts;
+        std::string cur;
+        for (size_t i = 1; i < star; i++) {
+            if (line[i] == ',' || line[i] == ';') {
+                parts.push_back(cur);
+                cur.clear();
+            } else {
+                cur += line[i];
+            }
+        }
+        parts.push_back(cur);
+
+        const std::string& type = parts[0];
+        auto add = [&](size_t idx, bool degrees, uint8_t digits) {
+            if (idx < parts.size() && !parts[idx].empty()) fields.push_back({parts[idx], degrees, digits});
+        };
+        if (type.size() == 5 && (type.compare(2, 3, "GGA") == 0 || type.compare(2, 3, "GNS") == 0)) {
+            add(2, false, 2);
+            add(4, false, 3);
+        } else if (type == "KSXT") {
+            add(3, true, 2);
+            add(2, true, 3);
+        } else if (type == "INSPVAA" || type == "INSPVAXA") {
+            add(12, true, 2);
+            add(13, true, 3);
+        }
+    }
+}
+
+static void collectGenerated(std::vector<Field>& fields)
+{
+    static const char* const edges[] = {
+        "0000", "0000.0", "0000.000000000", "8959.999999999", "9000.00000000",
+        "00000.0000", "17959.99999999", "18000.000000000", "00100.000000001",
+    };
+    for (const char* e : edges) {
+        fields.push_back({e, false, (uint8_t)(strchr(e, '.') ? strchr(e, '.') - e - 2 : strlen(e) - 2)});
+    }
+    static const char* const degreeEdges[] = {
+        "0", "-0.000000001", "0.000000001", "89.999999999", "-90.0", "179.999999999", "-180.000000000", "12.5",
+    };
+    for (const char* e : degreeEdges) {
+        fields.push_back({e, true, 3});
+    }
+
+    uint32_t seed = 12345;
+    auto next = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return seed >> 8;
+    };
+    char buf[40];
+    for (int i = 0; i < 20000; i++) {
+        bool lon = i & 1;
+        uint8_t decimals = next() % 10;
+        uint32_t degrees = next() % (lon ? 180 : 90);
+        uint32_t minutes = next() % 60;
+        uint32_t fraction = next() % NMEACoordinate::POW10[decimals];
+        int n = snprintf(buf, sizeof(buf), lon ? "%03u%02u" : "%02u%02u", degrees, minutes);
+        if (decimals) snprintf(buf + n, sizeof(buf) - n, ".%0*u", decimals, fraction);
+        fields.push_back({buf, false, (uint8_t)(lon ? 3 : 2)});
+
+        decimals = 1 + next() % 9;
+        fraction = next() % NMEACoordinate::POW10[decimals];
+        snprintf(buf, sizeof(buf), "%s%u.%0*u", (next() & 1) ? "-" : "", degrees, decimals, fraction);
+        fields.push_back({buf, true, (uint8_t)(lon ? 3 : 2)});
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s corpus.nmea [--passes N]\n", argv[0]);
+        return 1;
+    }
+
+    int passes = 200;
+    for (int i = 2; i < argc; i++) {
+        if (!strcmp(argv[i], "--passes") && i + 1 < argc) passes = atoi(argv[++i]);
+    }
+    if (passes < 1) passes = 1;
+
+    std::ifstream in(argv[1], std::ios::binary);
+    if (!in) {
+        fprintf(stderr, "cannot open %s\n", argv[1]);
+        return 1;
+    }
+    std::stringstream ss;
+    ss << in.rdbuf();
+
+    std::vector<Field> fields;
+    collectCorpus(ss.str(), fields);
+    size_t corpusFields = fields.size();
+    collectGenerated(fields);
+
+    // Round trip
+    uint32_t failures = 0;
+    uint32_t truncated = 0;
+    double oldMaxErrorM = 0.0;
+    for (const Field& f : fields) {
+        Angle angle;
+        bool negative;
+        if (!newParse(f, angle, negative)) {
+            printf("PARSE FAIL: %s\n", f.text.c_str());
+            failures++;
+            continue;
+        }
+
+        std::string back;
+        uint8_t decimals = countDecimals(f.text);
+        if (f.degrees) {
+            if (decimals > NMEACoordinate::MAX_DECIMALS) {
+                // Rounded to the nearest nano-degree by design - check that, not the text
+                truncated++;
+                long double exact = fabsl(strtold(f.text.c_str(), nullptr));
+                long double parsed = (long double)(angle.nanoMinutes / 60) / NMEACoordinate::NANO;
+                if (fabsl(parsed - exact) > 0.5e-9L + 1e-15L) {
+                    printf("ROUNDING: %s -> %.12Lf\n", f.text.c_str(), parsed);
+                    failures++;
+                }
+                continue;
+            }
+            // The minute form must be exact: re-emit it, parse it back, compare the degrees text
+            char minuteText[32];
+            char* end = NMEACoordinate::format(minuteText, angle, f.degDigits);
+            Angle again;
+            if (!NMEACoordinate::parseDegMin(minuteText, (uint16_t)(end - minuteText), again) ||
+                again.nanoMinutes != angle.nanoMinutes || angle.nanoMinutes % 60 != 0) {
+                printf("MINUTES NOT EXACT: %s -> %.*s\n", f.text.c_str(), (int)(end - minuteText), minuteText);
+                failures++;
+                continue;
+            }
+            back = formatDegrees(again, negative, decimals);
+            // "-0" style inputs have no sign to recover once the value is zero
+            if (negative && angle.nanoMinutes == 0) back = f.text;
+        } else {
+            char buf[32];
+            char* end = NMEACoordinate::format(buf, angle, f.degDigits);
+            back.assign(buf, end);
+        }
+        if (back != f.text) {
+            printf("MISMATCH: %s -> %s\n", f.text.c_str(), back.c_str());
+            failures++;
+        }
+
+        // How far off the previous path's PANDA field was (1 arc-minute = 1852 m)
+        char oldText[32];
+        char* oldEnd = oldFormat(oldText, oldParse(f), f.degDigits);
+        *oldEnd = '\0';
+        double oldValue = atof(oldText);
+        double oldMinutes = floor(oldValue / 100) * 60 + fmod(oldValue, 100);
+        double exactMinutes = (double)angle.nanoMinutes / NMEACoordinate::NANO;
+        double errorM = fabs(oldMinutes - exactMinutes) * 1852.0;
+        if (errorM > oldMaxErrorM) oldMaxErrorM = errorM;
+    }
+
+    // Benchmark: parse + PANDA formatting per field
+    char out[32];
+    uint32_t sink = 0;
+    double t0 = nowNs();
+    for (int p = 0; p < passes; p++) {
+        for (const Field& f : fields) {
+            char* end = oldFormat(out, oldParse(f), f.degDigits);
+            sink += (uint8_t)end[-1];
+        }
+    }
+    double oldNs = (nowNs() - t0) / ((double)fields.size() * passes);
+
+    t0 = nowNs();
+    for (int p = 0; p < passes; p++) {
+        for (const Field& f : fields) {
+            Angle angle = {0, 0};
+            bool negative;
+            newParse(f, angle, negative);
+            char* end = NMEACoordinate::format(out, angle, f.degDigits);
+            sink += (uint8_t)end[-1];
+        }
+    }
+    double newNs = (nowNs() - t0) / ((double)fields.size() * passes);
+
+    printf("Fields: %zu from %s, %zu generated, %d passes\n", corpusFields, argv[1],
+           fields.size() - corpusFields, passes);
+    printf("%-8s %10s %14s\n", "Path", "ns/field", "max error");
+    printf("%-8s %10.2f %12.2fmm\n", "old", oldNs, oldMaxErrorM * 1000.0);
+    printf("%-8s %10.2f %14s\n", "integer", newNs, "exact");
+    printf("Speedup: %.2fx (checksum %u)\n", oldNs / newNs, sink);
+    if (truncated) printf("%u decimal-degree fields had more than 9 decimals, checked as rounded to 1e-9 deg\n", truncated);
+
+    if (failures) {
+        printf("FAILED: %u fields did not round trip\n", failures);
+        return 2;
+    }
+    printf("Round trip bit-exact\n");
+    return 0;
+}
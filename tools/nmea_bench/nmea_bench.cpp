@@ -0,0 +1,232 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// nmea_bench.cpp
+// Host micro-benchmark for the NMEA framing path in GNSSProcessor.
+// Runs the same sentence state machine two ways over a corpus - one char at a
+// time (processNMEAChar) and in UART-sized bursts through NMEAScanner
+// (processNMEAStream) - checks both frame identical sentences, and reports
+// ns/byte for each. Only framing and checksum are measured; field parsing is
+// the same for both paths and left out.
+//
+// Build (from the repository root):
+//   g++ -std=gnu++17 -O2 -Ilib/aio_navigation tools/nmea_bench/nmea_bench.cpp -o nmea_bench
+//
+// Run:
+//   ./nmea_bench tools/nmea_bench/corpus.nmea [--burst N] [--passes N]
+
+#include "NMEAScanner.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+// Mirror of the GNSSProcessor framing state machine
+class Framer {
+public:
+    uint32_t goodSentences = 0;
+    uint32_t badChecksums = 0;
+    uint32_t unicoreSentences = 0;
+    uint32_t overflows = 0;
+    uint32_t contentHash = 2166136261u;  // FNV-1a over every framed sentence
+
+    Framer() { reset(); }
+
+    bool processChar(char c)
+    {
+        switch (state) {
+        case WAIT_START:
+            if (c == '$' || c == '#') {
+                reset();
+                state = READ_DATA;
+                isUnicore = (c == '#');
+                buffer[index++] = c;
+            }
+            break;
+
+        case READ_DATA:
+            if (c == '*') {
+                if (index < sizeof(buffer) - 1) buffer[index++] = c;
+                state = READ_CHECKSUM;
+                received = 0;
+                digits = 0;
+            } else if (c == '\r' || c == '\n') {
+                reset();
+            } else if (index < sizeof(buffer) - 1) {
+                buffer[index++] = c;
+                if (!isUnicore) checksum ^= c;
+            } else if (!overflowed) {
+                overflowed = true;
+                overflows++;
+            }
+            break;
+
+        case READ_CHECKSUM:
+            if (isHexDigit(c)) {
+                if (index < sizeof(buffer) - 1) buffer[index++] = c;
+                received = (received << 4) | hexValue(c);
+                digits++;
+                if (digits == (isUnicore ? 8 : 2)) {
+                    return complete();
+                }
+            }
+            break;
+        }
+        return false;
+    }
+
+    uint16_t processStream(const char* data, uint16_t length)
+    {
+        uint16_t processed = 0;
+        uint16_t i = 0;
+        while (i < length) {
+            if (state == WAIT_START) {
+                i += NMEAScanner::findStart(data + i, length - i);
+                if (i >= length) break;
+            } else if (state == READ_DATA) {
+                uint8_t runChecksum = 0;
+                uint16_t run = NMEAScanner::scanBody(data + i, length - i, runChecksum);
+                uint16_t room = sizeof(buffer) - 1 - index;
+                uint16_t copy = run < room ? run : room;
+                memcpy(buffer + index, data + i, copy);
+                index += copy;
+                if (copy < run) {
+                    runChecksum = NMEAScanner::xorBlock(data + i, copy);
+                    if (!overflowed) {
+                        overflowed = true;
+                        overflows++;
+                    }
+                }
+                if (!isUnicore) checksum ^= runChecksum;
+                i += run;
+                if (i >= length) break;
+            }
+            if (processChar(data[i])) processed++;
+            i++;
+        }
+        return processed;
+    }
+
+private:
+    enum State { WAIT_START, READ_DATA, READ_CHECKSUM };
+
+    char buffer[300];
+    uint16_t index;
+    State state;
+    uint8_t checksum;
+    uint32_t received;
+    uint8_t digits;
+    bool isUnicore;
+    bool overflowed;
+
+    static bool isHexDigit(char c) { return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'F') || (c >= 'a' && c <= 'f'); }
+    static uint8_t hexValue(char c) { return c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10; }
+
+    void reset()
+    {
+        index = 0;
+        state = WAIT_START;
+        checksum = 0;
+        digits = 0;
+        isUnicore = false;
+        overflowed = false;
+        memset(buffer, 0, sizeof(buffer));
+    }
+
+    bool complete()
+    {
+        bool ok = isUnicore || checksum == (uint8_t)received;
+        if (ok) {
+            for (uint16_t i = 0; i < index; i++) {
+                contentHash = (contentHash ^ (uint8_t)buffer[i]) * 16777619u;
+            }
+            if (isUnicore) unicoreSentences++;
+            else goodSentences++;
+        } else {
+            badChecksums++;
+        }
+        reset();
+        return ok;
+    }
+};
+
+static double nowNs()
+{
+    using namespace std::chrono;
+    return (double)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s corpus.nmea [--burst N] [--passes N]\n", argv[0]);
+        return 1;
+    }
+
+    int burst = 64;
+    int passes = 200;
+    for (int i = 2; i < argc; i++) {
+        if (!strcmp(argv[i], "--burst") && i + 1 < argc) burst = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--passes") && i + 1 < argc) passes = atoi(argv[++i]);
+    }
+    if (burst < 1) burst = 1;
+    if (burst > 65535) burst = 65535;
+
+    std::ifstream in(argv[1], std::ios::binary);
+    if (!in) {
+        fprintf(stderr, "cannot open %s\n", argv[1]);
+        return 1;
+    }
+    std::stringstream ss;
+    ss << in.rdbuf();
+    const std::string corpus = ss.str();
+    const size_t size = corpus.size();
+
+    // Per-char path
+    Framer byChar;
+    double t0 = nowNs();
+    for (int p = 0; p < passes; p++) {
+        for (size_t i = 0; i < size; i++) {
+            byChar.processChar(corpus[i]);
+        }
+    }
+    double charNs = (nowNs() - t0) / ((double)size * passes);
+
+    // Burst path, chunked like taskGPS1Serial()
+    Framer byStream;
+    t0 = nowNs();
+    for (int p = 0; p < passes; p++) {
+        for (size_t i = 0; i < size; i += burst) {
+            size_t n = size - i < (size_t)burst ? size - i : (size_t)burst;
+            byStream.processStream(corpus.data() + i, (uint16_t)n);
+        }
+    }
+    double streamNs = (nowNs() - t0) / ((double)size * passes);
+
+    printf("Corpus: %s, %zu bytes, %d passes, burst %d\n", argv[1], size, passes, burst);
+    printf("%-8s %8s %8s %8s %8s %10s\n", "Path", "NMEA", "Unicore", "BadCRC", "Ovfl", "ns/byte");
+    printf("%-8s %8u %8u %8u %8u %10.2f\n", "char", byChar.goodSentences / passes, byChar.unicoreSentences / passes,
+           byChar.badChecksums / passes, byChar.overflows / passes, charNs);
+    printf("%-8s %8u %8u %8u %8u %10.2f\n", "stream", byStream.goodSentences / passes, byStream.unicoreSentences / passes,
+           byStream.badChecksums / passes, byStream.overflows / passes, streamNs);
+    printf("Speedup: %.2fx\n", charNs / streamNs);
+
+    bool match = byChar.goodSentences == byStream.goodSentences &&
+                 byChar.unicoreSentences == byStream.unicoreSentences &&
+                 byChar.badChecksums == byStream.badChecksums &&
+                 byChar.overflows == byStream.overflows &&
+                 byChar.contentHash == byStream.contentHash;
+    if (!match) {
+        printf("MISMATCH: burst path framed different sentences\n");
+        return 2;
+    }
+    printf("Framing identical\n");
+    return 0;
+}
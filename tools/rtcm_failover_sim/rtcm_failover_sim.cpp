@@ -0,0 +1,235 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+
+// rtcm_failover_sim.cpp
+// Host check of the RTCM source failover in RTCMArbiter. Two base stations
+// send 1 Hz epochs of four MSM4 frames (built as on the wire, so the epoch
+// ends are found by RTCM3::endsEpoch) plus a 1005 every fifth epoch, offset
+// from each other so the primary's loss is noticed part way through the
+// standby's epoch. Each scenario records the frames that reach GPS1 and
+// checks:
+//   - no epoch on GPS1 holds frames from both sources, and every epoch the
+//     new primary forwards is complete (the handover waits for its next
+//     epoch start)
+//   - the switch happens (or not) as expected, and how many epochs GPS1
+//     went without after the primary's last complete one
+// Scenarios: primary stops mid-epoch, primary's epochs arrive late but
+// within the margin, primary drops a frame per epoch, standby sends no
+// observation messages. Exits 1 if any check fails.
+//
+// Build (from the repository root):
+//   g++ -std=gnu++17 -O2 -Ilib/aio_system tools/rtcm_failover_sim/rtcm_failover_sim.cpp -o rtcm_failover_sim
+//
+// Run:
+//   ./rtcm_failover_sim
+
+#include "RTCM3Framer.h"
+#include "RTCMArbiter.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+static constexpr uint32_t EPOCH_MS = 1000;
+static constexpr uint8_t FRAMES_PER_EPOCH = 4;
+static constexpr uint32_t FRAME_SPACING_MS = 40;
+static constexpr uint32_t RUN_MS = 30000;
+static const uint16_t MSM_TYPES[FRAMES_PER_EPOCH] = {1074, 1084, 1094, 1124};
+
+struct Frame {
+    uint8_t data[3 + 20 + 3];
+    uint16_t length;
+};
+
+static void putBits(uint8_t* payload, uint16_t bit, uint8_t count, uint32_t value)
+{
+    for (uint8_t i = 0; i < count; i++) {
+        uint16_t b = bit + i;
+        if (value & (1UL << (count - 1 - i))) payload[b / 8] |= 0x80 >> (b % 8);
+    }
+}
+
+// Message type, station 0, 30-bit epoch time and the MSM multiple message
+// bit - all RTCMArbiter needs from an observation message
+static Frame makeFrame(uint16_t type, uint32_t epochTime, bool more)
+{
+    Frame frame = {};
+    uint8_t* payload = frame.data + RTCM3::HEADER_SIZE;
+    uint16_t payloadLength = 20;
+    putBits(payload, 0, 12, type);
+    putBits(payload, 24, 30, epochTime);
+    putBits(payload, 54, 1, more ? 1 : 0);
+    frame.data[0] = RTCM3::PREAMBLE;
+    frame.data[2] = payloadLength;
+    uint32_t crc = RTCM3::crc24q(frame.data, RTCM3::HEADER_SIZE + payloadLength);
+    frame.length = RTCM3::HEADER_SIZE + payloadLength + RTCM3::CRC_SIZE;
+    frame.data[frame.length - 3] = crc >> 16;
+    frame.data[frame.length - 2] = crc >> 8;
+    frame.data[frame.length - 1] = crc;
+    return frame;
+}
+
+// One base station's stream: epoch e's frame k goes out at
+// e * EPOCH_MS + offset + k * FRAME_SPACING_MS, unless the scenario drops it
+struct Station {
+    uint32_t offsetMs;
+    bool observations;                  // false = only 1005, every 200 ms
+    uint32_t stopMs;                    // Nothing from here on, 0 = never
+    uint32_t lateEpoch;                 // This epoch arrives lateMs late, 0 = none
+    uint32_t lateMs;
+    int8_t dropFrame;                   // Frame index lost (bad CRC) every epoch, -1 = none
+    uint32_t dropFromEpoch;
+};
+
+struct Delivered {
+    uint8_t source;
+    uint32_t epoch;
+    uint8_t frame;   // Index in the epoch, 0xFF = 1005
+    uint32_t millis;
+};
+
+struct Scenario {
+    const char* name;
+    Station stations[RTCMArbiter::SOURCE_COUNT];
+    bool expectSwitch;
+};
+
+struct Result {
+    bool ok;
+    char detail[160];
+};
+
+static Result run(const Scenario& scenario)
+{
+    RTCMArbiter arbiter;
+    std::vector<Delivered> gps1;
+    uint32_t errors[RTCMArbiter::SOURCE_COUNT] = {};
+    uint32_t pendingAt = 0;
+
+    for (uint32_t now = 1; now < RUN_MS; now++) {
+        for (uint8_t source = 0; source < RTCMArbiter::SOURCE_COUNT; source++) {
+            const Station& st = scenario.stations[source];
+            if (st.stopMs && now >= st.stopMs) continue;
+
+            uint32_t epoch = now / EPOCH_MS;
+            uint32_t at = now % EPOCH_MS;
+            uint32_t late = (epoch == st.lateEpoch && st.lateEpoch) ? st.lateMs : 0;
+            if (!st.observations) {
+                if (now % 200 == st.offsetMs % 200) {
+                    Frame f = makeFrame(1005, 0, false);
+                    bool fwd = arbiter.frame(source, RTCM3::endsEpoch(f.data, f.length), errors[source], now);
+                    if (fwd) gps1.push_back({source, epoch, 0xFF, now});
+                }
+                continue;
+            }
+            for (uint8_t k = 0; k < FRAMES_PER_EPOCH; k++) {
+                if (at != st.offsetMs + late + k * FRAME_SPACING_MS) continue;
+                if (st.dropFrame == k && epoch >= st.dropFromEpoch) {
+                    errors[source]++;  // The framer rejects it
+                    continue;
+                }
+                Frame f = makeFrame(MSM_TYPES[k], epoch * EPOCH_MS, k + 1 < FRAMES_PER_EPOCH);
+                bool fwd = arbiter.frame(source, RTCM3::endsEpoch(f.data, f.length), errors[source], now);
+                if (fwd) gps1.push_back({source, epoch, k, now});
+            }
+            if (epoch % 5 == 0 && at == st.offsetMs + late + FRAMES_PER_EPOCH * FRAME_SPACING_MS) {
+                Frame f = makeFrame(1005, 0, false);
+                bool fwd = arbiter.frame(source, RTCM3::endsEpoch(f.data, f.length), errors[source], now);
+                if (fwd) gps1.push_back({source, epoch, 0xFF, now});
+            }
+        }
+        arbiter.poll(now);  // Main loop
+        if (!pendingAt && arbiter.getPendingPrimary() >= 0) pendingAt = now;
+    }
+
+    Result r = {true, ""};
+    bool switched = arbiter.getSwitchCount() > 0;
+    if (switched != scenario.expectSwitch) {
+        r.ok = false;
+        snprintf(r.detail, sizeof(r.detail), "%s", switched ? "switched unexpectedly" : "never switched");
+        return r;
+    }
+    if (!switched) {
+        snprintf(r.detail, sizeof(r.detail), "stayed on source %d, %zu frames to GPS1", arbiter.getPrimary(),
+                 gps1.size());
+        return r;
+    }
+
+    // Walk GPS1's observation frames: after the switch every epoch must run
+    // 0..3 from the new source, and no epoch may mix sources
+    uint8_t newSource = arbiter.getPrimary();
+    uint32_t lastOldEpoch = 0, firstNewEpoch = 0, firstNewMillis = 0;
+    bool oldComplete[64] = {};
+    int expectNext = -1;
+    for (const Delivered& d : gps1) {
+        if (d.frame == 0xFF) continue;
+        if (d.source != newSource) {
+            if (firstNewMillis) {
+                r.ok = false;
+                snprintf(r.detail, sizeof(r.detail), "old source frame after the switch at %u ms", d.millis);
+                return r;
+            }
+            if (d.frame == FRAMES_PER_EPOCH - 1 && d.epoch < 64) oldComplete[d.epoch] = true;
+            continue;
+        }
+        if (!firstNewMillis) {
+            firstNewMillis = d.millis;
+            firstNewEpoch = d.epoch;
+            if (d.frame != 0) {
+                r.ok = false;
+                snprintf(r.detail, sizeof(r.detail), "handover mid-epoch: new source starts at frame %u of epoch %u",
+                         d.frame, d.epoch);
+                return r;
+            }
+        }
+        if (expectNext >= 0 && d.frame != expectNext) {
+            r.ok = false;
+            snprintf(r.detail, sizeof(r.detail), "epoch %u from the new source incomplete", d.epoch);
+            return r;
+        }
+        expectNext = (d.frame + 1) % FRAMES_PER_EPOCH;
+    }
+    for (uint32_t e = 0; e < 64; e++) {
+        if (oldComplete[e]) lastOldEpoch = e;
+    }
+    if (!firstNewMillis) {
+        // No epochs to align to - it takes over a quiet timeout after being picked
+        snprintf(r.detail, sizeof(r.detail), "%s; noticed %u ms, handover %u ms without epochs",
+                 arbiter.getLastSwitchReason(), pendingAt, arbiter.getLastSwitchMillis());
+        return r;
+    }
+    int missed = (int)firstNewEpoch - (int)lastOldEpoch - 1;
+    snprintf(r.detail, sizeof(r.detail),
+             "%s; noticed %u ms, handover %u ms (epoch %u), GPS1 missed %d epoch%s",
+             arbiter.getLastSwitchReason(), pendingAt, arbiter.getLastSwitchMillis(), firstNewEpoch, missed, missed == 1 ? "" : "s");
+    return r;
+}
+
+int main()
+{
+    //                 offset obs   stop   late    drop
+    static const Scenario scenarios[] = {
+        {"primary stops mid-epoch",
+         {{50, true, 10070, 0, 0, -1, 0}, {250, true, 0, 0, 0, -1, 0}}, true},
+        {"standby epoch ends inside margin",
+         {{50, true, 10070, 0, 0, -1, 0}, {60, true, 0, 0, 0, -1, 0}}, true},
+        {"primary late within margin",
+         {{50, true, 0, 12, 90, -1, 0}, {150, true, 0, 0, 0, -1, 0}}, false},
+        {"primary drops a frame per epoch",
+         {{50, true, 0, 0, 0, 2, 12}, {150, true, 0, 0, 0, -1, 0}}, true},
+        {"standby without observations",
+         {{50, true, 10070, 0, 0, -1, 0}, {130, false, 0, 0, 0, -1, 0}}, true},
+    };
+
+    bool ok = true;
+    for (const Scenario& scenario : scenarios) {
+        Result r = run(scenario);
+        printf("%-4s %-34s %s\n", r.ok ? "ok" : "FAIL", scenario.name, r.detail);
+        ok &= r.ok;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,200 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// rtcm_framer_test.cpp
+// Host check of RTCM3::Framer and its CRC-24Q table:
+//   - the 1005 example frame from the RTCM 10403 standard (which has a 0xD3
+//     inside its payload) passes its CRC and comes out whole
+//   - a 3000-frame stream mixed with corrupted frames, false preambles,
+//     preambles with non-zero reserved bits and noise gives exactly the
+//     valid frames, in order, with the same counters at every feed size
+//     from 1 byte to the whole stream, and every byte is accounted for as
+//     framed, skipped or pending
+// Stream frames carry a CRC from a bit-by-bit CRC-24Q, so the framer's
+// lookup table is checked against an independent implementation. Exits 1
+// if any check fails.
+//
+// Build (from the repository root):
+//   g++ -std=gnu++17 -O2 -Ilib/aio_system tools/rtcm_framer_test/rtcm_framer_test.cpp -o rtcm_framer_test
+//
+// Run:
+//   ./rtcm_framer_test
+
+#include "RTCM3Framer.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+typedef std::vector<uint8_t> Bytes;
+
+static constexpr int STREAM_FRAMES = 3000;
+
+// RTCM 10403, message 1005 example
+static const uint8_t EXAMPLE_1005[] = {
+    0xD3, 0x00, 0x13, 0x3E, 0xD7, 0xD3, 0x02, 0x02, 0x98, 0x0E, 0xDE, 0xEF, 0x34,
+    0xB4, 0xBD, 0x62, 0xAC, 0x09, 0x41, 0x98, 0x6F, 0x33, 0x36, 0x0B, 0x98};
+
+// Deterministic, so a failure reproduces
+static uint32_t rngState = 12345;
+static uint32_t next()
+{
+    rngState = rngState * 1664525u + 1013904223u;
+    return rngState >> 8;
+}
+
+static uint32_t bitwiseCRC24Q(const uint8_t* data, size_t length)
+{
+    uint32_t crc = 0;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= (uint32_t)data[i] << 16;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc <<= 1;
+            if (crc & 0x1000000) crc ^= 0x1864CFB;
+        }
+    }
+    return crc & 0xFFFFFF;
+}
+
+static Bytes makeFrame(uint16_t type, uint16_t payloadLength)
+{
+    Bytes frame(RTCM3::HEADER_SIZE + payloadLength + RTCM3::CRC_SIZE);
+    frame[0] = RTCM3::PREAMBLE;
+    frame[1] = payloadLength >> 8;
+    frame[2] = payloadLength & 0xFF;
+    for (uint16_t i = 0; i < payloadLength; i++) frame[3 + i] = next();
+    if (payloadLength >= 2) {
+        frame[3] = type >> 4;
+        frame[4] = (frame[4] & 0x0F) | ((type & 0x0F) << 4);
+    }
+    uint16_t crcAt = RTCM3::HEADER_SIZE + payloadLength;
+    uint32_t crc = bitwiseCRC24Q(frame.data(), crcAt);
+    frame[crcAt] = crc >> 16;
+    frame[crcAt + 1] = crc >> 8;
+    frame[crcAt + 2] = crc;
+    return frame;
+}
+
+struct Stream {
+    Bytes data;
+    std::vector<Bytes> frames;  // The valid frames, in order
+    int corrupted = 0;
+    int falsePreambles = 0;
+};
+
+static Stream makeStream()
+{
+    static const uint16_t TYPES[] = {1005, 1033, 1074, 1084, 1094, 1124, 1230};
+    Stream stream;
+    for (int i = 0; i < STREAM_FRAMES; i++) {
+        uint16_t length = next() % 8 == 0 ? next() % (RTCM3::MAX_PAYLOAD + 1) : next() % 300;
+        Bytes frame = makeFrame(TYPES[next() % 7], length);
+        switch (next() % 10) {
+            case 0: {  // Corrupt one byte after the header - the CRC must catch it
+                Bytes bad = frame;
+                bad[RTCM3::HEADER_SIZE + next() % (bad.size() - RTCM3::HEADER_SIZE)] ^= 1 + next() % 255;
+                stream.data.insert(stream.data.end(), bad.begin(), bad.end());
+                stream.corrupted++;
+                break;
+            }
+            case 1:  // Cut short - the rest of the declared length is the next frame
+                stream.data.insert(stream.data.end(), frame.begin(), frame.begin() + 1 + next() % (frame.size() - 1));
+                stream.corrupted++;
+                break;
+            case 2: {  // False preamble, with valid-looking or non-zero reserved bits
+                stream.data.push_back(RTCM3::PREAMBLE);
+                stream.data.push_back(next() % 2 ? next() & 0x03 : 0x04 | (next() & 0xFC));
+                stream.falsePreambles++;
+                break;
+            }
+            case 3:  // Noise between frames
+                for (uint32_t n = next() % 40; n > 0; n--) stream.data.push_back(next());
+                break;
+        }
+        stream.data.insert(stream.data.end(), frame.begin(), frame.end());
+        stream.frames.push_back(frame);
+    }
+    return stream;
+}
+
+struct Run {
+    std::vector<Bytes> frames;
+    uint32_t validFrames, badCRC, badLength, skippedBytes;
+    uint16_t pending;
+};
+
+static Run feed(const Bytes& data, size_t chunk)
+{
+    RTCM3::Framer framer;
+    Run run;
+    for (size_t at = 0; at < data.size(); at += chunk) {
+        size_t length = data.size() - at < chunk ? data.size() - at : chunk;
+        framer.feed(data.data() + at, length, [&](const uint8_t* frame, uint16_t frameLength) {
+            run.frames.push_back(Bytes(frame, frame + frameLength));
+        });
+    }
+    run.validFrames = framer.validFrames;
+    run.badCRC = framer.badCRC;
+    run.badLength = framer.badLength;
+    run.skippedBytes = framer.skippedBytes;
+    run.pending = framer.pending();
+    return run;
+}
+
+static bool checkExample()
+{
+    bool ok = true;
+    uint32_t crc = RTCM3::crc24q(EXAMPLE_1005, sizeof(EXAMPLE_1005) - RTCM3::CRC_SIZE);
+    if (crc != 0x360B98 || bitwiseCRC24Q(EXAMPLE_1005, sizeof(EXAMPLE_1005) - RTCM3::CRC_SIZE) != crc) {
+        printf("FAIL 1005 example CRC %06X, expected 360B98\n", (unsigned)crc);
+        ok = false;
+    }
+
+    Bytes data(EXAMPLE_1005, EXAMPLE_1005 + sizeof(EXAMPLE_1005));
+    Run run = feed(data, data.size());
+    if (run.frames.size() != 1 || run.frames[0] != data || run.skippedBytes != 0 || run.pending != 0 ||
+        RTCM3::messageType(run.frames[0].data(), run.frames[0].size()) != 1005 ||
+        RTCM3::endsEpoch(run.frames[0].data(), run.frames[0].size())) {
+        printf("FAIL 1005 example: %zu frames, %u skipped, %u pending\n",
+               run.frames.size(), (unsigned)run.skippedBytes, (unsigned)run.pending);
+        ok = false;
+    }
+    if (ok) printf("ok   1005 example frame (CRC 360B98)\n");
+    return ok;
+}
+
+static bool checkStream()
+{
+    Stream stream = makeStream();
+    size_t frameBytes = 0;
+    for (const Bytes& frame : stream.frames) frameBytes += frame.size();
+    printf("     stream: %zu bytes, %zu frames, %d corrupted or cut short, %d false preambles\n",
+           stream.data.size(), stream.frames.size(), stream.corrupted, stream.falsePreambles);
+
+    static const size_t CHUNKS[] = {1, 2, 3, 7, 64, 512, 1472, 4096, 0};
+    Run whole = feed(stream.data, stream.data.size());
+    bool ok = true;
+    for (size_t chunk : CHUNKS) {
+        if (chunk == 0) chunk = stream.data.size();
+        Run run = feed(stream.data, chunk);
+        bool same = run.frames == stream.frames && run.validFrames == stream.frames.size() &&
+                    run.badCRC == whole.badCRC && run.badLength == whole.badLength &&
+                    run.skippedBytes == whole.skippedBytes && run.pending == whole.pending &&
+                    frameBytes + run.skippedBytes + run.pending == stream.data.size();
+        printf("%-4s feed %7zu bytes: %5zu frames, %4u bad CRC, %4u bad length, %6u skipped, %u pending\n",
+               same ? "ok" : "FAIL", chunk, run.frames.size(), (unsigned)run.badCRC, (unsigned)run.badLength,
+               (unsigned)run.skippedBytes, (unsigned)run.pending);
+        ok &= same;
+    }
+    return ok;
+}
+
+int main()
+{
+    bool ok = checkExample();
+    ok &= checkStream();
+    return ok ? 0 : 1;
+}
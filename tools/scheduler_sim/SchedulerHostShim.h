@@ -0,0 +1,42 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// SchedulerHostShim.h
+// Stand-in for Arduino.h when SimpleScheduler is built on the host with
+// -D SCHEDULER_HOST_SIM. The clock is virtual: millis()/micros() only move
+// when the simulator advances them.
+
+#ifndef SCHEDULER_HOST_SHIM_H
+#define SCHEDULER_HOST_SHIM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+// Virtual clock, implemented by the simulator
+uint32_t millis();
+uint32_t micros();
+
+// Called from SimpleScheduler::idle() in place of WFI - advances the virtual
+// clock to the next interrupt (SysTick or a simulated event)
+void schedulerSimWaitForInterrupt();
+
+// Single core, no interrupts on the host
+inline void __disable_irq() {}
+inline void __enable_irq() {}
+
+// Enough of Serial for printStatus()/printStats()
+struct SchedulerSimSerial {
+    template <typename... Args>
+    void printf(const char* format, Args... args) { ::printf(format, args...); }
+    void printf(const char* text) { fputs(text, stdout); }
+    void println(const char* text = "") { puts(text); }
+    void print(const char* text) { fputs(text, stdout); }
+};
+extern SchedulerSimSerial Serial;
+
+#endif // SCHEDULER_HOST_SHIM_H
@@ -0,0 +1,434 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// scheduler_sim.cpp
+// Host-side virtual-clock simulator for SimpleScheduler task sets.
+// Runs the real SimpleScheduler code against a virtual clock; each simulated
+// task "runs" by advancing the clock by a cost drawn from its distribution.
+//
+// Build (from the repository root):
+//   g++ -std=gnu++17 -O2 -DSCHEDULER_HOST_SIM -DSCHEDULER_TIMING_STATS -Itools/scheduler_sim -Ilib/aio_system/SimpleScheduler tools/scheduler_sim/scheduler_sim.cpp lib/aio_system/SimpleScheduler/SimpleScheduler.cpp -o scheduler_sim
+//
+// Run:
+//   ./scheduler_sim tools/scheduler_sim/main_taskset.txt [--hours H] [--seed N] [--no-idle] [--loop-us US]
+
+#include "SimpleScheduler.h"
+
+#include <stdlib.h>
+#include <math.h>
+#include <random>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <array>
+#include <utility>
+
+SchedulerSimSerial Serial;
+
+// ============================================
+// Virtual clock
+// ============================================
+static uint64_t simNowUs = 0;
+static uint64_t nextEventArrivalUs = UINT64_MAX;  // Earliest pending simulated notify
+static uint64_t idleTimeUs = 0;
+
+uint32_t micros() { return (uint32_t)simNowUs; }
+uint32_t millis() { return (uint32_t)(simNowUs / 1000); }
+
+void schedulerSimWaitForInterrupt() {
+    // The 1ms SysTick always wakes the core; a simulated RX/timer event may come sooner
+    uint64_t wake = (simNowUs / 1000 + 1) * 1000;
+    if (nextEventArrivalUs < wake) {
+        wake = nextEventArrivalUs;
+    }
+    idleTimeUs += wake - simNowUs;
+    simNowUs = wake;
+}
+
+// ============================================
+// Task set
+// ============================================
+enum class SimKind { GROUP, TIMED, EVENT };
+
+struct CostModel {
+    enum { FIXED, UNIFORM, HIST } type = FIXED;
+    uint32_t a = 0;                 // fixed value / uniform min / hist max
+    uint32_t b = 0;                 // uniform max
+    uint32_t hist[SimpleScheduler::HIST_BUCKETS] = {};
+    uint64_t histTotal = 0;
+};
+
+struct SimTask {
+    SimKind kind;
+    std::string name;
+    uint8_t group = 0;              // SimpleScheduler group index (GROUP only)
+    uint32_t period = 0;            // us, nominal period (0 = aperiodic)
+    uint32_t phase = 0;             // us (TIMED only)
+    uint8_t priority = SimpleScheduler::PRIORITY_NORMAL;
+    uint32_t budget = 0;            // us (TIMED only)
+    uint32_t maxIdleMs = 0;         // EVENT only
+    double ratePerSec = 0;          // EVENT only - Poisson notify arrivals
+    int8_t eventId = -1;
+    uint64_t nextArrival = UINT64_MAX;
+    CostModel cost;
+
+    // Simulator-side results
+    uint64_t runs = 0;
+    uint64_t busyUs = 0;
+    uint64_t misses = 0;            // Start lateness + cost exceeded the period
+    uint64_t skipped = 0;           // Whole releases never started
+    uint64_t lastStart = 0;
+    uint64_t lastRelease = 0;
+    bool started = false;
+};
+
+static std::vector<SimTask> tasks;
+static std::mt19937_64 rng(1);
+
+static uint32_t sampleCost(const CostModel& cost) {
+    switch (cost.type) {
+        case CostModel::FIXED:
+            return cost.a;
+        case CostModel::UNIFORM:
+            return std::uniform_int_distribution<uint32_t>(cost.a, cost.b)(rng);
+        case CostModel::HIST: {
+            if (cost.histTotal == 0) {
+                return 0;
+            }
+            uint64_t pick = std::uniform_int_distribution<uint64_t>(0, cost.histTotal - 1)(rng);
+            uint8_t bucket = 0;
+            while (pick >= cost.hist[bucket]) {
+                pick -= cost.hist[bucket];
+                bucket++;
+            }
+            // Uniform within the bucket, capped at the recorded max
+            uint32_t lo = (bucket == 0) ? 0 : (1UL << bucket);
+            uint32_t hi = (bucket == SimpleScheduler::HIST_BUCKETS - 1) ? cost.a : ((2UL << bucket) - 1);
+            if (cost.a > 0 && hi > cost.a) hi = cost.a;
+            if (lo > hi) lo = hi;
+            return std::uniform_int_distribution<uint32_t>(lo, hi)(rng);
+        }
+    }
+    return 0;
+}
+
+static void runSimTask(size_t index) {
+    SimTask& task = tasks[index];
+    uint64_t start = simNowUs;
+    uint32_t cost = sampleCost(task.cost);
+
+    // Deadline accounting against the task's nominal release times
+    if (task.period > 0) {
+        uint64_t lateness = 0;
+        if (task.kind == SimKind::TIMED) {
+            uint64_t release = (start >= task.phase)
+                ? task.phase + ((start - task.phase) / task.period) * task.period
+                : task.phase;
+            lateness = start - release;
+            if (task.started && release > task.lastRelease) {
+                task.skipped += (release - task.lastRelease) / task.period - 1;
+            }
+            task.lastRelease = release;
+        } else if (task.started && start - task.lastStart > task.period) {
+            // Groups re-arm from their last run, so lateness is the stretched gap
+            lateness = start - task.lastStart - task.period;
+        }
+        if (lateness + cost > task.period) {
+            task.misses++;
+        }
+    }
+
+    task.started = true;
+    task.lastStart = start;
+    task.runs++;
+    task.busyUs += cost;
+    simNowUs += cost;
+}
+
+// One trampoline per task slot, since TaskFunction takes no context
+template <size_t N>
+static void trampoline() { runSimTask(N); }
+
+template <size_t... I>
+static constexpr std::array<SimpleScheduler::TaskFunction, sizeof...(I)> makeTrampolines(std::index_sequence<I...>) {
+    return {{ &trampoline<I>... }};
+}
+
+static constexpr size_t MAX_SIM_TASKS = 64;
+static const auto trampolines = makeTrampolines(std::make_index_sequence<MAX_SIM_TASKS>{});
+
+// ============================================
+// Task set parsing
+// ============================================
+static bool parseGroup(const std::string& name, uint8_t& group, uint32_t& periodUs) {
+    static const struct { const char* name; uint8_t index; uint32_t periodUs; } groupNames[] = {
+        {"EVERY_LOOP", SimpleScheduler::EVERY_LOOP, 0},
+        {"HZ_100", SimpleScheduler::HZ_100, 10000},
+        {"HZ_50", SimpleScheduler::HZ_50, 20000},
+        {"HZ_10", SimpleScheduler::HZ_10, 100000},
+        {"HZ_5", SimpleScheduler::HZ_5, 200000},
+        {"HZ_1", SimpleScheduler::HZ_1, 1000000},
+        {"HZ_0_2", SimpleScheduler::HZ_0_2, 5000000},
+    };
+    for (const auto& g : groupNames) {
+        if (name == g.name) {
+            group = g.index;
+            periodUs = g.periodUs;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool parsePriority(const std::string& name, uint8_t& priority) {
+    if (name == "CONTROL") priority = SimpleScheduler::PRIORITY_CONTROL;
+    else if (name == "HIGH") priority = SimpleScheduler::PRIORITY_HIGH;
+    else if (name == "NORMAL") priority = SimpleScheduler::PRIORITY_NORMAL;
+    else if (name == "LOW") priority = SimpleScheduler::PRIORITY_LOW;
+    else return false;
+    return true;
+}
+
+// fixed:US | uniform:MIN:MAX | hist:MAX:c0,c1,...,c15 (exec.max / exec.hist from /api/scheduler/stats)
+static bool parseCost(const std::string& spec, CostModel& cost) {
+    if (spec.compare(0, 6, "fixed:") == 0) {
+        cost.type = CostModel::FIXED;
+        cost.a = strtoul(spec.c_str() + 6, nullptr, 10);
+        return true;
+    }
+    if (spec.compare(0, 8, "uniform:") == 0) {
+        cost.type = CostModel::UNIFORM;
+        char* end = nullptr;
+        cost.a = strtoul(spec.c_str() + 8, &end, 10);
+        if (*end != ':') return false;
+        cost.b = strtoul(end + 1, nullptr, 10);
+        return cost.b >= cost.a;
+    }
+    if (spec.compare(0, 5, "hist:") == 0) {
+        cost.type = CostModel::HIST;
+        char* end = nullptr;
+        cost.a = strtoul(spec.c_str() + 5, &end, 10);
+        if (*end != ':') return false;
+        const char* p = end + 1;
+        for (uint8_t i = 0; i < SimpleScheduler::HIST_BUCKETS && *p; i++) {
+            cost.hist[i] = strtoul(p, &end, 10);
+            cost.histTotal += cost.hist[i];
+            p = (*end == ',') ? end + 1 : end;
+        }
+        return cost.histTotal > 0;
+    }
+    return false;
+}
+
+// Lines:
+//   group <GROUP> <name> <cost>
+//   timed <name> <periodUs> <phaseUs> <CONTROL|HIGH|NORMAL|LOW> <budgetUs> <cost>
+//   event <name> <maxIdleMs> <notifyRatePerSec> <cost>
+//   tick_budget <us>
+// '#' starts a comment. Names can't contain spaces.
+static bool loadTaskSet(const char* path, uint32_t& tickBudgetUs) {
+    std::ifstream file(path);
+    if (!file) {
+        fprintf(stderr, "Can't open %s\n", path);
+        return false;
+    }
+
+    std::string line;
+    int lineNo = 0;
+    while (std::getline(file, line)) {
+        lineNo++;
+        size_t hash = line.find('#');
+        if (hash != std::string::npos) line.erase(hash);
+        std::istringstream in(line);
+        std::string kind;
+        if (!(in >> kind)) continue;
+
+        SimTask task;
+        std::string costSpec;
+        bool ok = false;
+        if (kind == "group") {
+            std::string group;
+            task.kind = SimKind::GROUP;
+            ok = (in >> group >> task.name >> costSpec) && parseGroup(group, task.group, task.period);
+        } else if (kind == "timed") {
+            std::string priority;
+            task.kind = SimKind::TIMED;
+            ok = (in >> task.name >> task.period >> task.phase >> priority >> task.budget >> costSpec) &&
+                 task.period > 0 && parsePriority(priority, task.priority);
+        } else if (kind == "event") {
+            task.kind = SimKind::EVENT;
+            ok = (bool)(in >> task.name >> task.maxIdleMs >> task.ratePerSec >> costSpec);
+        } else if (kind == "tick_budget") {
+            ok = (bool)(in >> tickBudgetUs);
+            if (ok) continue;
+        }
+
+        if (!ok || (!costSpec.empty() && !parseCost(costSpec, task.cost))) {
+            fprintf(stderr, "%s:%d: can't parse '%s'\n", path, lineNo, line.c_str());
+            return false;
+        }
+        if (tasks.size() >= MAX_SIM_TASKS) {
+            fprintf(stderr, "%s:%d: more than %zu tasks\n", path, lineNo, MAX_SIM_TASKS);
+            return false;
+        }
+        tasks.push_back(task);
+    }
+    return !tasks.empty();
+}
+
+static bool registerTasks() {
+    for (size_t i = 0; i < tasks.size(); i++) {
+        SimTask& task = tasks[i];
+        const char* name = task.name.c_str();
+        bool ok = true;
+        switch (task.kind) {
+            case SimKind::GROUP:
+                ok = scheduler.addTask(task.group, trampolines[i], name);
+                break;
+            case SimKind::TIMED:
+                ok = scheduler.addTimedTask(trampolines[i], name, task.period, task.phase,
+                                            task.priority, task.budget);
+                break;
+            case SimKind::EVENT:
+                task.eventId = scheduler.addEventTask(trampolines[i], name, nullptr, task.maxIdleMs);
+                ok = task.eventId >= 0;
+                break;
+        }
+        if (!ok) {
+            fprintf(stderr, "Scheduler rejected task '%s' (table full?)\n", name);
+            return false;
+        }
+    }
+    return true;
+}
+
+// ============================================
+// Simulated interrupts (Poisson notify arrivals for event tasks)
+// ============================================
+static void scheduleNextArrival(SimTask& task) {
+    if (task.ratePerSec <= 0) {
+        task.nextArrival = UINT64_MAX;
+        return;
+    }
+    std::exponential_distribution<double> gap(task.ratePerSec / 1e6);
+    task.nextArrival = simNowUs + 1 + (uint64_t)gap(rng);
+}
+
+static void deliverEvents() {
+    nextEventArrivalUs = UINT64_MAX;
+    for (SimTask& task : tasks) {
+        if (task.kind != SimKind::EVENT) continue;
+        while (task.nextArrival <= simNowUs) {
+            scheduler.notify(task.eventId);
+            scheduleNextArrival(task);
+        }
+        nextEventArrivalUs = std::min(nextEventArrivalUs, task.nextArrival);
+    }
+}
+
+// ============================================
+// Report
+// ============================================
+static void printReport(uint64_t durationUs, uint64_t loopOverheadUs) {
+    double seconds = durationUs / 1e6;
+    printf("\n=== Simulated %.1f s (%.2f h) ===\n", seconds, seconds / 3600.0);
+    printf("%-20s %-8s %10s %8s %8s %8s %8s %8s %8s %8s\n",
+           "Task", "Group", "Runs", "CPU%", "ex p50", "ex p99", "late p50", "late p99", "late max", "misses");
+
+    double groupBusy[SimpleScheduler::NUM_GROUPS + 2] = {};  // groups, timed, event
+    uint8_t total = scheduler.getTotalTaskCount();
+    for (uint8_t i = 0; i < total; i++) {
+        SimpleScheduler::TaskInfo info;
+        if (!scheduler.getTaskInfo(i, info)) break;
+
+        // Scheduler order differs from file order (timed tasks are sorted)
+        const SimTask* sim = nullptr;
+        for (const SimTask& t : tasks) {
+            if (t.name == info.name) { sim = &t; break; }
+        }
+        if (!sim) continue;
+
+        const SimpleScheduler::TaskStats& s = *info.stats;
+        double cpu = 100.0 * sim->busyUs / durationUs;
+        size_t slot = (info.group == SimpleScheduler::TIMED_GROUP) ? SimpleScheduler::NUM_GROUPS
+                    : (info.group == SimpleScheduler::EVENT_GROUP) ? SimpleScheduler::NUM_GROUPS + 1
+                    : info.group;
+        groupBusy[slot] += sim->busyUs;
+
+        printf("%-20.20s %-8s %10llu %8.3f %8lu %8lu %8lu %8lu %8lu %8llu",
+               info.name, scheduler.getGroupName(info.group),
+               (unsigned long long)sim->runs, cpu,
+               (unsigned long)s.execHist.percentile(50, s.maxTime),
+               (unsigned long)s.execHist.percentile(99, s.maxTime),
+               (unsigned long)s.lateHist.percentile(50, s.maxLateness),
+               (unsigned long)s.lateHist.percentile(99, s.maxLateness),
+               (unsigned long)s.maxLateness,
+               (unsigned long long)sim->misses);
+        if (sim->skipped > 0) printf("  (%llu releases skipped)", (unsigned long long)sim->skipped);
+        if (s.deferrals > 0) printf("  (%lu deferrals)", (unsigned long)s.deferrals);
+        printf("\n");
+    }
+
+    printf("\nCPU utilisation per group:\n");
+    for (size_t g = 0; g < SimpleScheduler::NUM_GROUPS + 2; g++) {
+        if (groupBusy[g] == 0) continue;
+        uint8_t groupIndex = (g == SimpleScheduler::NUM_GROUPS) ? SimpleScheduler::TIMED_GROUP
+                           : (g == SimpleScheduler::NUM_GROUPS + 1) ? SimpleScheduler::EVENT_GROUP
+                           : (uint8_t)g;
+        printf("  %-10s %7.3f%%\n", scheduler.getGroupName(groupIndex), 100.0 * groupBusy[g] / durationUs);
+    }
+    printf("  %-10s %7.3f%%\n", "Loop ovh", 100.0 * loopOverheadUs / durationUs);
+    printf("  %-10s %7.3f%%\n", "Idle (WFI)", 100.0 * idleTimeUs / durationUs);
+    printf("Loops: %lu (counter wraps), idle sleeps: %lu\n",
+           (unsigned long)scheduler.getLoopCount(), (unsigned long)scheduler.getIdleCount());
+    printf("Latency columns in us; p50/p99 are log2 bucket upper bounds.\n");
+    printf("A miss is start lateness + run time > period.\n");
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <taskset> [--hours H] [--seed N] [--no-idle] [--loop-us US]\n", argv[0]);
+        return 1;
+    }
+
+    double hours = 1.0;
+    bool idleSleep = true;
+    uint32_t loopUs = 2;  // Per-pass scheduler overhead
+    for (int i = 2; i < argc; i++) {
+        if (!strcmp(argv[i], "--hours") && i + 1 < argc) hours = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--seed") && i + 1 < argc) rng.seed(strtoull(argv[++i], nullptr, 10));
+        else if (!strcmp(argv[i], "--no-idle")) idleSleep = false;
+        else if (!strcmp(argv[i], "--loop-us") && i + 1 < argc) loopUs = strtoul(argv[++i], nullptr, 10);
+        else {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    uint32_t tickBudgetUs = SimpleScheduler::DEFAULT_TICK_BUDGET_US;
+    if (!loadTaskSet(argv[1], tickBudgetUs) || !registerTasks()) {
+        return 1;
+    }
+    scheduler.setTickBudget(tickBudgetUs);
+    scheduler.setIdleSleep(idleSleep);
+    for (SimTask& task : tasks) {
+        if (task.kind == SimKind::EVENT) scheduleNextArrival(task);
+    }
+
+    uint64_t endUs = (uint64_t)(hours * 3600.0 * 1e6);
+    uint64_t loopOverheadUs = 0;
+    while (simNowUs < endUs) {
+        deliverEvents();
+        scheduler.run();
+        simNowUs += loopUs;
+        loopOverheadUs += loopUs;
+    }
+
+    printReport(simNowUs, loopOverheadUs);
+    return 0;
+}
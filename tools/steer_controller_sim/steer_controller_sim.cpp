@@ -0,0 +1,202 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// steer_controller_sim.cpp
+// Host simulation of the SteerController engine against a steering actuator
+// with deadband and lag. Runs the real SteerController at 100Hz (loop task)
+// and 1kHz (control lane) in P, PID and PID+FF modes and reports:
+//   step  - 0 -> 10 degree setpoint: settle time (within 0.5 degree for good),
+//           overshoot and the error left after 3 s
+//   sweep - AgOpenGPS-style 10Hz setpoints following a 0.25Hz, 10 degree sine:
+//           RMS and peak tracking error
+// The WAS is quantised to 12-bit ADC counts. Soft-start is not modelled, so
+// the step starts at full authority.
+//
+// Build (from the repository root):
+//   g++ -std=gnu++17 -O2 -Ilib/aio_autosteer tools/steer_controller_sim/steer_controller_sim.cpp -o steer_controller_sim
+//
+// Run:
+//   ./steer_controller_sim [--plant valve|motor] [--kp N] [--ki N] [--kd N] [--kff N] [--min N] [--high N]
+
+#include "SteerController.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static constexpr double PHYSICS_DT = 0.0001;   // 10kHz plant integration
+static constexpr double PGN_PERIOD = 0.1;      // PGN 254 at 10Hz
+
+struct Plant {
+    const char* name;
+    double deadband;     // |PWM| below this moves nothing (valve overlap, motor stiction)
+    double gain;         // Wheel angle deg/s per PWM above the deadband
+    double lag;          // First-order lag of the actuator, s
+    double countsPerDeg; // WAS ADC counts per degree
+
+    // Internal state
+    double flow = 0.0;
+    double angle = 0.0;
+
+    void step(int16_t pwm, double dt)
+    {
+        double excess = abs(pwm) > deadband ? (abs(pwm) - deadband) * (pwm > 0 ? 1 : -1) : 0.0;
+        flow += (excess * gain - flow) * dt / lag;
+        angle -= flow * dt;  // Positive drive steers towards negative angles
+        if (angle > 40.0) angle = 40.0;
+        if (angle < -40.0) angle = -40.0;
+    }
+    float measured() const { return (float)((int)(angle * countsPerDeg) / countsPerDeg); }
+};
+
+static Plant makePlant(const char* name)
+{
+    if (!strcmp(name, "motor")) {
+        return Plant{"motor", 12.0, 0.35, 0.03, 30.0};
+    }
+    return Plant{"valve", 45.0, 0.30, 0.12, 30.0};
+}
+
+// Mirror of AutosteerProcessor::updateTargetRate
+struct TargetRate {
+    float rate = 0.0f;
+    float refAngle = 0.0f;
+    double refTime = -1.0;
+
+    void update(float target, double now)
+    {
+        if (refTime < 0.0 || now - refTime > 0.3) {
+            rate = 0.0f;
+        } else if (now - refTime >= 0.02) {
+            float r = (float)((target - refAngle) / (now - refTime));
+            if (r > 60.0f) r = 60.0f;
+            if (r < -60.0f) r = -60.0f;
+            rate += 0.5f * (r - rate);
+        } else {
+            return;
+        }
+        refAngle = target;
+        refTime = now;
+    }
+};
+
+struct Settings {
+    const char* plant = "valve";
+    SteerController::Gains gains = {SteerController::P, 40.0f, 8.0f, 1.5f, 2.0f};
+    uint8_t minPWM = 40;
+    uint8_t highPWM = 255;
+};
+
+struct Result {
+    double settle;       // s, -1 if it never settled
+    double overshoot;    // degrees past the target
+    double finalError;
+    double rmsError;
+    double peakError;
+};
+
+typedef float (*Setpoint)(double t);
+
+static float stepSetpoint(double t) { return t < 0.5 ? 0.0f : 10.0f; }
+static float sweepSetpoint(double t) { return (float)(10.0 * sin(2.0 * M_PI * 0.25 * t)); }
+
+static Result run(const Settings& settings, uint8_t mode, double rateHz, Setpoint setpoint, double duration)
+{
+    Plant plant = makePlant(settings.plant);
+    SteerController controller;
+    SteerController::Gains gains = settings.gains;
+    gains.mode = mode;
+    TargetRate targetRate;
+
+    double controlPeriod = 1.0 / rateHz;
+    double nextControl = 0.0;
+    double nextPGN = 0.0;
+    float target = 0.0f;
+    int16_t pwm = 0;
+
+    Result r = {-1.0, 0.0, 0.0, 0.0, 0.0};
+    double sumSq = 0.0;
+    long samples = 0;
+    double lastOutside = 0.5;
+
+    for (double t = 0.0; t < duration; t += PHYSICS_DT) {
+        if (t >= nextPGN) {
+            target = setpoint(t);
+            targetRate.update(target, t);
+            nextPGN += PGN_PERIOD;
+        }
+        if (t >= nextControl) {
+            float actual = plant.measured();
+            pwm = controller.update(gains, actual - target, actual, targetRate.rate, (float)controlPeriod,
+                                    settings.highPWM, settings.minPWM, true);
+            nextControl += controlPeriod;
+        }
+        plant.step(pwm, PHYSICS_DT);
+
+        // Judge against the continuous setpoint, not the 10Hz copy
+        double error = plant.angle - setpoint(t);
+        if (t >= 0.5) {
+            if (fabs(error) > 0.5) lastOutside = t;
+            if (setpoint == stepSetpoint && plant.angle - 10.0 > r.overshoot) r.overshoot = plant.angle - 10.0;
+            if (t >= 1.0) {
+                sumSq += error * error;
+                samples++;
+                if (fabs(error) > r.peakError) r.peakError = fabs(error);
+            }
+        }
+        r.finalError = error;
+    }
+    if (lastOutside < duration - 0.5) r.settle = lastOutside - 0.5;
+    r.rmsError = samples ? sqrt(sumSq / samples) : 0.0;
+    return r;
+}
+
+int main(int argc, char** argv)
+{
+    Settings settings;
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (!value) {
+            fprintf(stderr, "missing value for %s\n", arg);
+            return 1;
+        }
+        if (!strcmp(arg, "--plant")) settings.plant = value;
+        else if (!strcmp(arg, "--kp")) settings.gains.kp = atof(value);
+        else if (!strcmp(arg, "--ki")) settings.gains.ki = atof(value);
+        else if (!strcmp(arg, "--kd")) settings.gains.kd = atof(value);
+        else if (!strcmp(arg, "--kff")) settings.gains.kff = atof(value);
+        else if (!strcmp(arg, "--min")) settings.minPWM = atoi(value);
+        else if (!strcmp(arg, "--high")) settings.highPWM = atoi(value);
+        else {
+            fprintf(stderr, "usage: %s [--plant valve|motor] [--kp N] [--ki N] [--kd N] [--kff N] [--min N] [--high N]\n", argv[0]);
+            return 1;
+        }
+        i++;
+    }
+
+    Plant plant = makePlant(settings.plant);
+    printf("Plant %s: deadband %.0f PWM, %.2f deg/s per PWM, lag %.0f ms\n", plant.name, plant.deadband,
+           plant.gain, plant.lag * 1000.0);
+    printf("Kp %.1f  Ki %.1f  Kd %.2f  Kff %.2f  minPWM %u  highPWM %u\n\n", settings.gains.kp, settings.gains.ki,
+           settings.gains.kd, settings.gains.kff, settings.minPWM, settings.highPWM);
+    printf("%-8s %6s | %10s %10s %10s | %10s %10s\n", "Mode", "Rate", "Settle s", "Overshoot", "Error 3s",
+           "Sweep RMS", "Sweep max");
+
+    static const double rates[] = {100.0, 1000.0};
+    for (uint8_t mode = 0; mode < SteerController::MODE_COUNT; mode++) {
+        for (double rate : rates) {
+            Result step = run(settings, mode, rate, stepSetpoint, 3.5);
+            Result sweep = run(settings, mode, rate, sweepSetpoint, 12.0);
+            char settle[16];
+            if (step.settle >= 0.0) snprintf(settle, sizeof(settle), "%.2f", step.settle);
+            else snprintf(settle, sizeof(settle), "never");
+            printf("%-8s %4.0fHz | %10s %9.2f° %9.2f° | %9.2f° %9.2f°\n", SteerController::modeName(mode), rate,
+                   settle, step.overshoot, step.finalError, sweep.rmsError, sweep.peakError);
+        }
+    }
+    return 0;
+}
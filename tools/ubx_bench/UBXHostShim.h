@@ -0,0 +1,49 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// UBXHostShim.h
+// Just enough of the Arduino core for lib/UBXParser/UBXParser.h to build on
+// the host (-DUBX_HOST_BENCH). Serial output is discarded; millis()/micros()
+// come from the including program.
+
+#ifndef UBX_HOST_SHIM_H
+#define UBX_HOST_SHIM_H
+
+#include <stdint.h>
+#include <math.h>
+
+typedef uint8_t byte;
+
+#ifndef HEX
+#define HEX 16
+#endif
+#ifndef RAD_TO_DEG
+#define RAD_TO_DEG 57.295779513082320876798154814105
+#endif
+
+uint32_t millis();
+uint32_t micros();
+
+struct HostSerial {
+    template <typename T> void print(T) {}
+    template <typename T> void print(T, int) {}
+    template <typename T> void println(T) {}
+    void println() {}
+    template <typename... Args> void printf(const char*, Args...) {}
+};
+static HostSerial Serial;
+
+class elapsedMillis {
+public:
+    elapsedMillis() : start(millis()) {}
+    operator uint32_t() const { return millis() - start; }
+    elapsedMillis& operator=(uint32_t value) { start = millis() - value; return *this; }
+
+private:
+    uint32_t start;
+};
+
+#endif // UBX_HOST_SHIM_H
@@ -0,0 +1,349 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// ubx_bench.cpp
+// Host benchmark for the GPS2 UBX path in GNSSProcessor. Runs a UBX byte
+// stream through UBX_Parser alone (the old RELPOSNED-only path) and through
+// UBX_Parser plus the UBXNav decode and iTOW epoch grouping, and reports
+// ns/byte for each and the cost per reported epoch. The stream is a u-blox
+// capture (e.g. saved from u-center) or a synthetic one of PVT + HPPOSLLH +
+// RELPOSNED epochs with interleaved NMEA, non-NAV frames and bad checksums;
+// for synthetic streams the reported epochs and the PVT/HPPOSLLH position
+// agreement are checked against what was generated.
+//
+// Build (from the repository root; -funsigned-char matches ARM, which
+// UBX_Parser's checksum compare relies on):
+//   g++ -std=gnu++17 -O2 -funsigned-char -DUBX_HOST_BENCH -Itools/ubx_bench -Ilib/UBXParser -Ilib/aio_navigation tools/ubx_bench/ubx_bench.cpp -o ubx_bench
+//
+// Run:
+//   ./ubx_bench capture.ubx [--passes N]
+//   ./ubx_bench --synth SECONDS [--rate HZ] [--eoe] [--passes N]
+
+#include "UBXParser.h"
+#include "UBXNav.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static const auto benchStart = std::chrono::steady_clock::now();
+
+uint32_t micros()
+{
+    using namespace std::chrono;
+    return (uint32_t)duration_cast<microseconds>(steady_clock::now() - benchStart).count();
+}
+
+uint32_t millis()
+{
+    return micros() / 1000;
+}
+
+static double nowNs()
+{
+    using namespace std::chrono;
+    return (double)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// ---- Synthetic stream -------------------------------------------------------
+
+struct Synth {
+    std::vector<uint8_t> bytes;
+    uint32_t epochs = 0;
+    uint32_t expectedReports = 0;
+    uint32_t badFrames = 0;
+    uint32_t seed = 12345;
+
+    uint32_t next()
+    {
+        seed = seed * 1103515245u + 12345u;
+        return seed >> 8;
+    }
+
+    static void put16(uint8_t* p, uint16_t v) { memcpy(p, &v, 2); }
+    static void put32(uint8_t* p, uint32_t v) { memcpy(p, &v, 4); }
+
+    // Appends a frame, returns false if its checksum was spoiled
+    bool frame(uint8_t cls, uint8_t id, const uint8_t* payload, uint16_t length)
+    {
+        size_t start = bytes.size();
+        bytes.push_back(0xB5);
+        bytes.push_back(0x62);
+        bytes.push_back(cls);
+        bytes.push_back(id);
+        bytes.push_back(length & 0xFF);
+        bytes.push_back(length >> 8);
+        bytes.insert(bytes.end(), payload, payload + length);
+
+        uint8_t a = 0, b = 0;
+        for (size_t i = start + 2; i < bytes.size(); i++) {
+            a += bytes[i];
+            b += a;
+        }
+        bool good = (next() % 64) != 0;
+        if (!good) {
+            b ^= 0x5A;
+            badFrames++;
+        }
+        bytes.push_back(a);
+        bytes.push_back(b);
+        return good;
+    }
+
+    void nmea()
+    {
+        static const char gga[] = "$GNGGA,120000.00,4530.1234567,N,12230.7654321,W,4,24,0.6,55.1,M,-20.1,M,1.0,0000*7B\r\n";
+        bytes.insert(bytes.end(), gga, gga + sizeof(gga) - 1);
+    }
+
+    void build(uint32_t seconds, uint32_t rate, bool eoe)
+    {
+        int64_t latNano = 45502057612LL;    // Nano-degrees
+        int64_t lonNano = -122512757202LL;
+        uint32_t iTOW = 302400000;
+
+        for (uint32_t e = 0; e < seconds * rate; e++, iTOW += 1000 / rate) {
+            latNano += 2000 + (int64_t)(next() % 200);
+            lonNano += 1500 + (int64_t)(next() % 200);
+            int32_t lat = (int32_t)((latNano + (latNano >= 0 ? 50 : -50)) / 100);
+            int32_t lon = (int32_t)((lonNano + (lonNano >= 0 ? 50 : -50)) / 100);
+
+            uint8_t pvt[UBXNav::PVT_LENGTH] = {};
+            put32(pvt + 0, iTOW);
+            pvt[8] = 12; pvt[9] = (e / rate / 60) % 60; pvt[10] = (e / rate) % 60;
+            pvt[20] = 3;                     // 3D
+            pvt[21] = 0x01 | 0x02 | (2 << 6); // gnssFixOK, diffSoln, RTK fixed
+            pvt[23] = 24;
+            put32(pvt + 24, (uint32_t)lon);
+            put32(pvt + 28, (uint32_t)lat);
+            put32(pvt + 36, 55100);
+            put32(pvt + 40, 14);
+            put32(pvt + 44, 20);
+            put32(pvt + 52, 2800);
+            put32(pvt + 60, 2800);
+            put32(pvt + 64, 9000000);
+            put16(pvt + 76, 120);
+            put16(pvt + 78, 2 << 1);
+
+            uint8_t hp[UBXNav::HPPOSLLH_LENGTH] = {};
+            put32(hp + 4, iTOW);
+            put32(hp + 8, (uint32_t)lon);
+            put32(hp + 12, (uint32_t)lat);
+            hp[24] = (uint8_t)(int8_t)(lonNano - (int64_t)lon * 100);
+            hp[25] = (uint8_t)(int8_t)(latNano - (int64_t)lat * 100);
+            put32(hp + 20, 55100);
+            put32(hp + 28, 140);
+            put32(hp + 32, 200);
+
+            uint8_t rel[UBXNav::RELPOSNED_LENGTH] = {};
+            put32(rel + 4, iTOW);
+            put32(rel + 20, 120);               // relPosLength, cm
+            put32(rel + 24, 4500000);           // relPosHeading, 1e-5 deg
+            put32(rel + 60, 0x01 | 0x02 | 0x04 | (2 << 3));
+
+            bool pvtOk = frame(UBXNav::CLASS_NAV, UBXNav::ID_PVT, pvt, sizeof(pvt));
+            bool hpOk = frame(UBXNav::CLASS_NAV, UBXNav::ID_HPPOSLLH, hp, sizeof(hp));
+            if (next() % 8 == 0) {
+                uint8_t monHw[60] = {};
+                frame(0x0A, 0x09, monHw, sizeof(monHw));
+            }
+            bool relOk = frame(UBXNav::CLASS_NAV, UBXNav::ID_RELPOSNED, rel, sizeof(rel));
+            bool eoeOk = false;
+            if (eoe) {
+                uint8_t end[UBXNav::EOE_LENGTH];
+                put32(end, iTOW);
+                eoeOk = frame(UBXNav::CLASS_NAV, UBXNav::ID_EOE, end, sizeof(end));
+            }
+            nmea();
+
+            // The first epoch has nothing to learn from, so only EOE reports it
+            bool complete = pvtOk && hpOk && relOk && e > 0;
+            if (complete || (eoeOk && (pvtOk || hpOk || relOk))) expectedReports++;
+            epochs++;
+        }
+    }
+};
+
+// ---- Paths ------------------------------------------------------------------
+
+// What GNSSProcessor did before: parse, pick up RELPOSNED heading
+struct LegacyPath {
+    UBX_Parser parser;
+    uint32_t relposned = 0;
+
+    void run(const uint8_t* data, size_t size)
+    {
+        for (size_t i = 0; i < size; i++) {
+            parser.parse(data[i]);
+            if (parser.relPosNedReady) {
+                parser.relPosNedReady = false;
+                relposned++;
+            }
+        }
+    }
+};
+
+// GNSSProcessor::processUBXByte minus the GNSSData writes
+struct FastPath {
+    UBX_Parser parser;
+    UBXNav::EpochGrouper grouper;
+    uint32_t reports = 0;
+    uint32_t fullReports = 0;
+    uint32_t pvtCount = 0;
+    uint32_t hpCount = 0;
+    int64_t maxDeltaNano = 0;  // |HPPOSLLH - PVT| within an epoch
+    int64_t pvtLat = 0;
+    uint32_t pvtITOW = 0;
+    bool havePvt = false;
+    double sink = 0;
+
+    void report(uint8_t mask)
+    {
+        if (!mask) return;
+        reports++;
+        if (mask == (UBXNav::EpochGrouper::MSG_PVT | UBXNav::EpochGrouper::MSG_HPPOSLLH |
+                     UBXNav::EpochGrouper::MSG_RELPOSNED)) {
+            fullReports++;
+        }
+    }
+
+    void run(const uint8_t* data, size_t size)
+    {
+        for (size_t i = 0; i < size; i++) {
+            parser.parse(data[i]);
+            if (!parser.frameReady || parser.frameClass != UBXNav::CLASS_NAV) continue;
+
+            const uint8_t* payload = parser.framePayload();
+            uint16_t length = (uint16_t)parser.frameLength;
+            switch (parser.frameId) {
+            case UBXNav::ID_PVT: {
+                UBXNav::PVT pvt;
+                if (!UBXNav::decodePVT(payload, length, pvt)) break;
+                pvtCount++;
+                sink += pvt.lat * 1e-7 + UBXNav::fixQuality(pvt);
+                pvtLat = (int64_t)pvt.lat * 100;
+                pvtITOW = pvt.iTOW;
+                havePvt = true;
+                report(grouper.add(pvt.iTOW, UBXNav::EpochGrouper::MSG_PVT));
+                break;
+            }
+            case UBXNav::ID_HPPOSLLH: {
+                UBXNav::HPPOSLLH hp;
+                if (!UBXNav::decodeHPPOSLLH(payload, length, hp)) break;
+                hpCount++;
+                sink += hp.latNano * 1e-9;
+                if (havePvt && pvtITOW == hp.iTOW) {
+                    int64_t delta = hp.latNano - pvtLat;
+                    if (delta < 0) delta = -delta;
+                    if (delta > maxDeltaNano) maxDeltaNano = delta;
+                }
+                report(grouper.add(hp.iTOW, UBXNav::EpochGrouper::MSG_HPPOSLLH));
+                break;
+            }
+            case UBXNav::ID_RELPOSNED:
+                if (length < UBXNav::RELPOSNED_LENGTH) break;
+                parser.relPosNedReady = false;
+                report(grouper.add(UBXNav::readU32(payload + 4), UBXNav::EpochGrouper::MSG_RELPOSNED));
+                break;
+            case UBXNav::ID_EOE:
+                if (length >= UBXNav::EOE_LENGTH) report(grouper.endOfEpoch(UBXNav::readU32(payload)));
+                break;
+            }
+        }
+    }
+};
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s capture.ubx [--passes N]\n"
+                        "       %s --synth SECONDS [--rate HZ] [--eoe] [--passes N]\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    int passes = 20;
+    uint32_t synthSeconds = 0;
+    uint32_t rate = 10;
+    bool eoe = false;
+    const char* path = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--passes") == 0 && i + 1 < argc) passes = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--synth") == 0 && i + 1 < argc) synthSeconds = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--rate") == 0 && i + 1 < argc) rate = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--eoe") == 0) eoe = true;
+        else path = argv[i];
+    }
+    if (passes < 1) passes = 1;
+    if (rate < 1 || rate > 25) rate = 10;
+
+    Synth synth;
+    std::string capture;
+    const uint8_t* data;
+    size_t size;
+    if (synthSeconds) {
+        synth.build(synthSeconds, rate, eoe);
+        data = synth.bytes.data();
+        size = synth.bytes.size();
+        printf("Synthetic: %u epochs at %u Hz%s, %zu bytes, %u bad frames, %d passes\n",
+               synth.epochs, rate, eoe ? " with EOE" : "", size, synth.badFrames, passes);
+    } else {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            fprintf(stderr, "cannot open %s\n", path);
+            return 1;
+        }
+        std::stringstream ss;
+        ss << in.rdbuf();
+        capture = ss.str();
+        data = (const uint8_t*)capture.data();
+        size = capture.size();
+        printf("Capture: %s, %zu bytes, %d passes\n", path, size, passes);
+    }
+
+    // Correctness from a single pass
+    FastPath check;
+    check.run(data, size);
+
+    double start = nowNs();
+    for (int p = 0; p < passes; p++) {
+        LegacyPath legacy;
+        legacy.run(data, size);
+    }
+    double legacyNs = (nowNs() - start) / passes;
+
+    double fastSink = 0;
+    start = nowNs();
+    for (int p = 0; p < passes; p++) {
+        FastPath fast;
+        fast.run(data, size);
+        fastSink += fast.sink;
+    }
+    double fastNs = (nowNs() - start) / passes;
+
+    printf("%-8s %10s %12s\n", "Path", "ns/byte", "us/epoch");
+    printf("%-8s %10.2f %12s\n", "legacy", legacyNs / size, "-");
+    printf("%-8s %10.2f %12.3f\n", "fast", fastNs / size,
+           check.reports ? fastNs / check.reports / 1000.0 : 0.0);
+    printf("Decode overhead: %.1f%%\n", 100.0 * (fastNs - legacyNs) / legacyNs);
+    printf("PVT %u, HPPOSLLH %u, epochs reported %u (%u complete), expected set 0x%02X\n",
+           check.pvtCount, check.hpCount, check.reports, check.fullReports, check.grouper.getExpected());
+    printf("Max PVT/HPPOSLLH latitude difference: %lld nano-degrees\n", (long long)check.maxDeltaNano);
+    if (fastSink == 0) printf("\n");  // Keep the decode from being optimised out
+
+    if (synthSeconds) {
+        if (check.reports != synth.expectedReports || check.maxDeltaNano > 50) {
+            printf("MISMATCH: expected %u epochs, max difference 50\n", synth.expectedReports);
+            return 2;
+        }
+        printf("Epochs as generated\n");
+    }
+    return 0;
+}
@@ -0,0 +1,283 @@
+// Firmware_Teensy_AiO-New-Dawn is copyright 2025 by the AOG Group
+// Firmware_Teensy_AiO-New-Dawn is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+// Firmware_Teensy_AiO-New-Dawn is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License along with Firmware_Teensy_AiO-New-Dawn. If not, see <https://www.gnu.org/licenses/>.
+// Like most Arduino code, portions of this are based on other open source Arduino code with a compatiable license.
+
+// udp_rx_bench.cpp
+// Host benchmark for the PGN and RTCM receive path in QNEthernetUDPHandler.
+// Delivers the same datagrams two ways and reports packets/s for each:
+//   copy - EthernetUDP as before: the receive callback copies the pbuf into
+//          the socket's queue, parsePacket() copies it out again and read()
+//          copies it into packetBuffer
+//   ref  - the pbuf reference queue: the callback queues the pbuf and poll()
+//          hands its payload over in place
+// The pbuf pool and handlers are stand-ins (PGN header and checksum check,
+// RTCM through the real RTCM3::Framer), so the numbers compare the two
+// paths rather than predict the Teensy's. Both paths must hand identical
+// data to the handlers or the run fails.
+//
+// Build (from the repository root):
+//   g++ -std=gnu++17 -O2 -Ilib/aio_system tools/udp_rx_bench/udp_rx_bench.cpp -o udp_rx_bench
+//
+// Run:
+//   ./udp_rx_bench [--datagrams N] [--burst N]
+
+#include "RTCM3Framer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+// lwIP pool pbuf stand-in; one Ethernet frame per pbuf as the T4.1 driver does
+struct Pbuf {
+    uint8_t payload[1536];
+    uint16_t len;
+    Pbuf* nextFree;
+};
+
+class PbufPool {
+public:
+    explicit PbufPool(size_t size) : pbufs(size)
+    {
+        for (Pbuf& p : pbufs) free(&p);
+    }
+    Pbuf* alloc()
+    {
+        Pbuf* p = head;
+        if (p) head = p->nextFree;
+        return p;
+    }
+    void free(Pbuf* p)
+    {
+        p->nextFree = head;
+        head = p;
+    }
+
+private:
+    std::vector<Pbuf> pbufs;
+    Pbuf* head = nullptr;
+};
+
+// Handlers: enough work to touch every byte, plus a digest to compare paths
+struct Sink {
+    uint32_t datagrams = 0;
+    uint32_t accepted = 0;
+    uint32_t digest = 2166136261u;
+    RTCM3::Framer framer;
+
+    void pgn(const uint8_t* data, size_t len)
+    {
+        datagrams++;
+        if (len < 6 || data[0] != 0x80 || data[1] != 0x81) return;
+        uint8_t crc = 0;
+        for (size_t i = 2; i < len - 1; i++) crc += data[i];
+        if (crc == data[len - 1]) {
+            accepted++;
+            digest = (digest ^ data[3]) * 16777619u;
+        }
+    }
+    void rtcm(const uint8_t* data, size_t len)
+    {
+        datagrams++;
+        framer.feed(data, len, [this](const uint8_t* frame, uint16_t length) {
+            accepted++;
+            digest = (digest ^ frame[length - 1]) * 16777619u;
+        });
+    }
+};
+
+typedef void (Sink::*Handler)(const uint8_t*, size_t);
+
+// Mirror of EthernetUDP's receive queue (QNEthernet 0.26)
+class CopySocket {
+public:
+    explicit CopySocket(size_t queueSize) : inBuf(queueSize) {}
+
+    void receive(Pbuf* p, PbufPool& pool)  // recvFunc
+    {
+        std::vector<uint8_t>& slot = inBuf[head];
+        slot.clear();
+        slot.reserve(p->len);
+        slot.insert(slot.end(), p->payload, p->payload + p->len);
+        if (size != 0 && tail == head) {
+            tail = (tail + 1) % inBuf.size();
+        } else {
+            size++;
+        }
+        head = (head + 1) % inBuf.size();
+        pool.free(p);
+    }
+    void poll(Sink& sink, Handler handler)  // drainSocket
+    {
+        while (size > 0) {
+            packet = inBuf[tail];  // parsePacket
+            inBuf[tail].clear();
+            tail = (tail + 1) % inBuf.size();
+            size--;
+            size_t n = std::min(packet.size(), sizeof(packetBuffer));
+            memcpy(packetBuffer, packet.data(), n);  // read
+            (sink.*handler)(packetBuffer, n);
+        }
+    }
+
+private:
+    std::vector<std::vector<uint8_t>> inBuf;
+    std::vector<uint8_t> packet;
+    size_t head = 0, tail = 0, size = 0;
+    uint8_t packetBuffer[1472];
+};
+
+// Mirror of QNEthernetUDPHandler::PbufQueue
+class RefSocket {
+public:
+    static constexpr uint8_t SIZE = 4;
+
+    void receive(Pbuf* p, PbufPool& pool)
+    {
+        if (count == SIZE) {
+            pool.free(entries[head]);
+            head = (head + 1) % SIZE;
+            count--;
+        }
+        entries[(head + count) % SIZE] = p;
+        count++;
+    }
+    void poll(Sink& sink, Handler handler, PbufPool& pool)
+    {
+        while (count > 0) {
+            Pbuf* p = entries[head];
+            head = (head + 1) % SIZE;
+            count--;
+            (sink.*handler)(p->payload, p->len);
+            pool.free(p);
+        }
+    }
+
+private:
+    Pbuf* entries[SIZE];
+    uint8_t head = 0, count = 0;
+};
+
+static std::vector<std::vector<uint8_t>> makePGNTraffic(size_t count)
+{
+    // AgIO's steady state: 254 steer data, 239 machine data, 229 sections,
+    // 200 hello - with the occasional 252/251 settings
+    static const uint8_t pgns[] = {254, 239, 254, 229, 254, 200, 252, 251};
+    static const uint8_t lengths[] = {8, 8, 8, 8, 8, 3, 8, 8};
+    std::vector<std::vector<uint8_t>> traffic;
+    for (size_t i = 0; i < count; i++) {
+        uint8_t k = i % sizeof(pgns);
+        std::vector<uint8_t> d = {0x80, 0x81, 0x7F, pgns[k], lengths[k]};
+        for (uint8_t j = 0; j < lengths[k]; j++) d.push_back((uint8_t)rand());
+        uint8_t crc = 0;
+        for (size_t j = 2; j < d.size(); j++) crc += d[j];
+        d.push_back(crc);
+        traffic.push_back(d);
+    }
+    return traffic;
+}
+
+static std::vector<std::vector<uint8_t>> makeRTCMTraffic(size_t count)
+{
+    // MSM7-sized frames with valid CRCs, packed into datagrams as a caster
+    // relay does - up to 1400 bytes, frames split across datagram boundaries
+    std::vector<uint8_t> stream;
+    while (stream.size() < count * 1400) {
+        uint16_t payload = 100 + rand() % 500;
+        std::vector<uint8_t> frame = {RTCM3::PREAMBLE, (uint8_t)(payload >> 8), (uint8_t)payload};
+        frame.push_back(1077 >> 4);
+        frame.push_back((1077 & 0x0F) << 4);
+        for (uint16_t j = 2; j < payload; j++) frame.push_back((uint8_t)rand());
+        uint32_t crc = RTCM3::crc24q(frame.data(), frame.size());
+        frame.push_back(crc >> 16);
+        frame.push_back(crc >> 8);
+        frame.push_back(crc);
+        stream.insert(stream.end(), frame.begin(), frame.end());
+    }
+    std::vector<std::vector<uint8_t>> traffic;
+    size_t pos = 0;
+    while (traffic.size() < count && pos < stream.size()) {
+        size_t n = std::min<size_t>(600 + rand() % 801, stream.size() - pos);
+        traffic.emplace_back(stream.begin() + pos, stream.begin() + pos + n);
+        pos += n;
+    }
+    return traffic;
+}
+
+struct Result {
+    double seconds;
+    Sink sink;
+};
+
+// Deliver bursts of `burst` datagrams, then poll, as lwIP and the main loop do
+template <typename Socket, typename Poll>
+static Result run(const std::vector<std::vector<uint8_t>>& traffic, size_t burst, Socket& socket, Poll poll)
+{
+    PbufPool pool(16);
+    Result result;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < traffic.size(); i += burst) {
+        for (size_t j = i; j < i + burst && j < traffic.size(); j++) {
+            Pbuf* p = pool.alloc();  // Driver: DMA buffer into a pool pbuf
+            if (!p) break;
+            memcpy(p->payload, traffic[j].data(), traffic[j].size());
+            p->len = traffic[j].size();
+            socket.receive(p, pool);
+        }
+        poll(result.sink, pool);
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+static bool compare(const char* name, const std::vector<std::vector<uint8_t>>& traffic, size_t burst,
+                    size_t copyQueueSize, Handler handler)
+{
+    CopySocket copySocket(copyQueueSize);
+    RefSocket refSocket;
+    Result copy = run(traffic, burst, copySocket, [&](Sink& sink, PbufPool&) { copySocket.poll(sink, handler); });
+    Result ref = run(traffic, burst, refSocket, [&](Sink& sink, PbufPool& pool) { refSocket.poll(sink, handler, pool); });
+
+    size_t bytes = 0;
+    for (const auto& d : traffic) bytes += d.size();
+    printf("%-5s %8zu datagrams, %6.1f bytes avg\n", name, traffic.size(), (double)bytes / traffic.size());
+    printf("  copy: %10.0f packets/s  %7.1f ns/packet\n", traffic.size() / copy.seconds, copy.seconds * 1e9 / traffic.size());
+    printf("  ref:  %10.0f packets/s  %7.1f ns/packet  (%.2fx)\n", traffic.size() / ref.seconds,
+           ref.seconds * 1e9 / traffic.size(), copy.seconds / ref.seconds);
+
+    if (copy.sink.datagrams != ref.sink.datagrams || copy.sink.accepted != ref.sink.accepted ||
+        copy.sink.digest != ref.sink.digest) {
+        printf("  MISMATCH: copy %u/%u, ref %u/%u\n", copy.sink.datagrams, copy.sink.accepted,
+               ref.sink.datagrams, ref.sink.accepted);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    size_t datagrams = 200000;
+    size_t burst = 4;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--datagrams") && i + 1 < argc) {
+            datagrams = strtoul(argv[++i], nullptr, 10);
+        } else if (!strcmp(argv[i], "--burst") && i + 1 < argc) {
+            burst = strtoul(argv[++i], nullptr, 10);
+        } else {
+            fprintf(stderr, "usage: %s [--datagrams N] [--burst N]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (burst < 1 || burst > RefSocket::SIZE) {
+        fprintf(stderr, "--burst must be 1..%u so neither queue overflows\n", RefSocket::SIZE);
+        return 1;
+    }
+
+    srand(1);
+    bool ok = compare("PGN", makePGNTraffic(datagrams), burst, 8, &Sink::pgn);
+    ok &= compare("RTCM", makeRTCMTraffic(datagrams / 10), burst, 16, &Sink::rtcm);
+    return ok ? 0 : 1;
+}